@@ -0,0 +1,597 @@
+/**
+ * In-process implementation of CXL::TrafficGenerator.
+ *
+ * The generator embeds the MQSim engine, the CXL device (DRAM cache, MSHR, prefetchers in CXL_Manager)
+ * and the complete flash back end (FTL, TSU, PHY, flash chips) built from ../src. Each 4 KB line that a
+ * request touches becomes one CXL.mem transaction (MemRd/MemWr) that the host port hands to the device,
+ * and the device reports completed accesses through the access serviced signal of CXL_DRAM_Model. Simulated time only moves inside tick/run_until/run_until_complete,
+ * which execute the engine's event queue up to the requested time, so a given sequence of calls always
+ * produces the same results.
+ */
+
+#include "cxl_traffic_gen.h"
+
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "sim/Engine.h"
+#include "exec/Device_Parameter_Set.h"
+#include "exec/IO_Flow_Parameter_Set.h"
+#include "exec/SSD_Device.h"
+#include "host/Host_Defs.h"
+#include "host/PCIe_Switch.h"
+#include "cxl/CXL_Config.h"
+#include "cxl/CXL_PCIe.h"
+#include "cxl/Host_Interface_CXL.h"
+#include "ssd/Stats.h"
+#include "utils/Logical_Address_Partitioning_Unit.h"
+
+namespace CXL {
+
+class TrafficGenerator::Impl {
+public:
+    explicit Impl(const Config& config);
+    ~Impl();
+
+    RequestID submit(Address address, uint32_t size, bool is_read, CompletionCallback callback);
+    void run_until(uint64_t time_ns);
+    bool run_until_complete(uint64_t max_time_ns);
+    bool has_pending_requests() const { return !requests_.empty(); }
+    Statistics get_statistics() const;
+    void reset_statistics();
+
+private:
+    // The host side of the link. It keeps the stall behavior of CXL_PCIe (MSHR full, DRAM busy, flash
+    // back end full) but takes its accesses from the generator instead of an IO flow.
+    class Port final : public Host_Components::CXL_PCIe {
+    public:
+        explicit Port(Impl* owner) : CXL_PCIe("TrafficGenerator.Port"), owner_(owner) { log_stalls = false; }
+        void Execute_simulator_event(MQSimEngine::Sim_Event* event) override;
+        void Resume_skipped_requests() override;
+        void Schedule_admission();
+    private:
+        Impl* owner_;
+        bool admission_scheduled_ = false;  // At most one admission event is pending, whatever the backlog
+    };
+
+    struct Access {
+        RequestID request;
+        Address address;
+        bool is_read;
+    };
+
+    struct Request {
+        sim_time_type submit_time;
+        uint32_t outstanding_accesses;
+        CompletionCallback callback;
+    };
+
+    struct In_flight_access {
+        sim_time_type initiate_time;
+        RequestID request;
+    };
+
+    // Device counters at the last reset_statistics()
+    struct Device_counters {
+        uint64_t cache_hits = 0, cache_misses = 0;
+        uint64_t prefetch_issued = 0, prefetch_hits = 0, prefetch_pollution = 0;
+        uint64_t flash_reads = 0, flash_writes = 0, flash_erases = 0, gc_executions = 0;
+    };
+
+    static Impl* active_instance_;
+    static void handle_access_serviced(uint64_t lba, sim_time_type initiate_time);
+
+    void admit_next_access();
+    void complete_access(uint64_t lba, sim_time_type initiate_time);
+    Device_counters read_device_counters() const;
+
+    Config config_;
+    cxl_config cxl_parameters_;
+    Device_Parameter_Set device_parameters_;
+    IO_Flow_Parameter_Set_Trace_Based flow_parameters_;
+    std::vector<IO_Flow_Parameter_Set*> flows_;
+    std::vector<flash_channel_ID_type> channel_ids_;
+    std::vector<flash_chip_ID_type> chip_ids_;
+    std::vector<flash_die_ID_type> die_ids_;
+    std::vector<flash_plane_ID_type> plane_ids_;
+
+    std::unique_ptr<SSD_Device> ssd_;
+    SSD_Components::Host_Interface_CXL* host_interface_ = nullptr;
+    std::unique_ptr<Host_Components::PCIe_Switch> pcie_switch_;
+    std::unique_ptr<Port> port_;
+
+    RequestID next_request_id_ = 1;
+    std::deque<Access> admission_queue_;
+    std::unordered_map<RequestID, Request> requests_;
+    std::unordered_map<uint64_t, std::deque<In_flight_access>> in_flight_;
+
+    uint64_t submitted_requests_ = 0;
+    uint64_t completed_requests_ = 0;
+    uint64_t min_latency_ns_ = UINT64_MAX;
+    uint64_t max_latency_ns_ = 0;
+    uint64_t total_latency_ns_ = 0;
+    Device_counters baseline_;
+
+    friend class TrafficGenerator;
+};
+
+TrafficGenerator::Impl* TrafficGenerator::Impl::active_instance_ = nullptr;
+
+namespace {
+
+const uint64_t CXL_ACCESS_GRANULARITY = 4096;  // CXL_Manager tracks the device DRAM cache in 4 KB lines
+
+cachepolicy to_cxl_cache_policy(TrafficGenerator::Config::CachePolicy policy) {
+    using CachePolicy = TrafficGenerator::Config::CachePolicy;
+    switch (policy) {
+        case CachePolicy::RANDOM: return cachepolicy::random;
+        case CachePolicy::FIFO:   return cachepolicy::fifo;
+        case CachePolicy::LRU:    return cachepolicy::lru;
+        case CachePolicy::LRU2:   return cachepolicy::lru2;
+        case CachePolicy::LFU:    return cachepolicy::lfu;
+        case CachePolicy::LRFU:   return cachepolicy::lrfu;
+        case CachePolicy::CFLRU:  return cachepolicy::cflru;
+    }
+    throw std::invalid_argument("Unknown cache policy");
+}
+
+prefetchertype to_cxl_prefetcher(TrafficGenerator::Config::PrefetcherType type) {
+    using PrefetcherType = TrafficGenerator::Config::PrefetcherType;
+    switch (type) {
+        case PrefetcherType::NONE:        return prefetchertype::no;
+        case PrefetcherType::TAGGED:      return prefetchertype::tagged;
+        case PrefetcherType::BEST_OFFSET: return prefetchertype::bo;
+        case PrefetcherType::LEAP:        return prefetchertype::leap;
+        case PrefetcherType::FEEDBACK:    return prefetchertype::feedback_direct;
+    }
+    throw std::invalid_argument("Unknown prefetcher type");
+}
+
+Flash_Technology_Type to_flash_technology(TrafficGenerator::Config::FlashTechnology tech) {
+    using FlashTechnology = TrafficGenerator::Config::FlashTechnology;
+    switch (tech) {
+        case FlashTechnology::SLC: return Flash_Technology_Type::SLC;
+        case FlashTechnology::MLC: return Flash_Technology_Type::MLC;
+        case FlashTechnology::TLC: return Flash_Technology_Type::TLC;
+    }
+    throw std::invalid_argument("Unknown flash technology");
+}
+
+SSD_Components::GC_Block_Selection_Policy_Type to_gc_policy(TrafficGenerator::Config::GCPolicy policy) {
+    using GCPolicy = TrafficGenerator::Config::GCPolicy;
+    switch (policy) {
+        case GCPolicy::GREEDY: return SSD_Components::GC_Block_Selection_Policy_Type::GREEDY;
+        case GCPolicy::RGA:    return SSD_Components::GC_Block_Selection_Policy_Type::RGA;
+        case GCPolicy::RANDOM: return SSD_Components::GC_Block_Selection_Policy_Type::RANDOM;
+        case GCPolicy::FIFO:   return SSD_Components::GC_Block_Selection_Policy_Type::FIFO;
+    }
+    throw std::invalid_argument("Unknown GC policy");
+}
+
+// MQSim reports its construction steps on std::cout; keep them out of the embedding program unless asked
+class Console_silencer {
+public:
+    explicit Console_silencer(bool silence) : saved_(nullptr) {
+        if (silence) {
+            saved_ = std::cout.rdbuf(sink_.rdbuf());
+        }
+    }
+    ~Console_silencer() {
+        if (saved_ != nullptr) {
+            std::cout.rdbuf(saved_);
+        }
+    }
+private:
+    std::ostringstream sink_;
+    std::streambuf* saved_;
+};
+
+}  // namespace
+
+//==============================================================================
+// Impl
+//==============================================================================
+
+TrafficGenerator::Impl::Impl(const Config& config) : config_(config) {
+    if (active_instance_ != nullptr) {
+        throw std::logic_error("Only one CXL::TrafficGenerator can exist at a time: the MQSim engine is a process-wide singleton");
+    }
+    if (config.num_channels == 0 || config.chips_per_channel == 0 || config.dies_per_chip == 0 || config.planes_per_die == 0
+        || config.blocks_per_plane == 0 || config.pages_per_block == 0 || config.page_size_bytes < CXL_ACCESS_GRANULARITY) {
+        throw std::invalid_argument("Invalid flash geometry in TrafficGenerator::Config");
+    }
+    if (config.dram_size < CXL_ACCESS_GRANULARITY * config.set_associativity || config.set_associativity == 0) {
+        throw std::invalid_argument("The DRAM cache should hold at least one set of 4 KB lines");
+    }
+
+    Console_silencer silencer(!config.verbose);
+
+    Simulator->Reset();
+
+    // The device configuration is static in MQSim, as if it was read from ssdconfig.xml
+    Device_Parameter_Set::Enabled_Preconditioning = false;
+    Device_Parameter_Set::Memory_Type = NVM::NVM_Type::FLASH;
+    Device_Parameter_Set::HostInterface_Type = HostInterface_Types::NVME;
+    Device_Parameter_Set::Flash_Channel_Count = config.num_channels;
+    Device_Parameter_Set::Chip_No_Per_Channel = config.chips_per_channel;
+    Device_Parameter_Set::Overprovisioning_Ratio = config.overprovisioning_ratio;
+    Device_Parameter_Set::GC_Exec_Threshold = config.gc_threshold;
+    Device_Parameter_Set::GC_Block_Selection_Policy = to_gc_policy(config.gc_policy);
+    Device_Parameter_Set::Data_Cache_DRAM_tRCD = config.dram_tRCD_ns;
+    Device_Parameter_Set::Data_Cache_DRAM_tCL = config.dram_tCL_ns;
+    Device_Parameter_Set::Data_Cache_DRAM_tRP = config.dram_tRP_ns;
+
+    Flash_Parameter_Set& flash = Device_Parameter_Set::Flash_Parameters;
+    flash.Flash_Technology = to_flash_technology(config.flash_tech);
+    flash.Die_No_Per_Chip = config.dies_per_chip;
+    flash.Plane_No_Per_Die = config.planes_per_die;
+    flash.Block_No_Per_Plane = config.blocks_per_plane;
+    flash.Page_No_Per_Block = config.pages_per_block;
+    flash.Page_Capacity = config.page_size_bytes;
+    flash.Page_Read_Latency_LSB = flash.Page_Read_Latency_CSB = flash.Page_Read_Latency_MSB = config.page_read_latency_ns;
+    flash.Page_Program_Latency_LSB = flash.Page_Program_Latency_CSB = flash.Page_Program_Latency_MSB = config.page_program_latency_ns;
+    flash.Block_Erase_Latency = config.block_erase_latency_ns;
+
+    // One flow that owns the whole device, as a single trace-based flow in workload.xml would
+    for (uint32_t i = 0; i < config.num_channels; i++) channel_ids_.push_back((flash_channel_ID_type)i);
+    for (uint32_t i = 0; i < config.chips_per_channel; i++) chip_ids_.push_back((flash_chip_ID_type)i);
+    for (uint32_t i = 0; i < config.dies_per_chip; i++) die_ids_.push_back((flash_die_ID_type)i);
+    for (uint32_t i = 0; i < config.planes_per_die; i++) plane_ids_.push_back((flash_plane_ID_type)i);
+    flow_parameters_.Device_Level_Data_Caching_Mode = SSD_Components::Caching_Mode::TURNED_OFF;
+    flow_parameters_.Priority_Class = IO_Flow_Priority_Class::HIGH;
+    flow_parameters_.Channel_No = (int)channel_ids_.size();
+    flow_parameters_.Channel_IDs = channel_ids_.data();
+    flow_parameters_.Chip_No = (int)chip_ids_.size();
+    flow_parameters_.Chip_IDs = chip_ids_.data();
+    flow_parameters_.Die_No = (int)die_ids_.size();
+    flow_parameters_.Die_IDs = die_ids_.data();
+    flow_parameters_.Plane_No = (int)plane_ids_.size();
+    flow_parameters_.Plane_IDs = plane_ids_.data();
+    flow_parameters_.Initial_Occupancy_Percentage = 0;
+    flow_parameters_.Relief_Type = 0;
+    flows_.push_back(&flow_parameters_);
+
+    // The CXL manager copies this instead of reading config.txt
+    cxl_parameters_.dram_size = config.dram_size;
+    cxl_parameters_.cache_portion_size = config.dram_size;
+    cxl_parameters_.prefetch_portion_size = 0;
+    cxl_parameters_.mix_mode = config.mix_mode;
+    cxl_parameters_.cpolicy = to_cxl_cache_policy(config.cache_policy);
+    cxl_parameters_.set_associativity = config.set_associativity;
+    cxl_parameters_.prefetch_policy = to_cxl_prefetcher(config.prefetcher);
+    cxl_parameters_.has_mshr = config.has_mshr;
+    cxl_parameters_.has_cache = true;
+    cxl_parameters_.total_number_of_requets = UINT64_MAX;  // There is no end of trace to report at
+    cxl_config::preset = &cxl_parameters_;
+    try {
+        ssd_.reset(new SSD_Device(&device_parameters_, &flows_));
+    } catch (...) {
+        cxl_config::preset = NULL;
+        throw;
+    }
+    cxl_config::preset = NULL;
+
+    host_interface_ = static_cast<SSD_Components::Host_Interface_CXL*>(ssd_->Host_interface);
+    port_.reset(new Port(this));
+    Simulator->AddObject(port_.get());
+    pcie_switch_.reset(new Host_Components::PCIe_Switch(NULL, host_interface_));
+    pcie_switch_->cxl_pcie = port_.get();
+    port_->Set_pcie_switch(pcie_switch_.get());
+    ssd_->Attach_to_host(pcie_switch_.get());
+
+    host_interface_->Create_new_stream(IO_Flow_Priority_Class::HIGH,
+        Utils::Logical_Address_Partitioning_Unit::Start_lha_available_to_flow(0),
+        Utils::Logical_Address_Partitioning_Unit::End_lha_available_to_flow(0),
+        SUBMISSION_QUEUE_MEMORY_0, COMPLETION_QUEUE_MEMORY_0);
+    host_interface_->cxl_dram->Connect_to_access_serviced_signal(handle_access_serviced);
+
+    active_instance_ = this;
+    Simulator->Prepare_simulation();
+    baseline_ = read_device_counters();
+}
+
+TrafficGenerator::Impl::~Impl() {
+    Console_silencer silencer(!config_.verbose);
+    Simulator->Reset();
+    active_instance_ = nullptr;
+}
+
+TrafficGenerator::RequestID TrafficGenerator::Impl::submit(Address address, uint32_t size, bool is_read, CompletionCallback callback) {
+    RequestID id = next_request_id_++;
+    uint64_t first_line = address / CXL_ACCESS_GRANULARITY;
+    uint64_t last_line = (address + (size == 0 ? 1 : size) - 1) / CXL_ACCESS_GRANULARITY;
+
+    Request& request = requests_[id];
+    request.submit_time = Simulator->Time();
+    request.outstanding_accesses = (uint32_t)(last_line - first_line + 1);
+    request.callback = std::move(callback);
+    submitted_requests_++;
+
+    for (uint64_t line = first_line; line <= last_line; line++) {
+        admission_queue_.push_back(Access{ id, line == first_line ? address : line * CXL_ACCESS_GRANULARITY, is_read });
+    }
+    port_->Schedule_admission();
+
+    return id;
+}
+
+void TrafficGenerator::Impl::Port::Schedule_admission() {
+    if (!admission_scheduled_) {
+        admission_scheduled_ = true;
+        Simulator->Register_sim_event(Simulator->Time(), this, NULL, 0);
+    }
+}
+
+void TrafficGenerator::Impl::Port::Execute_simulator_event(MQSimEngine::Sim_Event*) {
+    admission_scheduled_ = false;
+    // Admit until the device stalls; the rest waits for Resume_skipped_requests
+    while (!owner_->admission_queue_.empty() && !device_stalled()) {
+        owner_->admit_next_access();
+    }
+}
+
+void TrafficGenerator::Impl::Port::Resume_skipped_requests() {
+    if (!owner_->admission_queue_.empty() && !device_stalled()) {
+        Schedule_admission();
+    }
+}
+
+void TrafficGenerator::Impl::admit_next_access() {
+    Access access = admission_queue_.front();
+    admission_queue_.pop_front();
+
+    Host_Components::CXL_Mem_Transaction transaction;
+    transaction.Opcode = access.is_read ? Host_Components::CXL_Mem_Opcode::MEM_RD : Host_Components::CXL_Mem_Opcode::MEM_WR;
+    transaction.Tag = (uint16_t)access.request;
+    transaction.Stream_id = 0;
+    transaction.Address = access.address;
+    transaction.Issue_time = Simulator->Time();
+
+    uint64_t lba = pcie_switch_->Deliver_to_device(transaction);
+    in_flight_[lba].push_back(In_flight_access{ Simulator->Time(), access.request });
+}
+
+void TrafficGenerator::Impl::handle_access_serviced(uint64_t lba, sim_time_type initiate_time) {
+    active_instance_->complete_access(lba, initiate_time);
+}
+
+void TrafficGenerator::Impl::complete_access(uint64_t lba, sim_time_type initiate_time) {
+    auto accesses = in_flight_.find(lba);
+    if (accesses == in_flight_.end()) {
+        return;
+    }
+
+    // Accesses to one line usually complete in admission order, but a hit can overtake an older access that
+    // waits in the MSHR, so match on the admission time
+    std::deque<In_flight_access>& queue = accesses->second;
+    auto access = queue.begin();
+    while (access != queue.end() && access->initiate_time != initiate_time) {
+        access++;
+    }
+    if (access == queue.end()) {
+        return;
+    }
+    RequestID id = access->request;
+    queue.erase(access);
+    if (queue.empty()) {
+        in_flight_.erase(accesses);
+    }
+
+    auto request = requests_.find(id);
+    if (--request->second.outstanding_accesses > 0) {
+        return;
+    }
+
+    uint64_t latency = Simulator->Time() - request->second.submit_time;
+    completed_requests_++;
+    total_latency_ns_ += latency;
+    if (latency < min_latency_ns_) min_latency_ns_ = latency;
+    if (latency > max_latency_ns_) max_latency_ns_ = latency;
+
+    CompletionCallback callback = std::move(request->second.callback);
+    requests_.erase(request);
+    if (callback) {
+        callback(id, latency);
+    }
+}
+
+void TrafficGenerator::Impl::run_until(uint64_t time_ns) {
+    if (time_ns > Simulator->Time()) {
+        Simulator->Run_until(time_ns);
+    }
+}
+
+bool TrafficGenerator::Impl::run_until_complete(uint64_t max_time_ns) {
+    sim_time_type deadline = (max_time_ns == 0) ? MAXIMUM_TIME : Simulator->Time() + max_time_ns;
+
+    while (!requests_.empty()) {
+        if (!Simulator->Has_pending_events()) {
+            return false;  // Nothing left that could complete the outstanding requests
+        }
+        sim_time_type next_event_time = Simulator->Next_event_time();
+        if (next_event_time > deadline) {
+            Simulator->Run_until(deadline);
+            return false;
+        }
+        Simulator->Run_until(next_event_time);
+    }
+
+    return true;
+}
+
+TrafficGenerator::Impl::Device_counters TrafficGenerator::Impl::read_device_counters() const {
+    const SSD_Components::CXL_Manager* manager = host_interface_->cxl_man;
+    Device_counters counters;
+    counters.cache_hits = manager->cache_hit_count;
+    counters.cache_misses = manager->cache_miss_count;
+    counters.prefetch_issued = manager->prefetch_issue_count;
+    counters.prefetch_hits = manager->prefetch_hit_count;
+    counters.prefetch_pollution = manager->prefetch_pollution_count;
+    counters.flash_reads = manager->flash_read_count;
+    counters.flash_writes = manager->flush_count + manager->no_cache_flash_write_count;
+    counters.flash_erases = SSD_Components::Stats::Erase_count;
+    counters.gc_executions = SSD_Components::Stats::GC_count;
+    return counters;
+}
+
+TrafficGenerator::Statistics TrafficGenerator::Impl::get_statistics() const {
+    Device_counters now = read_device_counters();
+    Statistics stats;
+
+    stats.total_requests = submitted_requests_;
+    stats.cache_hits = now.cache_hits - baseline_.cache_hits;
+    stats.cache_misses = now.cache_misses - baseline_.cache_misses;
+    if (stats.cache_hits + stats.cache_misses > 0) {
+        stats.hit_rate = (double)stats.cache_hits / (stats.cache_hits + stats.cache_misses);
+    }
+
+    stats.prefetch_issued = now.prefetch_issued - baseline_.prefetch_issued;
+    stats.prefetch_hits = now.prefetch_hits - baseline_.prefetch_hits;
+    stats.prefetch_pollution = now.prefetch_pollution - baseline_.prefetch_pollution;
+    if (stats.prefetch_issued > 0) {
+        stats.prefetch_accuracy = (double)stats.prefetch_hits / stats.prefetch_issued;
+    }
+    if (stats.prefetch_hits + stats.cache_misses > 0) {
+        stats.prefetch_coverage = (double)stats.prefetch_hits / (stats.prefetch_hits + stats.cache_misses);
+    }
+
+    stats.flash_reads = now.flash_reads - baseline_.flash_reads;
+    stats.flash_writes = now.flash_writes - baseline_.flash_writes;
+    stats.flash_erases = now.flash_erases - baseline_.flash_erases;
+    stats.gc_executions = now.gc_executions - baseline_.gc_executions;
+
+    stats.min_latency_ns = min_latency_ns_;
+    stats.max_latency_ns = max_latency_ns_;
+    stats.total_latency_ns = total_latency_ns_;
+    if (completed_requests_ > 0) {
+        stats.avg_latency_ns = (double)total_latency_ns_ / completed_requests_;
+    }
+    stats.current_time_ns = Simulator->Time();
+
+    return stats;
+}
+
+void TrafficGenerator::Impl::reset_statistics() {
+    baseline_ = read_device_counters();
+    submitted_requests_ = 0;
+    completed_requests_ = 0;
+    min_latency_ns_ = UINT64_MAX;
+    max_latency_ns_ = 0;
+    total_latency_ns_ = 0;
+}
+
+//==============================================================================
+// TrafficGenerator
+//==============================================================================
+
+TrafficGenerator::TrafficGenerator(const Config& config) : pimpl_(new Impl(config)) {}
+
+TrafficGenerator::~TrafficGenerator() = default;
+
+TrafficGenerator::RequestID TrafficGenerator::submit_read(Address address, uint32_t size, CompletionCallback callback) {
+    return pimpl_->submit(address, size, true, std::move(callback));
+}
+
+TrafficGenerator::RequestID TrafficGenerator::submit_write(Address address, uint32_t size, const void* data, CompletionCallback callback) {
+    (void)data;  // The device model tracks timing and state, not contents
+    return pimpl_->submit(address, size, false, std::move(callback));
+}
+
+void TrafficGenerator::tick(uint64_t time_ns) {
+    pimpl_->run_until(time_ns);
+}
+
+void TrafficGenerator::run_until(uint64_t target_time_ns) {
+    pimpl_->run_until(target_time_ns);
+}
+
+bool TrafficGenerator::run_until_complete(uint64_t max_time_ns) {
+    return pimpl_->run_until_complete(max_time_ns);
+}
+
+bool TrafficGenerator::has_pending_requests() const {
+    return pimpl_->has_pending_requests();
+}
+
+uint64_t TrafficGenerator::get_current_time_ns() const {
+    return Simulator->Time();
+}
+
+TrafficGenerator::Statistics TrafficGenerator::get_statistics() const {
+    return pimpl_->get_statistics();
+}
+
+void TrafficGenerator::reset_statistics() {
+    pimpl_->reset_statistics();
+}
+
+void TrafficGenerator::print_statistics() const {
+    Statistics stats = pimpl_->get_statistics();
+
+    std::cout << "Simulation time:        " << stats.current_time_ns << " ns\n";
+    std::cout << "Requests:               " << stats.total_requests << "\n";
+    std::cout << "Cache hits / misses:    " << stats.cache_hits << " / " << stats.cache_misses
+              << " (hit rate " << stats.hit_rate * 100.0 << "%)\n";
+    std::cout << "Prefetches issued:      " << stats.prefetch_issued << " (hits " << stats.prefetch_hits
+              << ", pollution " << stats.prefetch_pollution << ", accuracy " << stats.prefetch_accuracy * 100.0
+              << "%, coverage " << stats.prefetch_coverage * 100.0 << "%)\n";
+    std::cout << "Flash reads / writes:   " << stats.flash_reads << " / " << stats.flash_writes << "\n";
+    std::cout << "Flash erases / GC runs: " << stats.flash_erases << " / " << stats.gc_executions << "\n";
+    if (stats.max_latency_ns > 0) {
+        std::cout << "Latency min/avg/max:    " << stats.min_latency_ns << " / " << stats.avg_latency_ns
+                  << " / " << stats.max_latency_ns << " ns\n";
+    }
+}
+
+//==============================================================================
+// Helper Functions
+//==============================================================================
+
+const char* to_string(TrafficGenerator::Config::CachePolicy policy) {
+    switch (policy) {
+        case TrafficGenerator::Config::CachePolicy::RANDOM: return "Random";
+        case TrafficGenerator::Config::CachePolicy::FIFO:   return "FIFO";
+        case TrafficGenerator::Config::CachePolicy::LRU:    return "LRU";
+        case TrafficGenerator::Config::CachePolicy::LRU2:   return "LRU2";
+        case TrafficGenerator::Config::CachePolicy::LFU:    return "LFU";
+        case TrafficGenerator::Config::CachePolicy::LRFU:   return "LRFU";
+        case TrafficGenerator::Config::CachePolicy::CFLRU:  return "CFLRU";
+    }
+    return "Unknown";
+}
+
+const char* to_string(TrafficGenerator::Config::PrefetcherType type) {
+    switch (type) {
+        case TrafficGenerator::Config::PrefetcherType::NONE:        return "None";
+        case TrafficGenerator::Config::PrefetcherType::TAGGED:      return "Tagged";
+        case TrafficGenerator::Config::PrefetcherType::BEST_OFFSET: return "Best-offset";
+        case TrafficGenerator::Config::PrefetcherType::LEAP:        return "Leap";
+        case TrafficGenerator::Config::PrefetcherType::FEEDBACK:    return "Feedback_direct";
+    }
+    return "Unknown";
+}
+
+const char* to_string(TrafficGenerator::Config::FlashTechnology tech) {
+    switch (tech) {
+        case TrafficGenerator::Config::FlashTechnology::SLC: return "SLC";
+        case TrafficGenerator::Config::FlashTechnology::MLC: return "MLC";
+        case TrafficGenerator::Config::FlashTechnology::TLC: return "TLC";
+    }
+    return "Unknown";
+}
+
+const char* to_string(TrafficGenerator::Config::GCPolicy policy) {
+    switch (policy) {
+        case TrafficGenerator::Config::GCPolicy::GREEDY: return "Greedy";
+        case TrafficGenerator::Config::GCPolicy::RGA:    return "RGA";
+        case TrafficGenerator::Config::GCPolicy::RANDOM: return "Random";
+        case TrafficGenerator::Config::GCPolicy::FIFO:   return "FIFO";
+    }
+    return "Unknown";
+}
+
+} // namespace CXL
@@ -1,7 +1,7 @@
 #pragma once
 #include <iostream>
 #include <cstdint>
-#include <map>
+#include <unordered_map>
 
 using namespace std;
 
@@ -25,7 +25,7 @@ private:
 	uint64_t window{ 0 };
 	LRUNode* head{ NULL };
 	LRUNode* tail{ NULL };
-	map<uint64_t, LRUNode*> m;
+	unordered_map<uint64_t, LRUNode*> m;
 
 
 
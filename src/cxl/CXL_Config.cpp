@@ -1,6 +1,8 @@
 #include"CXL_Config.h"
 #include <cstdint>
+#include <sstream>
 
+const cxl_config* cxl_config::preset{ NULL };
 
 
 void cxl_config::readConfigFile() {
@@ -139,6 +141,82 @@ void cxl_config::readConfigFile() {
 
 			total_number_of_requets = value;
 		}
+		else if (info == "Link_model") {
+			uint64_t value;
+			configfile >> dec >> value;
+			link_model = static_cast<bool>(value);
+		}
+		else if (info == "Link_lanes") {
+			configfile >> dec >> link_lanes;
+		}
+		else if (info == "Link_speed") {
+			configfile >> link_speed_gtps;
+		}
+		else if (info == "Link_latency") {
+			configfile >> dec >> link_latency;
+		}
+		else if (info == "Link_credits") {
+			configfile >> dec >> link_credits[0] >> link_credits[1] >> link_credits[2] >> link_credits[3];
+		}
+		else if (info == "Flit_retry") {
+			configfile >> flit_error_rate >> flit_retry_latency;
+		}
+		else if (info == "Host_weights") {
+			string values;
+			getline(configfile, values);
+			istringstream line{ values };
+			double weight;
+			while (line >> weight) {
+				host_weights.push_back(weight);
+			}
+		}
+		else if (info == "Host_cache_shares") {
+			string values;
+			getline(configfile, values);
+			istringstream line{ values };
+			uint64_t share;
+			while (line >> dec >> share) {
+				host_cache_shares.push_back(share);
+			}
+		}
+		else if (info == "Prefetch_sampling") {
+			configfile >> dec >> prefetch_sampled_sets >> prefetch_sampled_ways >> prefetch_sampling_interval;
+		}
+		else if (info == "Accounting_window") {
+			configfile >> dec >> accounting_window;
+		}
+		else if (info == "Epoch_length") {
+			configfile >> dec >> epoch_length;
+		}
+		else if (info == "Phase_controller") {
+			configfile >> dec >> phase_window >> phase_miss_rate_threshold;
+		}
+		else if (info == "Trace_sampling") {
+			configfile >> dec >> sampling_interval >> sampling_clusters;
+		}
+		else if (info == "Warmup_requests") {
+			configfile >> dec >> warmup_requests;
+		}
+		else if (info == "Write_placement") {
+			string values;
+			getline(configfile, values);
+			istringstream line{ values };
+			string ptype;
+			line >> ptype;
+			if (ptype == "No") {
+				write_placement = writeplacement::no;
+			}
+			else if (ptype == "Hotness") {
+				write_placement = writeplacement::hotness;
+				line >> dec >> placement_heat_window;
+			}
+			else if (ptype == "Host") {
+				write_placement = writeplacement::host;
+			}
+		}
+		else if (info == "Stream_striping") {
+			configfile >> stream_striping;
+		}
 
 	}
 	configfile.close();
@@ -2,6 +2,7 @@
 #include<iostream>
 #include<fstream>
 #include<cstdint>
+#include<vector>
 
 using namespace std;
 
@@ -26,6 +27,12 @@ typedef enum class prefetchertype {
 	feedback_direct
 }prefetchertype;
 
+typedef enum class writeplacement {
+	no,
+	hotness,//By the write frequency of the flushed lines
+	host//By the host that owns the flushed lines
+}writeplacement;
+
 
 class cxl_config {
 public:
@@ -47,6 +54,43 @@ public:
 	bool dram_mode{ 0 };
 	uint64_t num_sec{ 8 };
 
+	//Flit-level CXL link model (off by default, the host then delivers requests straight to the device)
+	bool link_model{ 0 };
+	uint64_t link_lanes{ 16 };
+	double link_speed_gtps{ 32 };
+	uint64_t link_latency{ 25 };//One-way propagation and PHY/link layer latency in ns
+	uint64_t link_credits[4]{ 32, 32, 32, 32 };//Req, RwD, NDR, DRS
+	double flit_error_rate{ 0 };
+	uint64_t flit_retry_latency{ 100 };
+
+	//Hosts that share the device, one per IO flow
+	vector<double> host_weights;//Shares of the device admission bandwidth (1 for a host that is not listed)
+	vector<uint64_t> host_cache_shares;//Percentages of the DRAM cache sets reserved for each host, the cache is shared if empty
+
+	//Fixed-memory prefetch accounting
+	uint64_t prefetch_sampled_sets{ 1024 };
+	uint64_t prefetch_sampled_ways{ 16 };
+	uint64_t prefetch_sampling_interval{ 4 };//One in this many LBAs is tracked by the shadow tags
+	uint64_t accounting_window{ 16384 };
+
+	uint64_t epoch_length{ 0 };//Length of the epochs of the time-series metrics in ns, 0 disables them
+
+	//Runtime phase detection and prefetcher reconfiguration
+	uint64_t phase_window{ 0 };//Demand accesses per window, 0 disables the controller
+	double phase_miss_rate_threshold{ 0.15 };
+
+	//SimPoint-style sampling of the trace flows
+	uint64_t sampling_interval{ 0 };//Trace records per interval, 0 disables sampling
+	uint64_t sampling_clusters{ 8 };
+
+	uint64_t warmup_requests{ 0 };//Leading records of each trace flow that warm up the cache and the prefetcher in functional mode
+
+	//Placement IDs of the dirty lines that are flushed to flash
+	writeplacement write_placement{ writeplacement::no };
+	uint64_t placement_heat_window{ 0 };//The heat of a line halves every this many flushes, 0 for the number of lines of the cache
+
+	string stream_striping{ "No" };//Order in which consecutive lines are striped over the channels (C), chips (W), dies (D) and planes (P), e.g. CWDP
+
 	cxl_config() {
 		dram_size = 0; 
 		cache_portion_size = 0;
@@ -65,5 +109,7 @@ public:
 
 	void readConfigFile();
 
+	static const cxl_config* preset;//Programs that embed the device model set it to bypass config.txt
+
 };
 
@@ -0,0 +1,80 @@
+#include "../sim/Engine.h"
+#include "../ssd/Stats.h"
+#include "CXL_Epoch_Sampler.h"
+#include "Host_Interface_CXL.h"
+
+namespace SSD_Components {
+
+	cxl_epoch_sampler::cxl_epoch_sampler(CXL_Manager* cxl_man, CXL_DRAM_Model* cxl_dram, sim_time_type epoch_length)
+		: cxl_man(cxl_man), cxl_dram(cxl_dram), epoch_length(epoch_length), of_epoch("./Results/epoch_metrics.csv") {
+		of_epoch << "epoch_end_us,accesses,hit_rate,prefetch_fills,prefetch_hits,prefetch_accuracy,avg_latency_ns,bandwidth_GBps,"
+			<< "mshr_occupancy,dram_queue_depth,flash_queue_depth,prefetch_in_flight,gc_executions,gc_page_movements" << endl;
+		start_epoch(0);
+	}
+
+	void cxl_epoch_sampler::start_epoch(sim_time_type start) {
+		epoch_start = start;
+		serviced_count = 0;
+		latency_sum = 0;
+		mshr_occupancy_sum = 0;
+		dram_queue_depth_sum = 0;
+		flash_queue_depth_sum = 0;
+		prefetch_in_flight_sum = 0;
+
+		cache_hit_base = cxl_man->cache_hit_count;
+		cache_miss_base = cxl_man->cache_miss_count;
+		prefetch_fill_base = cxl_dram->prefetch_amount;
+		prefetch_hit_base = cxl_man->prefetch_hit_count;
+		sampled_fill_base = cxl_man->accounting->sampled_fills();
+		sampled_use_base = cxl_man->accounting->sampled_uses();
+		gc_execution_base = Stats::Total_gc_executions;
+		gc_page_movement_base = Stats::Total_page_movements_for_gc;
+	}
+
+	void cxl_epoch_sampler::write_epoch(sim_time_type end) {
+		uint64_t hits{ cxl_man->cache_hit_count - cache_hit_base };
+		uint64_t misses{ cxl_man->cache_miss_count - cache_miss_base };
+		uint64_t sampled_fills{ cxl_man->accounting->sampled_fills() - sampled_fill_base };
+		uint64_t sampled_uses{ cxl_man->accounting->sampled_uses() - sampled_use_base };
+		double n{ static_cast<double>(serviced_count) };
+
+		of_epoch << end / 1000 << "," << serviced_count << ","
+			<< (hits + misses == 0 ? 0 : static_cast<double>(hits) / (hits + misses)) << ","
+			<< cxl_dram->prefetch_amount - prefetch_fill_base << "," << cxl_man->prefetch_hit_count - prefetch_hit_base << ","
+			<< (sampled_fills == 0 ? 0 : static_cast<double>(sampled_uses) / sampled_fills) << ","
+			<< latency_sum / serviced_count << ","
+			<< (end == epoch_start ? 0 : n * 64 / (end - epoch_start)) << ","//64B cache lines, bytes per ns = GB/s
+			<< mshr_occupancy_sum / n << "," << dram_queue_depth_sum / n << "," << flash_queue_depth_sum / n << "," << prefetch_in_flight_sum / n << ","
+			<< Stats::Total_gc_executions - gc_execution_base << "," << Stats::Total_page_movements_for_gc - gc_page_movement_base << endl;
+	}
+
+	void cxl_epoch_sampler::access_serviced(sim_time_type latency) {
+		if (finished) {
+			return;
+		}
+		if (Simulator->Time() >= epoch_start + epoch_length) {
+			if (serviced_count > 0) {
+				write_epoch(epoch_start + epoch_length);
+			}
+			start_epoch(Simulator->Time() / epoch_length * epoch_length);
+		}
+
+		serviced_count++;
+		latency_sum += latency;
+		mshr_occupancy_sum += cxl_man->mshr->getOccupancy();
+		dram_queue_depth_sum += cxl_dram->getQueueDepth();
+		flash_queue_depth_sum += cxl_man->flash_back_end_access_count;
+		prefetch_in_flight_sum += cxl_man->in_progress_prefetch_lba->size();
+	}
+
+	void cxl_epoch_sampler::finish() {
+		if (finished) {
+			return;
+		}
+		finished = 1;
+		if (serviced_count > 0) {
+			write_epoch(Simulator->Time());
+		}
+		of_epoch.close();
+	}
+}
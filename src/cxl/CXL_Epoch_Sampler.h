@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include "../sim/Sim_Defs.h"
+
+using namespace std;
+
+namespace SSD_Components {
+
+	class CXL_Manager;
+	class CXL_DRAM_Model;
+
+	/*
+	* Records the behavior of the CXL device as a time series with one CSV row per epoch of simulated time.
+	* Rows are written when the first access of a later epoch is serviced, so the sampler adds no events to the simulation;
+	* epochs in which no access is serviced are skipped. The queue depths are averaged over the accesses serviced in the epoch.
+	*/
+	class cxl_epoch_sampler {
+	public:
+		cxl_epoch_sampler(CXL_Manager* cxl_man, CXL_DRAM_Model* cxl_dram, sim_time_type epoch_length);
+
+		void access_serviced(sim_time_type latency);
+		void finish();//Writes the last, partial epoch
+
+	private:
+		CXL_Manager* cxl_man;
+		CXL_DRAM_Model* cxl_dram;
+		sim_time_type epoch_length;
+		sim_time_type epoch_start{ 0 };
+		ofstream of_epoch;
+		bool finished{ 0 };
+
+		uint64_t serviced_count{ 0 };
+		sim_time_type latency_sum{ 0 };
+		uint64_t mshr_occupancy_sum{ 0 }, dram_queue_depth_sum{ 0 }, flash_queue_depth_sum{ 0 }, prefetch_in_flight_sum{ 0 };
+
+		//The cumulative counters at the start of the epoch
+		uint64_t cache_hit_base{ 0 }, cache_miss_base{ 0 }, prefetch_fill_base{ 0 }, prefetch_hit_base{ 0 };
+		uint64_t sampled_fill_base{ 0 }, sampled_use_base{ 0 };
+		uint64_t gc_execution_base{ 0 }, gc_page_movement_base{ 0 };
+
+		void start_epoch(sim_time_type start);
+		void write_epoch(sim_time_type end);
+	};
+}
@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <cmath>
+#include "../sim/Engine.h"
+#include "../host/PCIe_Switch.h"
+#include "CXL_Link.h"
+#include "CXL_PCIe.h"
+#include "OutputLog.h"
+
+#define FLIT_SIZE_IN_BYTES 256
+#define SLOTS_PER_FLIT 15//The remaining 16B of a 256B flit hold the flit header and the CRC
+#define HEADER_SLOTS 1
+#define DATA_SLOTS 4//A 64B cache line
+#define CXL_LINK_RANDOM_SEED 2027
+
+namespace Host_Components
+{
+	CXL_Link* CXL_Link::instance = NULL;
+
+	CXL_Link::CXL_Link(const sim_object_id_type& id, const cxl_config& config, CXL_PCIe* cxl_pcie, PCIe_Switch* pcie_switch) :
+		Sim_Object(id), cxl_pcie(cxl_pcie), pcie_switch(pcie_switch),
+		lane_count((unsigned int)config.link_lanes), lane_speed_GTps(config.link_speed_gtps), link_latency(config.link_latency),
+		flit_error_rate(config.flit_error_rate), flit_retry_latency(config.flit_retry_latency), random_generator(NULL),
+		total_number_of_requests(config.total_number_of_requets), ingress_event_registered(false),
+		completed_access_count(0), loaded_latency_sum(0), loaded_latency_max(0), results_printed(false)
+	{
+		if (lane_count == 0 || lane_speed_GTps <= 0) {
+			PRINT_ERROR("CXL link: the lane count and the lane speed should be greater than zero!")
+		}
+		if (flit_error_rate < 0 || flit_error_rate >= 1) {
+			PRINT_ERROR("CXL link: the flit error rate should be in [0, 1)!")
+		}
+		flit_transfer_time = (sim_time_type)std::ceil(FLIT_SIZE_IN_BYTES * 8 / (lane_count * lane_speed_GTps));
+		for (int message_class = 0; message_class < CXL_MESSAGE_CLASS_COUNT; message_class++) {
+			if (config.link_credits[message_class] == 0) {
+				PRINT_ERROR("CXL link: each message class needs at least one credit!")
+			}
+			credits[message_class] = (unsigned int)config.link_credits[message_class];
+			credit_stall_count[message_class] = 0;
+		}
+		for (int direction = 0; direction < 2; direction++) {
+			transmitter_busy[direction] = false;
+			flit_count[direction] = 0;
+			used_slot_count[direction] = 0;
+			retried_flit_count[direction] = 0;
+		}
+		if (flit_error_rate > 0) {
+			random_generator = new Utils::RandomGenerator(CXL_LINK_RANDOM_SEED);
+		}
+		instance = this;
+	}
+
+	CXL_Link::~CXL_Link()
+	{
+		delete random_generator;
+		if (instance == this) {
+			instance = NULL;
+		}
+	}
+
+	void CXL_Link::Start_simulation() {}
+
+	void CXL_Link::Validate_simulation_config() {}
+
+	bool CXL_Link::Has_request_credit(CXL_Mem_Opcode opcode)
+	{
+		CXL_Message_Class message_class = (opcode == CXL_Mem_Opcode::MEM_RD) ? CXL_Message_Class::REQ : CXL_Message_Class::RWD;
+		if (credits[(int)message_class] == 0) {
+			credit_stall_count[(int)message_class]++;
+			return false;
+		}
+
+		return true;
+	}
+
+	void CXL_Link::Send_request(const CXL_Mem_Transaction& transaction)
+	{
+		CXL_Link_Message message;
+		message.Transaction = transaction;
+		message.Class = (transaction.Opcode == CXL_Mem_Opcode::MEM_RD) ? CXL_Message_Class::REQ : CXL_Message_Class::RWD;
+		message.Slots_left = HEADER_SLOTS + (message.Class == CXL_Message_Class::RWD ? DATA_SLOTS : 0);
+		message.Host_issue_time = transaction.Issue_time;
+		credits[(int)message.Class]--;
+		enqueue(CXL_Link_Direction::M2S, message);
+	}
+
+	void CXL_Link::enqueue(CXL_Link_Direction direction, const CXL_Link_Message& message)
+	{
+		transmit_queue[(int)direction].push_back(message);
+		if (!transmitter_busy[(int)direction]) {
+			transmit_flit(direction);
+		}
+	}
+
+	//Packs the head of the transmit queue into one flit. The link does not wait to fill a flit, an idle link sends what it has.
+	void CXL_Link::transmit_flit(CXL_Link_Direction direction)
+	{
+		std::deque<CXL_Link_Message>& queue = transmit_queue[(int)direction];
+		CXL_Flit* flit = new CXL_Flit;
+		flit->Direction = direction;
+		unsigned int free_slots = SLOTS_PER_FLIT;
+		while (free_slots > 0 && queue.size() > 0) {
+			unsigned int slots = std::min(free_slots, queue.front().Slots_left);
+			queue.front().Slots_left -= slots;
+			free_slots -= slots;
+			if (queue.front().Slots_left == 0) {
+				flit->Messages.push_back(queue.front());
+				queue.pop_front();
+			}
+		}
+		flit_count[(int)direction]++;
+		used_slot_count[(int)direction] += SLOTS_PER_FLIT - free_slots;
+
+		//A flit with a CRC error is dropped by the receiver and replayed from the retry buffer of the transmitter
+		sim_time_type transfer_time = flit_transfer_time;
+		while (random_generator != NULL && random_generator->FloatRandom() < flit_error_rate) {
+			retried_flit_count[(int)direction]++;
+			transfer_time += flit_retry_latency + flit_transfer_time;
+		}
+
+		transmitter_busy[(int)direction] = true;
+		Simulator->Register_sim_event(Simulator->Time() + transfer_time, this, (void*)(intptr_t)direction, static_cast<int>(CXL_Link_Event_Type::TRANSMIT_DONE));
+		Simulator->Register_sim_event(Simulator->Time() + transfer_time + link_latency, this, flit, static_cast<int>(CXL_Link_Event_Type::FLIT_DELIVERED));
+	}
+
+	void CXL_Link::Execute_simulator_event(MQSimEngine::Sim_Event* event)
+	{
+		switch ((CXL_Link_Event_Type)event->Type) {
+			case CXL_Link_Event_Type::TRANSMIT_DONE:
+			{
+				CXL_Link_Direction direction = (CXL_Link_Direction)(intptr_t)event->Parameters;
+				transmitter_busy[(int)direction] = false;
+				if (transmit_queue[(int)direction].size() > 0) {
+					transmit_flit(direction);
+				}
+				break;
+			}
+			case CXL_Link_Event_Type::FLIT_DELIVERED:
+				consume_flit((CXL_Flit*)event->Parameters);
+				break;
+			case CXL_Link_Event_Type::CREDIT_RETURN:
+				return_credit((CXL_Message_Class)(intptr_t)event->Parameters);
+				break;
+			case CXL_Link_Event_Type::DEVICE_INGRESS:
+				drain_ingress_buffer();
+				break;
+		}
+	}
+
+	void CXL_Link::consume_flit(CXL_Flit* flit)
+	{
+		if (flit->Direction == CXL_Link_Direction::M2S) {
+			for (auto& message : flit->Messages) {
+				device_ingress_buffer.push_back(message);
+			}
+			Device_ready();
+		}
+		else {
+			//The host consumes responses right away and returns the credit with the next flit toward the device
+			for (auto& message : flit->Messages) {
+				sim_time_type latency = Simulator->Time() - message.Host_issue_time;
+				loaded_latency_sum += latency;
+				if (latency > loaded_latency_max) {
+					loaded_latency_max = latency;
+				}
+				completed_access_count++;
+				Simulator->Register_sim_event(Simulator->Time() + link_latency, this, (void*)(intptr_t)message.Class, static_cast<int>(CXL_Link_Event_Type::CREDIT_RETURN));
+				cxl_pcie->Deliver_response(message.Transaction);
+			}
+			if (completed_access_count == total_number_of_requests && !results_printed) {
+				print_statistics();
+			}
+		}
+		delete flit;
+	}
+
+	//The device takes requests from its ingress buffer in a separate event, so a stall that ends inside the CXL manager does not re-enter it
+	void CXL_Link::Device_ready()
+	{
+		if (ingress_event_registered || device_ingress_buffer.size() == 0) {
+			return;
+		}
+		ingress_event_registered = true;
+		Simulator->Register_sim_event(Simulator->Time(), this, NULL, static_cast<int>(CXL_Link_Event_Type::DEVICE_INGRESS));
+	}
+
+	void CXL_Link::drain_ingress_buffer()
+	{
+		ingress_event_registered = false;
+		while (device_ingress_buffer.size() > 0 && !cxl_pcie->device_stalled()) {
+			CXL_Link_Message message = device_ingress_buffer.front();
+			device_ingress_buffer.pop_front();
+			Pending_access access;
+			access.Device_arrival_time = Simulator->Time();
+			access.Host_issue_time = message.Host_issue_time;
+			access.Transaction = message.Transaction;
+			uint64_t lba = pcie_switch->Deliver_to_device(message.Transaction);
+			pending_accesses[lba].push_back(access);
+			Simulator->Register_sim_event(Simulator->Time() + link_latency, this, (void*)(intptr_t)message.Class, static_cast<int>(CXL_Link_Event_Type::CREDIT_RETURN));
+		}
+	}
+
+	void CXL_Link::return_credit(CXL_Message_Class message_class)
+	{
+		credits[(int)message_class]++;
+		switch (message_class) {
+			case CXL_Message_Class::REQ:
+			case CXL_Message_Class::RWD:
+				cxl_pcie->Resume_skipped_requests();
+				break;
+			case CXL_Message_Class::NDR:
+			case CXL_Message_Class::DRS:
+			{
+				std::deque<CXL_Link_Message>& waiting = waiting_responses[(int)message_class - (int)CXL_Message_Class::NDR];
+				if (waiting.size() > 0) {
+					CXL_Link_Message response = waiting.front();
+					waiting.pop_front();
+					credits[(int)message_class]--;
+					enqueue(CXL_Link_Direction::S2M, response);
+				}
+				break;
+			}
+		}
+	}
+
+	void CXL_Link::send_response(const CXL_Link_Message& response)
+	{
+		std::deque<CXL_Link_Message>& waiting = waiting_responses[(int)response.Class - (int)CXL_Message_Class::NDR];
+		if (credits[(int)response.Class] == 0 || waiting.size() > 0) {
+			credit_stall_count[(int)response.Class]++;
+			waiting.push_back(response);
+			return;
+		}
+		credits[(int)response.Class]--;
+		enqueue(CXL_Link_Direction::S2M, response);
+	}
+
+	void CXL_Link::Handle_access_serviced(uint64_t lba, sim_time_type initiate_time)
+	{
+		if (instance != NULL) {
+			instance->complete_access(lba, initiate_time);
+		}
+	}
+
+	void CXL_Link::complete_access(uint64_t lba, sim_time_type initiate_time)
+	{
+		auto accesses = pending_accesses.find(lba);
+		if (accesses == pending_accesses.end()) {
+			return;
+		}
+
+		//A hit can overtake an older access to the same line that waits in the MSHR, so match on the arrival time
+		std::deque<Pending_access>& queue = accesses->second;
+		auto access = queue.begin();
+		while (access != queue.end() && access->Device_arrival_time != initiate_time) {
+			access++;
+		}
+		if (access == queue.end()) {
+			return;
+		}
+
+		CXL_Link_Message response;
+		response.Transaction = access->Transaction;
+		response.Host_issue_time = access->Host_issue_time;
+		if (access->Transaction.Opcode == CXL_Mem_Opcode::MEM_RD) {
+			response.Transaction.Opcode = CXL_Mem_Opcode::MEM_DATA;
+			response.Class = CXL_Message_Class::DRS;
+			response.Slots_left = HEADER_SLOTS + DATA_SLOTS;
+		}
+		else {
+			response.Transaction.Opcode = CXL_Mem_Opcode::CMP;
+			response.Class = CXL_Message_Class::NDR;
+			response.Slots_left = HEADER_SLOTS;
+		}
+		queue.erase(access);
+		if (queue.size() == 0) {
+			pending_accesses.erase(accesses);
+		}
+		send_response(response);
+	}
+
+	void CXL_Link::print_statistics()
+	{
+		results_printed = true;
+		const char* direction_names[2] = { "M2S", "S2M" };
+		const char* class_names[CXL_MESSAGE_CLASS_COUNT] = { "Req", "RwD", "NDR", "DRS" };
+		std::cout << "CXL link: x" << lane_count << " @ " << lane_speed_GTps << " GT/s, flit time " << flit_transfer_time << " ns" << endl;
+		of_overall << "CXL link: x" << lane_count << " @ " << lane_speed_GTps << " GT/s, flit time " << flit_transfer_time << " ns" << endl;
+		for (int direction = 0; direction < 2; direction++) {
+			double slot_utilization = flit_count[direction] == 0 ? 0 : (double)used_slot_count[direction] / (flit_count[direction] * SLOTS_PER_FLIT);
+			std::cout << "CXL link " << direction_names[direction] << " flits: " << flit_count[direction] << "   Slot utilization: " << slot_utilization
+				<< "   CRC retries: " << retried_flit_count[direction] << endl;
+			of_overall << "CXL link " << direction_names[direction] << " flits: " << flit_count[direction] << "   Slot utilization: " << slot_utilization
+				<< "   CRC retries: " << retried_flit_count[direction] << endl;
+		}
+		std::cout << "CXL link credit stalls:";
+		of_overall << "CXL link credit stalls:";
+		for (int message_class = 0; message_class < CXL_MESSAGE_CLASS_COUNT; message_class++) {
+			std::cout << "   " << class_names[message_class] << " " << credit_stall_count[message_class];
+			of_overall << "   " << class_names[message_class] << " " << credit_stall_count[message_class];
+		}
+		std::cout << endl;
+		of_overall << endl;
+		std::cout << "CXL loaded latency (ns): average " << loaded_latency_sum / completed_access_count << "   max " << loaded_latency_max << endl;
+		of_overall << "CXL loaded latency (ns): average " << loaded_latency_sum / completed_access_count << "   max " << loaded_latency_max << endl;
+	}
+}
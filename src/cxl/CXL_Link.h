@@ -0,0 +1,105 @@
+#ifndef CXL_LINK_H
+#define CXL_LINK_H
+
+#include <deque>
+#include <unordered_map>
+#include "../sim/Sim_Defs.h"
+#include "../sim/Sim_Object.h"
+#include "../sim/Sim_Event.h"
+#include "../utils/RandomGenerator.h"
+#include "CXL_Config.h"
+#include "CXL_Mem_Transaction.h"
+
+namespace Host_Components
+{
+	class PCIe_Switch;
+	class CXL_PCIe;
+
+	enum class CXL_Link_Event_Type { TRANSMIT_DONE, FLIT_DELIVERED, CREDIT_RETURN, DEVICE_INGRESS };
+	enum class CXL_Link_Direction { M2S = 0, S2M = 1 };//Host to device, device to host
+
+	//The message classes of CXL.mem that are flow controlled with separate credits
+	enum class CXL_Message_Class { REQ = 0, RWD = 1, NDR = 2, DRS = 3 };
+#define CXL_MESSAGE_CLASS_COUNT 4
+
+	struct CXL_Link_Message
+	{
+		CXL_Mem_Transaction Transaction;
+		CXL_Message_Class Class;
+		unsigned int Slots_left;//Slots that are still to be sent, a message with data may span two flits
+		sim_time_type Host_issue_time;
+	};
+
+	struct CXL_Flit
+	{
+		CXL_Link_Direction Direction;
+		std::deque<CXL_Link_Message> Messages;//The messages whose last slot is carried by this flit
+	};
+
+	/*
+	* A flit-level model of the CXL link between the host and the CXL-SSD. Messages are packed into 256B flits
+	* of 16B slots: a request or a no-data response takes one slot, a message with a 64B cache line takes a
+	* header slot and four data slots. A flit is serialized over the link in 256 * 8 / (lanes * GT/s) ns and
+	* arrives after the propagation latency of the link. A flit that fails its CRC check is replayed.
+	* Each message class has its own credit pool: the transmitter stops sending a class once its credits run out
+	* and gets them back when the receiver frees the buffers. The device side only accepts requests from its
+	* ingress buffer while the CXL manager is not stalled, so back pressure reaches the host through the credits.
+	*/
+	class CXL_Link : public MQSimEngine::Sim_Object
+	{
+	public:
+		CXL_Link(const sim_object_id_type& id, const cxl_config& config, CXL_PCIe* cxl_pcie, PCIe_Switch* pcie_switch);
+		~CXL_Link();
+		void Start_simulation();
+		void Validate_simulation_config();
+		void Execute_simulator_event(MQSimEngine::Sim_Event*);
+
+		bool Has_request_credit(CXL_Mem_Opcode opcode);
+		void Send_request(const CXL_Mem_Transaction& transaction);//Called by the host to send an M2S request
+		void Device_ready();//Called when the device leaves a stall, so that it accepts requests from its ingress buffer again
+		static void Handle_access_serviced(uint64_t lba, sim_time_type initiate_time);
+	private:
+		struct Pending_access
+		{
+			sim_time_type Device_arrival_time;
+			sim_time_type Host_issue_time;
+			CXL_Mem_Transaction Transaction;
+		};
+		static CXL_Link* instance;
+		CXL_PCIe* cxl_pcie;
+		PCIe_Switch* pcie_switch;
+		unsigned int lane_count;
+		double lane_speed_GTps;
+		sim_time_type flit_transfer_time;
+		sim_time_type link_latency;
+		double flit_error_rate;
+		sim_time_type flit_retry_latency;
+		Utils::RandomGenerator* random_generator;
+		const uint64_t& total_number_of_requests;//Of the device configuration, which leaves out the records that trace sampling fast-forwards
+
+		unsigned int credits[CXL_MESSAGE_CLASS_COUNT];
+		std::deque<CXL_Link_Message> transmit_queue[2];
+		bool transmitter_busy[2];
+		std::deque<CXL_Link_Message> device_ingress_buffer;//M2S requests that arrived at the device but are not accepted yet
+		std::deque<CXL_Link_Message> waiting_responses[2];//S2M responses that wait for an NDR or DRS credit
+		std::unordered_map<uint64_t, std::deque<Pending_access>> pending_accesses;//Accesses inside the device, by cache line
+		bool ingress_event_registered;
+
+		uint64_t flit_count[2], used_slot_count[2], retried_flit_count[2];
+		uint64_t credit_stall_count[CXL_MESSAGE_CLASS_COUNT];
+		uint64_t completed_access_count;
+		sim_time_type loaded_latency_sum, loaded_latency_max;
+		bool results_printed;
+
+		void enqueue(CXL_Link_Direction direction, const CXL_Link_Message& message);
+		void transmit_flit(CXL_Link_Direction direction);
+		void consume_flit(CXL_Flit* flit);
+		void drain_ingress_buffer();
+		void return_credit(CXL_Message_Class message_class);
+		void send_response(const CXL_Link_Message& response);
+		void complete_access(uint64_t lba, sim_time_type initiate_time);
+		void print_statistics();
+	};
+}
+
+#endif // !CXL_LINK_H
@@ -8,7 +8,6 @@ cxl_mshr::~cxl_mshr() {
 	if (mshr) {
 		for (auto i : *mshr) {
 			for (auto j : *(i.second)) {
-				//delete j->sqe;
 				delete j;
 			}
 			i.second->clear();
@@ -25,7 +24,7 @@ bool cxl_mshr::isInProgress(uint64_t lba) {
 	return mshr->count(lba);
 }
 
-void cxl_mshr::insertRequest(uint64_t lba, uint64_t time, Submission_Queue_Entry* sqe) {
+void cxl_mshr::insertRequest(uint64_t lba, uint64_t time, bool rw) {
 
 	if (!mshr->count(lba)) {
 		list<mshr_request*>* lp{ new list<mshr_request*> };
@@ -33,7 +32,7 @@ void cxl_mshr::insertRequest(uint64_t lba, uint64_t time, Submission_Queue_Entry
 		row_count++;
 	}
 
-	mshr_request* p{ new mshr_request{time, sqe} };
+	mshr_request* p{ new mshr_request{time, rw} };
 	(*mshr)[lba]->push_back(p);
 
 
@@ -75,16 +74,14 @@ bool cxl_mshr::removeRequest(uint64_t lba, list<uint64_t>& readcount, list<uint6
 	row_count--;
 	
 	for (auto i : *(*mshr)[lba]) {
-		Submission_Queue_Entry* s{ i->sqe };
-
 		//process the data read/write of requests in the mshr
 		if (i == *((*mshr)[lba]->begin())) {
-			rw = (s->Opcode == NVME_READ_OPCODE) ? true : false;
+			rw = i->rw;
 			continue;
 		}
 
 
-		if (s->Opcode == NVME_READ_OPCODE) {
+		if (i->rw) {
 			readcount.push_back(i->time);
 		}
 		else {
@@ -116,7 +113,6 @@ mshr_request* cxl_mshr::removeRequestNew(uint64_t lba, list<uint64_t>& readcount
 
 	if (!serviced_before) {
 		mshr_request* r{ (*mshr)[lba]->front() };
-		Submission_Queue_Entry* s{ r->sqe };
 		(*mshr)[lba]->pop_front();
 		
 		first_entry = r;
@@ -132,10 +128,9 @@ mshr_request* cxl_mshr::removeRequestNew(uint64_t lba, list<uint64_t>& readcount
 		}
 
 		mshr_request* r{ (*mshr)[lba]->front() };
-		Submission_Queue_Entry* s{ r->sqe };
 		(*mshr)[lba]->pop_front();
 
-		if (s->Opcode == NVME_READ_OPCODE) {
+		if (r->rw) {
 			readcount.push_back(r->time);
 		}
 		else {
@@ -5,7 +5,6 @@
 
 #include <list>
 #include <set>
-#include "../ssd/Host_Interface_Defs.h"
 
 using namespace std;
 
@@ -13,17 +12,12 @@ class mshr_request {
 public:
 
 	uint64_t time{0};
-	Submission_Queue_Entry* sqe{NULL};
+	bool rw{ 1 };//true for reads
 
-	mshr_request(uint64_t t, Submission_Queue_Entry* s) {
+	mshr_request(uint64_t t, bool r) {
 		time = t;
-		sqe = s;
+		rw = r;
 	};
-	~mshr_request() {
-		if (sqe) {
-			delete sqe;
-		}
-	}
 };
 
 class cxl_mshr {
@@ -33,13 +27,15 @@ public:
 
 	bool isInProgress(uint64_t lba);
 
-	void insertRequest(uint64_t lba, uint64_t time, Submission_Queue_Entry* sqe);
+	void insertRequest(uint64_t lba, uint64_t time, bool rw);
 	bool removeRequest(uint64_t lba, list<uint64_t> &readcount, list<uint64_t> &writecount, bool& wasfull);
 
 	mshr_request* removeRequestNew(uint64_t lba, list<uint64_t>& readcount, list<uint64_t>& writecount, bool& wasfull, uint64_t dram_avail, bool serviced_before, bool& completely_removed);
 
 	bool isFull() { return full; }
 
+	uint64_t getOccupancy() { return row_count; }
+
 	uint64_t getSize() {
 		return max_row_size - row_count;
 	}
@@ -0,0 +1,32 @@
+#ifndef CXL_MEM_TRANSACTION_H
+#define CXL_MEM_TRANSACTION_H
+
+#include <cstdint>
+#include "../sim/Sim_Defs.h"
+
+namespace Host_Components
+{
+	//CXL.mem message opcodes, encoded as in cxl_traffic_gen/include/cxl_flit.h
+	enum class CXL_Mem_Opcode : uint8_t {
+		MEM_RD = 0x00,//M2S request: read a cache line
+		MEM_WR = 0x10,//M2S request with data: write a cache line
+		MEM_DATA = 0x20,//S2M data response to MEM_RD
+		CMP = 0x30//S2M completion of MEM_WR
+	};
+
+	/*
+	* A CXL.mem request as it crosses the link from the host to the device. It is small and passed by value,
+	* so a load or store reaches the CXL manager without a PCIe message or an NVMe submission queue entry.
+	* NVMe commands are only created inside the device, when an access has to be serviced by the flash back end.
+	*/
+	struct CXL_Mem_Transaction
+	{
+		CXL_Mem_Opcode Opcode;
+		uint16_t Tag;
+		uint16_t Stream_id;//The host (logical device ID) that issued the request, each host has its own window of the device
+		uint64_t Address;//Host physical byte address
+		sim_time_type Issue_time;
+	};
+}
+
+#endif // !CXL_MEM_TRANSACTION_H
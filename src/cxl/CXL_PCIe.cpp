@@ -1,8 +1,11 @@
 #include "CXL_PCIe.h"
+#include "CXL_Link.h"
+#include <algorithm>
 #include <fstream>;
 
-ofstream ofsus_mshr { "./Results/device_stall_time_mshr.txt" };
-ofstream ofsus_flash{ "./Results/device_stall_time_flash.txt" };
+//Opened on the first stall, so that a device that never logs them leaves no files behind
+static ofstream& ofsus_mshr() { static ofstream ofs{ "./Results/device_stall_time_mshr.txt" }; return ofs; }
+static ofstream& ofsus_flash() { static ofstream ofs{ "./Results/device_stall_time_flash.txt" }; return ofs; }
 //ofstream ofsus_dram{ "./Results/device_stall_time_dram.txt" };
 
 //ofstream ofsus_dram{ "device_suspend_time_dram.txt" };
@@ -13,8 +16,16 @@ uint64_t SUS_START_TIME_MSHR{ 0 }, SUS_START_TIME_FLASH{ 0 }, SUS_START_TIME_DRA
 uint64_t resumefeeding{ 0 };
 
 namespace Host_Components {
+	CXL_PCIe* CXL_PCIe::instance = NULL;
+
 	CXL_PCIe::CXL_PCIe(const sim_object_id_type& id) : Sim_Object(id) {
+		instance = this;
+	}
 
+	CXL_PCIe::~CXL_PCIe() {
+		if (instance == this) {
+			instance = NULL;
+		}
 	}
 
 	void CXL_PCIe::Deliver(PCIe_Message* message) {
@@ -28,7 +39,15 @@ namespace Host_Components {
 	void CXL_PCIe::Validate_simulation_config() {}
 	void CXL_PCIe::Execute_simulator_event(MQSimEngine::Sim_Event* event) {
 
-		if (mshr_full || !device_dram_avail || !flash_device_avail) {
+		uint16_t flow_id{ select_flow() };
+
+		if (link == NULL) {
+			if (mshr_full || !device_dram_avail || !flash_device_avail) {
+				skipped_requests++;
+				return;
+			}
+		}
+		else if (!link->Has_request_credit(requests_queues[flow_id].front()->Type == Host_IO_Request_Type::READ ? CXL_Mem_Opcode::MEM_RD : CXL_Mem_Opcode::MEM_WR)) {
 			skipped_requests++;
 			return;
 		}
@@ -38,47 +57,129 @@ namespace Host_Components {
 		//	return;
 		//}
 
-		if (requests_queue.size() >= device_request_queue_max_size) {
+		if (requests_queues[flow_id].size() >= device_request_queue_max_size) {
 			//std::cout << " resume feeding "<< resumefeeding << std::endl;
-			for (auto i = 0; i < skipped_trace_reading; i++) {
-				Simulator->Register_sim_event(Simulator->Time(), (MQSimEngine::Sim_Object*)io_flow, 0, 0);
+			for (auto i = 0; i < skipped_trace_reading[flow_id]; i++) {
+				Simulator->Register_sim_event(Simulator->Time(), (MQSimEngine::Sim_Object*)io_flows[flow_id], 0, 0);
 			}
-			skipped_trace_reading = 0;
+			skipped_trace_reading[flow_id] = 0;
 			
 		}
 
-		Host_IO_Request* io_request{ requests_queue.front()};
-		requests_queue.pop_front();
+		Host_IO_Request* io_request{ requests_queues[flow_id].front()};
+		requests_queues[flow_id].pop_front();
+		charge_flow(flow_id);
+
+		CXL_Mem_Transaction transaction;
+		transaction.Opcode = (io_request->Type == Host_IO_Request_Type::READ) ? CXL_Mem_Opcode::MEM_RD : CXL_Mem_Opcode::MEM_WR;
+		//A flow that waits for its responses tags its own requests
+		transaction.Tag = flow_notified_of_responses[flow_id] ? io_request->IO_queue_info : next_tag++;
+		transaction.Stream_id = flow_id;
+		transaction.Address = io_request->Start_LBA;//The trace of a CXL flow carries byte addresses
+		transaction.Issue_time = Simulator->Time();
+
+		if (link == NULL) {
+			uint64_t lba{ pcie_switch->Deliver_to_device(transaction) };
+			if (flow_notified_of_responses[flow_id]) {
+				pending_accesses[lba].push_back(Pending_access{ Simulator->Time(), transaction });
+			}
+		}
+		else {
+			link->Send_request(transaction);
+		}
 
-		PCIe_Message* message{ new PCIe_Message };
+		//request_count++;
 
-		
-		message->Destination = PCIe_Destination_Type::DEVICE;
-		message->Type = PCIe_Message_Type::READ_COMP;
-		message->Address = 0;
+		delete io_request;
 
-		Submission_Queue_Entry* sqe = new Submission_Queue_Entry;
-		sqe->Command_Identifier = 0;
-		sqe->Opcode = (io_request->Type == Host_IO_Request_Type::READ) ? NVME_READ_OPCODE : NVME_WRITE_OPCODE;
-		sqe->Command_specific[0] = (uint32_t)io_request->Start_LBA;
-		sqe->Command_specific[1] = (uint32_t)(io_request->Start_LBA >> 32);
-		sqe->Command_specific[2] = ((uint32_t)((uint16_t)io_request->LBA_count)) & (uint32_t)(0x0000ffff);
-		sqe->PRP_entry_1 = (DATA_MEMORY_REGION);//Dummy addresses, just to emulate data read/write access
-		sqe->PRP_entry_2 = (DATA_MEMORY_REGION + 0x1000);//Dummy addresses
+	}
 
-		message->Payload = sqe;
-		message->Payload_size = sizeof(Submission_Queue_Entry);
+	void CXL_PCIe::Set_pcie_switch(PCIe_Switch* pcie_switch) {
+		this->pcie_switch = pcie_switch;
+	}
 
-		pcie_switch->Deliver_to_device(message);
+	void CXL_PCIe::Set_io_flow(uint16_t flow_id, IO_Flow_Base* iof, double weight, bool notify_responses) {
+		if (weight <= 0) {
+			PRINT_ERROR("CXL PCIe: the arbitration weight of a host should be greater than zero!")
+		}
+		if (flow_id >= io_flows.size()) {
+			io_flows.resize(flow_id + 1, NULL);
+			requests_queues.resize(flow_id + 1);
+			skipped_trace_reading.resize(flow_id + 1, 0);
+			flow_weights.resize(flow_id + 1, 1);
+			flow_finish_tags.resize(flow_id + 1, 0);
+			flow_notified_of_responses.resize(flow_id + 1, false);
+		}
+		io_flows[flow_id] = iof;
+		flow_weights[flow_id] = weight;
+		flow_notified_of_responses[flow_id] = notify_responses;
+	}
 
-		//request_count++;
+	bool CXL_PCIe::Has_response_consumers() {
+		return std::find(flow_notified_of_responses.begin(), flow_notified_of_responses.end(), true) != flow_notified_of_responses.end();
+	}
 
-		delete io_request;
+	void CXL_PCIe::Deliver_response(const CXL_Mem_Transaction& transaction) {
+		if (transaction.Stream_id < io_flows.size() && flow_notified_of_responses[transaction.Stream_id]) {
+			io_flows[transaction.Stream_id]->CXL_consume_response(transaction);
+		}
+	}
 
+	void CXL_PCIe::Handle_access_serviced(uint64_t lba, sim_time_type initiate_time) {
+		if (instance != NULL) {
+			instance->complete_access(lba, initiate_time);
+		}
 	}
 
-	void CXL_PCIe::Set_pcie_switch(PCIe_Switch* pcie_switch) {
-		this->pcie_switch = pcie_switch;
+	void CXL_PCIe::complete_access(uint64_t lba, sim_time_type initiate_time) {
+		auto accesses = pending_accesses.find(lba);
+		if (accesses == pending_accesses.end()) {
+			return;
+		}
+
+		//A hit can overtake an older access to the same line that waits in the MSHR, so match on the arrival time
+		std::deque<Pending_access>& queue = accesses->second;
+		auto access = queue.begin();
+		while (access != queue.end() && access->Device_arrival_time != initiate_time) {
+			access++;
+		}
+		if (access == queue.end()) {
+			return;
+		}
+
+		CXL_Mem_Transaction transaction{ access->Transaction };
+		queue.erase(access);
+		if (queue.empty()) {
+			pending_accesses.erase(accesses);
+		}
+		Deliver_response(transaction);
+	}
+
+	//Start-time fair queueing: the host whose next request has the smallest virtual finish tag goes first,
+	//so backlogged hosts share the admission slots of the device in proportion to their weights
+	uint16_t CXL_PCIe::select_flow() {
+		uint16_t selected{ 0 };
+		double selected_tag{ 0 };
+		bool found{ false };
+		for (uint16_t flow_id = 0; flow_id < requests_queues.size(); flow_id++) {
+			if (requests_queues[flow_id].empty()) {
+				continue;
+			}
+			double tag{ std::max(virtual_time, flow_finish_tags[flow_id]) + 1.0 / flow_weights[flow_id] };
+			if (!found || tag < selected_tag) {
+				found = true;
+				selected = flow_id;
+				selected_tag = tag;
+			}
+		}
+
+		return selected;
+	}
+
+	void CXL_PCIe::charge_flow(uint16_t flow_id) {
+		double start_tag{ std::max(virtual_time, flow_finish_tags[flow_id]) };
+		flow_finish_tags[flow_id] = start_tag + 1.0 / flow_weights[flow_id];
+		virtual_time = start_tag;
 	}
 
 	void CXL_PCIe::MSHR_full() {
@@ -88,13 +189,10 @@ namespace Host_Components {
 
 	void CXL_PCIe::MSHR_not_full() {
 		mshr_full = 0;
-		while (skipped_requests > 0) {
-
-			skipped_requests--;
-			Simulator->Register_sim_event(Simulator->Time(), this, 0, 0);
-
+		Resume_skipped_requests();
+		if (log_stalls) {
+			ofsus_mshr() << SUS_START_TIME_MSHR << " " << Simulator->Time() << "\n";
 		}
-		ofsus_mshr << SUS_START_TIME_MSHR << " " << Simulator->Time() << endl;
 	}
 
 	void CXL_PCIe::mark_dram_full() {
@@ -104,11 +202,7 @@ namespace Host_Components {
 
 	void CXL_PCIe::mark_dram_free() {
 		device_dram_avail = 1;
-		while (skipped_requests > 0) {
-			skipped_requests--;
-			Simulator->Register_sim_event(Simulator->Time(), this, 0, 0);
-
-		}
+		Resume_skipped_requests();
 		//ofsus_dram << SUS_START_TIME_DRAM << " " << Simulator->Time() << endl;
 
 	}
@@ -120,12 +214,20 @@ namespace Host_Components {
 
 	void CXL_PCIe::mark_flash_free() {
 		flash_device_avail = 1;
+		Resume_skipped_requests();
+		if (log_stalls) {
+			ofsus_flash() << SUS_START_TIME_FLASH << " " << Simulator->Time() << "\n";
+		}
+	}
+
+	void CXL_PCIe::Resume_skipped_requests() {
+		if (link != NULL) {
+			link->Device_ready();
+		}
 		while (skipped_requests > 0) {
 			skipped_requests--;
 			Simulator->Register_sim_event(Simulator->Time(), this, 0, 0);
-
 		}
-		ofsus_flash << SUS_START_TIME_FLASH << " " << Simulator->Time() << endl;
 	}
 
 }
\ No newline at end of file
@@ -1,7 +1,10 @@
 #ifndef CXL_PCIE_H
 #define CXL_PCIE_H
 
+#include <deque>
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "../sim/Sim_Defs.h"
 #include "../sim/Sim_Object.h"
 #include "../sim/Sim_Event.h"
@@ -9,6 +12,7 @@
 #include "../host/Host_IO_Request.h"
 #include "../host/IO_Flow_Base.h"
 #include "../host/PCIe_Switch.h"
+#include "CXL_Mem_Transaction.h"
 #include "../ssd/Host_Interface_Defs.h"
 //#include "Host_Interface_CXL.h"
 
@@ -20,23 +24,31 @@
 namespace Host_Components {
 	class PCIe_Switch;
 	class IO_Flow_Base;
+	class CXL_Link;
 	class CXL_PCIe :public MQSimEngine::Sim_Object {
 	public:
 		CXL_PCIe(const sim_object_id_type& id);
+		~CXL_PCIe();
 
 		void Deliver(PCIe_Message* message);
 		void Start_simulation();
 		void Validate_simulation_config();
 		void Execute_simulator_event(MQSimEngine::Sim_Event* event);
 		void Set_pcie_switch(PCIe_Switch* pcie_switch);
-		void Set_io_flow(IO_Flow_Base* iof) { io_flow = iof; }
+		void Set_io_flow(uint16_t flow_id, IO_Flow_Base* iof, double weight, bool notify_responses = false);
+		void Set_cxl_link(CXL_Link* link) { this->link = link; }
 
-		bool device_avail() {
-			return (requests_queue.size() < device_request_queue_max_size);
+		bool device_avail(uint16_t flow_id) {
+			return (requests_queues[flow_id].size() < device_request_queue_max_size);
+		}
+		void Enqueue_request(Host_IO_Request* request) {
+			requests_queues[request->Source_flow_id].push_back(request);
 		}
 		void Request_completed() {
 			if (request_count >= device_request_queue_max_size) {
-				Simulator->Register_sim_event(Simulator->Time(), (MQSimEngine::Sim_Object*)io_flow, 0,0);
+				for (auto flow : io_flows) {
+					Simulator->Register_sim_event(Simulator->Time(), (MQSimEngine::Sim_Object*)flow, 0, 0);
+				}
 			}
 			//request_count--;
 		}
@@ -52,22 +64,52 @@ namespace Host_Components {
 
 		void mark_flash_free();
 
-		std::list<Host_IO_Request*> requests_queue;
+		virtual void Resume_skipped_requests();
+
+		void Deliver_response(const CXL_Mem_Transaction& transaction);//Called when the response to a request reaches the host
+		bool Has_response_consumers();
+		static void Handle_access_serviced(uint64_t lba, sim_time_type initiate_time);
+
+		std::vector<uint64_t> skipped_trace_reading;//Per host
 
-		uint64_t skipped_trace_reading{ 0 };
+		bool device_stalled() {
+			return mshr_full || !device_dram_avail || !flash_device_avail;
+		}
 		
-	private:
+	protected:
 		PCIe_Switch* pcie_switch{NULL};
+		CXL_Link* link{ NULL };//When set, requests cross a flit-level link model and the link applies the device back pressure
 		uint64_t returned_request_count{ 0 };
 
 		uint64_t device_request_queue_max_size{ 32 };
 		uint64_t request_count{ 0 };
+		uint16_t next_tag{ 0 };
 		bool mshr_full{ 0 };
-		IO_Flow_Base* io_flow{ NULL };
+
+		//Each host (IO flow) has its own admission queue. A weighted fair arbiter picks the host whose request enters the device next.
+		std::vector<std::list<Host_IO_Request*>> requests_queues;
+		std::vector<IO_Flow_Base*> io_flows;
+		std::vector<double> flow_weights;
+		std::vector<bool> flow_notified_of_responses;
+		std::vector<double> flow_finish_tags;
+		double virtual_time{ 0 };
+		uint16_t select_flow();
+		void charge_flow(uint16_t flow_id);
 		uint64_t skipped_requests{ 0 };
+		bool log_stalls{ true };//Write the stall periods to Results/device_stall_time_*.txt
 
 		uint64_t device_dram_avail{ 1 };
 		uint64_t flash_device_avail{ 1 };
+
+		//Without the link model, the requests of the flows that wait for their responses are matched with the serviced accesses here
+		struct Pending_access
+		{
+			sim_time_type Device_arrival_time;
+			CXL_Mem_Transaction Transaction;
+		};
+		static CXL_PCIe* instance;
+		std::unordered_map<uint64_t, std::deque<Pending_access>> pending_accesses;
+		void complete_access(uint64_t lba, sim_time_type initiate_time);
 	};
 }
 
@@ -0,0 +1,137 @@
+#include <cmath>
+#include "../sim/Engine.h"
+#include "CXL_Phase_Controller.h"
+#include "OutputLog.h"
+
+namespace SSD_Components {
+
+	//Strides beyond this distance are not considered a regular pattern
+	#define PHASE_MAX_STRIDE 64
+
+	static const char* prefetcher_name(prefetchertype policy) {
+		switch (policy) {
+		case prefetchertype::no: return "No";
+		case prefetchertype::tagged: return "Tagged";
+		case prefetchertype::bo: return "Best-offset";
+		case prefetchertype::stms: return "STMS";
+		case prefetchertype::leap: return "Leap";
+		case prefetchertype::readahead: return "Readahead";
+		case prefetchertype::feedback_direct: return "Feedback_direct";
+		}
+		return "";
+	}
+
+	static const char* pattern_name(access_pattern pattern) {
+		switch (pattern) {
+		case access_pattern::sequential: return "sequential";
+		case access_pattern::strided: return "strided";
+		case access_pattern::irregular: return "irregular";
+		}
+		return "";
+	}
+
+	cxl_phase_controller::cxl_phase_controller(uint64_t window, double miss_rate_threshold, prefetchertype configured_policy)
+		: window(window), miss_rate_threshold(miss_rate_threshold), of_phase("./Results/phase_decisions.txt") {
+		if (miss_rate_threshold <= 0 || miss_rate_threshold >= 1) {
+			PRINT_ERROR("Phase controller: the miss rate threshold should be in (0, 1)!")
+		}
+		//A feedback-directed run keeps its own aggressiveness control in the sequential phases
+		sequential_policy = configured_policy == prefetchertype::feedback_direct ? prefetchertype::feedback_direct : prefetchertype::tagged;
+	}
+
+	bool cxl_phase_controller::record_access(uint16_t stream_id, uint64_t lba, bool miss) {
+		if (stream_id >= last_lba.size()) {
+			last_lba.resize(stream_id + 1, UINT64_MAX);
+		}
+		if (last_lba[stream_id] != UINT64_MAX) {
+			int64_t stride{ static_cast<int64_t>(lba - last_lba[stream_id]) };
+			if (stride == 1) {
+				next_line_count++;
+			}
+			if (stride != 0 && stride >= -PHASE_MAX_STRIDE && stride <= PHASE_MAX_STRIDE) {
+				stride_counts[stride]++;
+			}
+		}
+		last_lba[stream_id] = lba;
+
+		access_count++;
+		if (miss) {
+			miss_count++;
+		}
+		if (access_count < window) {
+			return 0;
+		}
+
+		close_window();
+		return 1;
+	}
+
+	void cxl_phase_controller::close_window() {
+		window_count++;
+		miss_rate = static_cast<double>(miss_count) / access_count;
+		next_line_fraction = static_cast<double>(next_line_count) / access_count;
+
+		dominant_stride = 0;
+		uint64_t dominant_count{ 0 };
+		for (auto& s : stride_counts) {
+			if (s.second > dominant_count) {
+				dominant_stride = s.first;
+				dominant_count = s.second;
+			}
+		}
+		stride_fraction = static_cast<double>(dominant_count) / access_count;
+
+		if (next_line_fraction >= 0.5) {
+			pattern = access_pattern::sequential;
+		}
+		else if (stride_fraction >= 0.5) {
+			pattern = access_pattern::strided;
+		}
+		else {
+			pattern = access_pattern::irregular;
+		}
+
+		phase_changed = previous_miss_rate < 0 || pattern != previous_pattern || std::fabs(miss_rate - previous_miss_rate) > miss_rate_threshold;
+		if (phase_changed) {
+			phase_change_count++;
+		}
+		previous_miss_rate = miss_rate;
+		previous_pattern = pattern;
+
+		access_count = 0;
+		miss_count = 0;
+		next_line_count = 0;
+		stride_counts.clear();
+	}
+
+	prefetchertype cxl_phase_controller::select_prefetcher(prefetchertype current_policy) {
+		if (!phase_changed) {
+			return current_policy;
+		}
+
+		prefetchertype policy{ sequential_policy };
+		if (pattern == access_pattern::strided) {
+			policy = prefetchertype::bo;
+		}
+		else if (pattern == access_pattern::irregular) {
+			policy = prefetchertype::leap;
+		}
+		if (policy != current_policy) {
+			prefetcher_switch_count++;
+		}
+
+		return policy;
+	}
+
+	void cxl_phase_controller::log_decision(prefetchertype policy, int prefetch_level, double prefetch_share) {
+		of_phase << Simulator->Time() << " window " << window_count << " miss_rate " << miss_rate << " next_line " << next_line_fraction
+			<< " stride " << dominant_stride << " stride_fraction " << stride_fraction << " pattern " << pattern_name(pattern)
+			<< " phase_change " << phase_changed << " prefetcher " << prefetcher_name(policy) << " level " << prefetch_level
+			<< " prefetch_share " << prefetch_share << endl;
+	}
+
+	void cxl_phase_controller::print_statistics() {
+		std::cout << "Phase windows: " << window_count << "   phase changes: " << phase_change_count << "   prefetcher switches: " << prefetcher_switch_count << endl;
+		of_overall << "Phase windows: " << window_count << "   phase changes: " << phase_change_count << "   prefetcher switches: " << prefetcher_switch_count << endl;
+	}
+}
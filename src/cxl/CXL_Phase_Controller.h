@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <vector>
+#include "../sim/Sim_Defs.h"
+#include "CXL_Config.h"
+
+using namespace std;
+
+namespace SSD_Components {
+
+	enum class access_pattern { sequential, strided, irregular };
+
+	/*
+	* Detects workload phases from windows of demand accesses. At the end of each window it compares the miss rate and the
+	* stride profile of the window (the fraction of next-line accesses and of accesses with the most common stride) with
+	* those of the previous window. A new access pattern or a miss rate shift beyond the threshold starts a new phase,
+	* and the prefetcher that suits the pattern of the phase is selected: Tagged for sequential, Best-offset for strided
+	* and Leap for irregular accesses. Every decision of the window is logged so that the adaptive runs can be compared
+	* with the static ones.
+	*/
+	class cxl_phase_controller {
+	public:
+		cxl_phase_controller(uint64_t window, double miss_rate_threshold, prefetchertype configured_policy);
+
+		bool record_access(uint16_t stream_id, uint64_t lba, bool miss);//Returns true at the end of a window
+		prefetchertype select_prefetcher(prefetchertype current_policy);
+		void log_decision(prefetchertype policy, int prefetch_level, double prefetch_share);
+		void print_statistics();
+
+	private:
+		uint64_t window;
+		double miss_rate_threshold;
+		prefetchertype sequential_policy;
+		ofstream of_phase;
+
+		uint64_t access_count{ 0 }, miss_count{ 0 }, next_line_count{ 0 };
+		vector<uint64_t> last_lba;//Of each stream
+		map<int64_t, uint64_t> stride_counts;
+		uint64_t window_count{ 0 };
+
+		double miss_rate{ 0 }, next_line_fraction{ 0 }, stride_fraction{ 0 };
+		int64_t dominant_stride{ 0 };
+		access_pattern pattern{ access_pattern::sequential };
+		double previous_miss_rate{ -1 };
+		access_pattern previous_pattern{ access_pattern::sequential };
+		bool phase_changed{ 0 };
+
+		uint64_t phase_change_count{ 0 }, prefetcher_switch_count{ 0 };
+
+		void close_window();
+	};
+}
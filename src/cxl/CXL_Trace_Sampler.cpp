@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include "../sim/Engine.h"
+#include "CXL_Trace_Sampler.h"
+#include "Host_Interface_CXL.h"
+
+namespace SSD_Components {
+
+	//The footprint of an interval is its distribution over hashed regions of this many 4KB lines
+	#define SAMPLING_REGION_LINES 64
+	#define SAMPLING_REGION_BUCKETS 16
+	#define SAMPLING_REGION_WEIGHT 0.5//Intervals that scan different regions in the same way should stay close
+	#define SAMPLING_MAX_ITERATIONS 32
+	#define SAMPLING_BATCHES 10//The timed accesses of a sample are split into this many batches to measure the spread of its hit rate
+
+	static double distance(const vector<double>& a, const vector<double>& b) {
+		double d{ 0 };
+		for (size_t i = 0; i < a.size(); i++) {
+			d += (a[i] - b[i]) * (a[i] - b[i]);
+		}
+		return d;
+	}
+
+	cxl_trace_sampler::cxl_trace_sampler(CXL_Manager* cxl_man, uint64_t interval_length, uint64_t cluster_count)
+		: cxl_man(cxl_man), interval_length(interval_length), cluster_count(cluster_count) {
+		if (cluster_count == 0) {
+			PRINT_ERROR("Trace sampling: the number of clusters should be greater than zero!")
+		}
+	}
+
+	void cxl_trace_sampler::add_record(uint16_t stream_id, uint64_t address, bool write) {
+		if (stream_id >= plans.size()) {
+			plans.resize(stream_id + 1);
+		}
+		stream_plan& plan{ plans[stream_id] };
+		if (plan.region_counts.size() == 0) {
+			plan.region_counts.resize(SAMPLING_REGION_BUCKETS, 0);
+		}
+
+		uint64_t line{ address / (cxl_man->cxl_config_para.num_sec * 512) };
+		uint64_t region{ line / SAMPLING_REGION_LINES };
+		plan.region_counts[(region * 0x9E3779B97F4A7C15ULL) >> 60]++;
+		plan.lines.insert(line);
+		if (plan.previous_lines.count(line)) {
+			plan.reuse_count++;
+		}
+		if (line == plan.last_line + 1) {
+			plan.next_line_count++;
+		}
+		plan.last_line = line;
+		if (write) {
+			plan.write_count++;
+		}
+
+		plan.record_count++;
+		if (plan.record_count == interval_length) {
+			close_interval(plan);
+		}
+	}
+
+	void cxl_trace_sampler::close_interval(stream_plan& plan) {
+		double n{ static_cast<double>(plan.record_count) };
+		vector<double> signature;
+		for (auto count : plan.region_counts) {
+			signature.push_back(SAMPLING_REGION_WEIGHT * count / n);
+		}
+		signature.push_back(plan.lines.size() / n);
+		signature.push_back(plan.reuse_count / n);
+		signature.push_back(plan.next_line_count / n);
+		signature.push_back(plan.write_count / n);
+		plan.signatures.push_back(signature);
+
+		plan.record_count = 0;
+		fill(plan.region_counts.begin(), plan.region_counts.end(), 0);
+		plan.previous_lines.swap(plan.lines);
+		plan.lines.clear();
+		plan.reuse_count = 0;
+		plan.next_line_count = 0;
+		plan.write_count = 0;
+	}
+
+	uint64_t cxl_trace_sampler::interval_records(const stream_plan& plan, uint64_t interval) {
+		return min(interval_length, plan.planned_records - interval * interval_length);
+	}
+
+	//k-means with farthest-point seeding, so that the plan of a trace is always the same
+	void cxl_trace_sampler::cluster(stream_plan& plan) {
+		size_t n{ plan.signatures.size() };
+		size_t k{ static_cast<size_t>(min<uint64_t>(cluster_count, n)) };
+
+		vector<vector<double>> centroids{ plan.signatures[0] };
+		vector<double> nearest(n, DBL_MAX);
+		while (centroids.size() < k) {
+			size_t farthest{ 0 };
+			for (size_t i = 0; i < n; i++) {
+				nearest[i] = min(nearest[i], distance(plan.signatures[i], centroids.back()));
+				if (nearest[i] > nearest[farthest]) {
+					farthest = i;
+				}
+			}
+			if (nearest[farthest] == 0) {
+				break;
+			}
+			centroids.push_back(plan.signatures[farthest]);
+		}
+		k = centroids.size();
+
+		plan.cluster_of.assign(n, 0);
+		for (unsigned int iteration = 0; iteration < SAMPLING_MAX_ITERATIONS; iteration++) {
+			bool changed{ iteration == 0 };
+			for (size_t i = 0; i < n; i++) {
+				unsigned int best{ 0 };
+				double best_distance{ DBL_MAX };
+				for (unsigned int c = 0; c < k; c++) {
+					double d{ distance(plan.signatures[i], centroids[c]) };
+					if (d < best_distance) {
+						best = c;
+						best_distance = d;
+					}
+				}
+				if (best != plan.cluster_of[i]) {
+					plan.cluster_of[i] = best;
+					changed = 1;
+				}
+			}
+			if (!changed) {
+				break;
+			}
+
+			vector<uint64_t> members(k, 0);
+			for (auto& centroid : centroids) {
+				fill(centroid.begin(), centroid.end(), 0);
+			}
+			for (size_t i = 0; i < n; i++) {
+				members[plan.cluster_of[i]]++;
+				for (size_t d = 0; d < plan.signatures[i].size(); d++) {
+					centroids[plan.cluster_of[i]][d] += plan.signatures[i][d];
+				}
+			}
+			for (unsigned int c = 0; c < k; c++) {
+				for (auto& value : centroids[c]) {
+					value = members[c] == 0 ? 0 : value / members[c];
+				}
+			}
+		}
+
+		//The representative of a cluster is its interval closest to the centroid
+		vector<size_t> representative(k, n);
+		vector<double> representative_distance(k, DBL_MAX);
+		plan.cluster_records.assign(k, 0);
+		for (size_t i = 0; i < n; i++) {
+			unsigned int c{ plan.cluster_of[i] };
+			plan.cluster_records[c] += interval_records(plan, i);
+			double d{ distance(plan.signatures[i], centroids[c]) };
+			if (d < representative_distance[c]) {
+				representative[c] = i;
+				representative_distance[c] = d;
+			}
+		}
+
+		plan.sampled.assign(n, 0);
+		for (unsigned int c = 0; c < k; c++) {
+			if (representative[c] < n) {
+				plan.sampled[representative[c]] = 1;
+			}
+		}
+		for (size_t i = 0; i < n; i++) {
+			if (plan.sampled[i]) {
+				plan.samples.push_back(i);
+			}
+		}
+	}
+
+	uint64_t cxl_trace_sampler::plan(uint16_t stream_id, uint64_t record_count) {
+		if (stream_id >= plans.size() || record_count == 0) {
+			return 0;
+		}
+		stream_plan& plan{ plans[stream_id] };
+		if (plan.record_count > 0) {
+			close_interval(plan);
+		}
+		plan.planned_records = record_count;
+		uint64_t interval_count{ (record_count + interval_length - 1) / interval_length };
+		if (plan.signatures.size() > interval_count) {
+			plan.signatures.resize(interval_count);
+		}
+
+		cluster(plan);
+		plan.signatures.clear();
+		plan.signatures.shrink_to_fit();
+		plan.lines.clear();
+		plan.previous_lines.clear();
+
+		plan.interval_hits.assign(interval_count, 0);
+		plan.interval_accesses.assign(interval_count, 0);
+		plan.sample_start.assign(plan.samples.size(), UINT64_MAX);
+		plan.sample_accesses.assign(plan.samples.size(), 0);
+		plan.sample_hits.assign(plan.samples.size(), 0);
+		plan.sample_serviced.assign(plan.samples.size(), 0);
+		plan.batch_accesses.assign(plan.samples.size() * SAMPLING_BATCHES, 0);
+		plan.batch_hits.assign(plan.samples.size() * SAMPLING_BATCHES, 0);
+		plan.latency_sum.assign(plan.samples.size(), 0);
+		plan.latency_square_sum.assign(plan.samples.size(), 0);
+
+		uint64_t skipped{ record_count };
+		for (auto interval : plan.samples) {
+			skipped -= interval_records(plan, interval);
+		}
+
+		cxl_man->exclude_requests(skipped);
+
+		return skipped;
+	}
+
+	bool cxl_trace_sampler::is_sampled(uint16_t stream_id, uint64_t record) {
+		if (stream_id >= plans.size()) {
+			return 1;
+		}
+		uint64_t interval{ record / interval_length };
+		return interval >= plans[stream_id].sampled.size() || plans[stream_id].sampled[interval];
+	}
+
+	bool cxl_trace_sampler::fast_forward(uint16_t stream_id, uint64_t record, uint64_t address, bool write) {
+		stream_plan& plan{ plans[stream_id] };
+		bool hit{ cxl_man->functional_access(address, !write, stream_id) };
+
+		uint64_t interval{ record / interval_length };
+		plan.interval_accesses[interval]++;
+		if (hit) {
+			plan.interval_hits[interval]++;
+		}
+
+		return hit;
+	}
+
+	//The accesses of a stream reach the device in the order of the trace, so the count of its timed accesses gives the sample
+	void cxl_trace_sampler::access(uint16_t stream_id, bool hit) {
+		if (stream_id >= plans.size() || plans[stream_id].current_sample >= plans[stream_id].samples.size()) {
+			return;
+		}
+		stream_plan& plan{ plans[stream_id] };
+		size_t sample{ plan.current_sample };
+		uint64_t interval{ plan.samples[sample] };
+		if (plan.sample_accesses[sample] == 0) {
+			plan.sample_start[sample] = Simulator->Time();
+		}
+		size_t batch{ sample * SAMPLING_BATCHES + static_cast<size_t>(plan.sample_accesses[sample] * SAMPLING_BATCHES / interval_records(plan, interval)) };
+		plan.sample_accesses[sample]++;
+		plan.interval_accesses[interval]++;
+		plan.batch_accesses[batch]++;
+		if (hit) {
+			plan.sample_hits[sample]++;
+			plan.interval_hits[interval]++;
+			plan.batch_hits[batch]++;
+		}
+		if (plan.sample_accesses[sample] == interval_records(plan, interval)) {
+			plan.current_sample++;
+		}
+	}
+
+	void cxl_trace_sampler::access_serviced(uint16_t stream_id, sim_time_type initiate_time, sim_time_type latency) {
+		if (stream_id >= plans.size() || plans[stream_id].samples.size() == 0) {
+			return;
+		}
+		stream_plan& plan{ plans[stream_id] };
+		auto next = upper_bound(plan.sample_start.begin(), plan.sample_start.end(), initiate_time);
+		if (next == plan.sample_start.begin()) {
+			return;
+		}
+		size_t sample{ static_cast<size_t>(next - plan.sample_start.begin()) - 1 };
+		plan.sample_serviced[sample]++;
+		plan.latency_sum[sample] += latency;
+		plan.latency_square_sum[sample] += static_cast<double>(latency) * latency;
+	}
+
+	void cxl_trace_sampler::print_estimate() {
+		ofstream of_sampling{ "./Results/trace_sampling.txt" };
+		of_sampling << "host interval cluster weight accesses hit_rate avg_latency_ns cluster_relative_spread sample_stderr" << endl;
+
+		for (uint16_t stream_id = 0; stream_id < plans.size(); stream_id++) {
+			stream_plan& plan{ plans[stream_id] };
+			if (plan.samples.size() == 0) {
+				continue;
+			}
+			size_t k{ plan.cluster_records.size() };
+
+			vector<uint64_t> members(k, 0);
+			uint64_t all_hits{ 0 }, all_accesses{ 0 };
+			vector<double> functional_sum(k, 0), functional_square_sum(k, 0);
+			vector<unsigned int> functional_intervals(k, 0);
+			for (size_t i = 0; i < plan.interval_accesses.size(); i++) {
+				unsigned int c{ plan.cluster_of[i] };
+				members[c]++;
+				all_hits += plan.interval_hits[i];
+				all_accesses += plan.interval_accesses[i];
+				if (!plan.sampled[i] && plan.interval_accesses[i] > 0) {
+					double functional_hit_rate{ static_cast<double>(plan.interval_hits[i]) / plan.interval_accesses[i] };
+					functional_sum[c] += functional_hit_rate;
+					functional_square_sum[c] += functional_hit_rate * functional_hit_rate;
+					functional_intervals[c]++;
+				}
+			}
+
+			//Functional hit rates are far above the timed ones, so the spread of the fast-forwarded intervals of a cluster
+			//is taken relative to their mean and applied to the timed hit rate of the representative
+			vector<double> relative_spread(k, 0);
+			for (size_t c = 0; c < k; c++) {
+				if (functional_intervals[c] < 2 || functional_sum[c] == 0) {
+					continue;
+				}
+				double n{ static_cast<double>(functional_intervals[c]) };
+				double variance{ max(0.0, (functional_square_sum[c] - functional_sum[c] * functional_sum[c] / n) / (n - 1)) };
+				relative_spread[c] = sqrt(variance) / (functional_sum[c] / n);
+			}
+
+			vector<double> sample_hit_rate, sample_latency, weight, stderr_of_sample;
+			uint64_t timed_records{ 0 };
+			for (size_t s = 0; s < plan.samples.size(); s++) {
+				unsigned int c{ plan.cluster_of[plan.samples[s]] };
+				//The standard error of the mean of the batch hit rates is the timing noise within the sample
+				double batch_sum{ 0 }, batch_square_sum{ 0 };
+				unsigned int batches{ 0 };
+				for (size_t b = s * SAMPLING_BATCHES; b < (s + 1) * SAMPLING_BATCHES; b++) {
+					if (plan.batch_accesses[b] == 0) {
+						continue;
+					}
+					double batch_hit_rate{ static_cast<double>(plan.batch_hits[b]) / plan.batch_accesses[b] };
+					batch_sum += batch_hit_rate;
+					batch_square_sum += batch_hit_rate * batch_hit_rate;
+					batches++;
+				}
+				double batch_variance{ batches < 2 ? 0 : max(0.0, (batch_square_sum - batch_sum * batch_sum / batches) / (batches - 1)) };
+				stderr_of_sample.push_back(batches < 2 ? 0 : sqrt(batch_variance / batches));
+				weight.push_back(static_cast<double>(plan.cluster_records[c]) / plan.planned_records);
+				sample_hit_rate.push_back(plan.sample_accesses[s] == 0 ? 0 : static_cast<double>(plan.sample_hits[s]) / plan.sample_accesses[s]);
+				sample_latency.push_back(plan.sample_serviced[s] == 0 ? 0 : plan.latency_sum[s] / plan.sample_serviced[s]);
+				timed_records += interval_records(plan, plan.samples[s]);
+			}
+
+			//The latency cost of a miss, fitted over the samples, turns the hit rate spread of a cluster into a latency spread
+			double miss_cost{ 0 };
+			if (plan.samples.size() > 1) {
+				double mean_miss{ 0 }, mean_latency{ 0 };
+				for (size_t s = 0; s < plan.samples.size(); s++) {
+					mean_miss += (1 - sample_hit_rate[s]) / plan.samples.size();
+					mean_latency += sample_latency[s] / plan.samples.size();
+				}
+				double covariance{ 0 }, variance{ 0 };
+				for (size_t s = 0; s < plan.samples.size(); s++) {
+					covariance += (1 - sample_hit_rate[s] - mean_miss) * (sample_latency[s] - mean_latency);
+					variance += (1 - sample_hit_rate[s] - mean_miss) * (1 - sample_hit_rate[s] - mean_miss);
+				}
+				miss_cost = variance == 0 ? 0 : max(0.0, covariance / variance);
+			}
+
+			double hit_rate{ 0 }, latency{ 0 }, hit_rate_variance{ 0 }, latency_variance{ 0 };
+			for (size_t s = 0; s < plan.samples.size(); s++) {
+				unsigned int c{ plan.cluster_of[plan.samples[s]] };
+				double representation{ members[c] == 0 ? 0 : 1 - 1.0 / members[c] };
+				double latency_noise{ 0 };
+				if (plan.sample_serviced[s] > 0) {
+					latency_noise = max(0.0, plan.latency_square_sum[s] / plan.sample_serviced[s] - sample_latency[s] * sample_latency[s]) / plan.sample_serviced[s];
+				}
+				double interval_spread{ sample_hit_rate[s] * relative_spread[c] };
+				double hit_rate_error{ interval_spread * interval_spread * representation + stderr_of_sample[s] * stderr_of_sample[s] };
+				hit_rate += weight[s] * sample_hit_rate[s];
+				latency += weight[s] * sample_latency[s];
+				hit_rate_variance += weight[s] * weight[s] * hit_rate_error;
+				latency_variance += weight[s] * weight[s] * (miss_cost * miss_cost * hit_rate_error + latency_noise);
+
+				of_sampling << stream_id << " " << plan.samples[s] << " " << c << " " << weight[s] << " " << plan.sample_accesses[s] << " "
+					<< sample_hit_rate[s] << " " << sample_latency[s] << " " << relative_spread[c] << " " << stderr_of_sample[s] << endl;
+			}
+
+			std::cout << "Trace sampling of host " << stream_id << ": " << plan.interval_accesses.size() << " intervals of " << interval_length << " records in "
+				<< plan.samples.size() << " clusters, " << timed_records << " of " << plan.planned_records << " records simulated in detail" << endl;
+			of_overall << "Trace sampling of host " << stream_id << ": " << plan.interval_accesses.size() << " intervals of " << interval_length << " records in "
+				<< plan.samples.size() << " clusters, " << timed_records << " of " << plan.planned_records << " records simulated in detail" << endl;
+			std::cout << "Estimated hit rate: " << hit_rate << " +- " << 1.96 * sqrt(hit_rate_variance) << "   hit rate of all intervals (functional outside the samples): "
+				<< (all_accesses == 0 ? 0 : static_cast<double>(all_hits) / all_accesses) << endl;
+			of_overall << "Estimated hit rate: " << hit_rate << " +- " << 1.96 * sqrt(hit_rate_variance) << "   hit rate of all intervals (functional outside the samples): "
+				<< (all_accesses == 0 ? 0 : static_cast<double>(all_hits) / all_accesses) << endl;
+			std::cout << "Estimated average latency: " << latency << " +- " << 1.96 * sqrt(latency_variance) << " ns" << endl;
+			of_overall << "Estimated average latency: " << latency << " +- " << 1.96 * sqrt(latency_variance) << " ns" << endl;
+			std::cout << "The 95% bounds cover the spread of the clusters and the noise of the samples, not the bias of the functional warm-up" << endl;
+			of_overall << "The 95% bounds cover the spread of the clusters and the noise of the samples, not the bias of the functional warm-up" << endl;
+		}
+		std::cout << "Dirty lines evicted in functional mode (not written to flash): " << cxl_man->functional_flush_count << endl;
+		of_overall << "Dirty lines evicted in functional mode (not written to flash): " << cxl_man->functional_flush_count << endl;
+
+		of_sampling.close();
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <unordered_set>
+#include <vector>
+#include "../sim/Sim_Defs.h"
+
+using namespace std;
+
+namespace SSD_Components {
+
+	class CXL_Manager;
+
+	/*
+	* SimPoint-style sampling of the trace flows. The records of a trace are split into intervals of a fixed number of records,
+	* and each interval gets an address footprint signature: the distribution of its accesses over hashed 256KB regions and the
+	* fractions of distinct 4KB lines, of accesses to the lines of the previous interval, of next-line accesses and of writes.
+	* The signatures are clustered with k-means, and the interval closest to the centroid of a cluster represents the cluster with a weight of its share of the records.
+	* The flow fast-forwards through the other intervals in functional mode, which only updates the cache and the prefetcher
+	* state, and only the representatives are simulated in detail. The hit rate and the latency of the whole trace are
+	* extrapolated from the representatives. The 95% bounds combine the spread of the functional hit rates of the fast-forwarded
+	* intervals of each cluster, relative to their mean since functional hit rates sit far above the timed ones, with the noise of the
+	* timed hit rate within each representative. They do not cover the bias of the functional warm-up before the representatives.
+	*/
+	class cxl_trace_sampler {
+	public:
+		cxl_trace_sampler(CXL_Manager* cxl_man, uint64_t interval_length, uint64_t cluster_count);
+
+		void add_record(uint16_t stream_id, uint64_t address, bool write);//Called for the records of a trace in order, before planning
+		uint64_t plan(uint16_t stream_id, uint64_t record_count);//Returns the number of records that are fast-forwarded
+		bool is_sampled(uint16_t stream_id, uint64_t record);
+		bool fast_forward(uint16_t stream_id, uint64_t record, uint64_t address, bool write);
+		void access(uint16_t stream_id, bool hit);//A timed access reaches the device
+		void access_serviced(uint16_t stream_id, sim_time_type initiate_time, sim_time_type latency);
+		void print_estimate();
+
+	private:
+		class stream_plan {
+		public:
+			//Signature of the interval being read
+			uint64_t record_count{ 0 };
+			vector<uint64_t> region_counts;
+			unordered_set<uint64_t> lines, previous_lines;
+			uint64_t reuse_count{ 0 }, next_line_count{ 0 }, write_count{ 0 };
+			uint64_t last_line{ UINT64_MAX };
+			vector<vector<double>> signatures;
+
+			uint64_t planned_records{ 0 };
+			vector<unsigned int> cluster_of;//Of each interval
+			vector<bool> sampled;//Of each interval
+			vector<uint64_t> interval_hits, interval_accesses;
+			vector<uint64_t> cluster_records;
+
+			//The sampled intervals in trace order
+			vector<uint64_t> samples;
+			vector<sim_time_type> sample_start;//Device arrival time of the first access of each sample
+			vector<uint64_t> sample_accesses, sample_hits, sample_serviced;
+			vector<uint64_t> batch_accesses, batch_hits;//SAMPLING_BATCHES per sample
+			vector<double> latency_sum, latency_square_sum;
+			uint64_t timed_access_count{ 0 };
+			size_t current_sample{ 0 };
+		};
+
+		CXL_Manager* cxl_man;
+		uint64_t interval_length;
+		uint64_t cluster_count;
+		vector<stream_plan> plans;//By stream ID
+		bool printed{ 0 };
+
+		void close_interval(stream_plan& plan);
+		void cluster(stream_plan& plan);
+		uint64_t interval_records(const stream_plan& plan, uint64_t interval);
+	};
+}
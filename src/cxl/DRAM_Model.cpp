@@ -1,5 +1,6 @@
 #include "DRAM_Model.h"
 
+#include <cmath>
 #include <fstream>
 
 //ofstream ofi{ "cache_wait_time.txt" };
@@ -79,6 +80,7 @@ namespace SSD_Components {
 			if (!falsehit) {
 				//outputf.of << "Finished_time " << Simulator->Time() << " Starting_time " << current_access->initiate_time << " Cache_hit_at " << current_access->lba << std::endl;
 				oflate << Simulator->Time() - current_access->initiate_time << endl;
+				Broadcast_access_serviced_signal(current_access->lba, current_access->initiate_time);
 				//hi->Notify_CXL_Host_request_complete();
 				totalcount++;
 			}
@@ -95,6 +97,7 @@ namespace SSD_Components {
 			if (!falsehit) {
 				//outputf.of << "Finished_time " << Simulator->Time() << " Starting_time " << current_access->initiate_time << " Cache_hit_under_miss_at " << current_access->lba << std::endl;
 				oflate << Simulator->Time() - current_access->initiate_time << endl;
+				Broadcast_access_serviced_signal(current_access->lba, current_access->initiate_time);
 				//hi->Notify_CXL_Host_request_complete();
 				totalcount++;
 			}
@@ -112,6 +115,8 @@ namespace SSD_Components {
 			//hi->Update_CXL_DRAM_state_when_miss_data_ready(current_access->rw, current_access->lba);
 			//outputf.of << "Finished_time " << Simulator->Time()  << " Starting_time " << current_access->initiate_time << " Cache_miss_at " << current_access->lba << std::endl;
 			oflate << Simulator->Time() - current_access->initiate_time << endl;
+			record_miss_latency(Simulator->Time() - current_access->initiate_time);
+			Broadcast_access_serviced_signal(current_access->lba, current_access->initiate_time);
 			//hi->Notify_CXL_Host_request_complete();
 			totalcount++;
 			delete current_access;
@@ -131,6 +136,7 @@ namespace SSD_Components {
 			//hi->Update_CXL_DRAM_state_when_miss_data_ready(current_access->rw, current_access->lba);
 			//outputf.of << "Finished_time " << Simulator->Time() << " Starting_time " << current_access->initiate_time << " Slow_prefetch_at " << current_access->lba << std::endl;
 			oflate << Simulator->Time() - current_access->initiate_time << endl;
+			Broadcast_access_serviced_signal(current_access->lba, current_access->initiate_time);
 			//hi->Notify_CXL_Host_request_complete();
 			totalcount++;
 			delete current_access;
@@ -210,6 +216,7 @@ namespace SSD_Components {
 				std::cout << "Total Flash Read Count: " << flash_read_count + prefetch_amount << endl;
 				of_overall << "Total Flash Read Count: " << flash_read_count + prefetch_amount << endl;
 			}
+			print_miss_latency_histogram();
 			//std::cout << "Flush count: " << hi->Get_flush_count() << endl;
 			//std::cout << "Request ends at timestamp: " << static_cast<float>(Simulator->Time()) / 1000000000 << " s" << endl;
 			hi->print_prefetch_info();
@@ -232,6 +239,76 @@ namespace SSD_Components {
 
 
 
+	void CXL_DRAM_Model::Connect_to_access_serviced_signal(AccessServicedSignalHandlerType function) {
+		connected_access_serviced_signal_handlers.push_back(function);
+	}
+
+	void CXL_DRAM_Model::Broadcast_access_serviced_signal(uint64_t lba, sim_time_type initiate_time) {
+		for (auto handler : connected_access_serviced_signal_handlers) {
+			handler(lba, initiate_time);
+		}
+	}
+
+	void CXL_DRAM_Model::record_miss_latency(sim_time_type latency) {
+		sim_time_type latency_us{ latency / 1000 };
+		unsigned int bucket{ 0 };
+		while (latency_us > 0 && bucket < miss_latency_bucket_count - 1) {
+			latency_us >>= 1;
+			bucket++;
+		}
+		miss_latency_histogram[bucket]++;
+		miss_latency_sum += latency;
+		if (latency > miss_latency_max) miss_latency_max = latency;
+
+		unsigned int fine_bucket{ (unsigned int)latency };
+		if (latency >= (1ULL << miss_latency_sub_bucket_bits)) {
+			unsigned int exponent{ miss_latency_sub_bucket_bits };
+			while ((latency >> (exponent + 1)) > 0) exponent++;
+			unsigned int sub_bucket{ (unsigned int)(latency >> (exponent - miss_latency_sub_bucket_bits)) & ((1 << miss_latency_sub_bucket_bits) - 1) };
+			fine_bucket = ((exponent - miss_latency_sub_bucket_bits + 1) << miss_latency_sub_bucket_bits) + sub_bucket;
+		}
+		miss_latency_fine_histogram[fine_bucket]++;
+		miss_latency_count++;
+	}
+
+	//Returns the upper bound of the bucket that holds the percentile, or the maximum latency if it is smaller
+	sim_time_type CXL_DRAM_Model::miss_latency_percentile(double percentile) {
+		uint64_t rank{ (uint64_t)std::ceil(percentile / 100 * miss_latency_count) };
+		if (rank == 0) rank = 1;
+		uint64_t count{ 0 };
+		for (unsigned int fine_bucket = 0; fine_bucket < miss_latency_fine_bucket_count; fine_bucket++) {
+			count += miss_latency_fine_histogram[fine_bucket];
+			if (count < rank) continue;
+			if (fine_bucket < (1U << miss_latency_sub_bucket_bits)) return fine_bucket;
+			unsigned int exponent{ (fine_bucket >> miss_latency_sub_bucket_bits) + miss_latency_sub_bucket_bits - 1 };
+			unsigned int sub_bucket{ fine_bucket & ((1 << miss_latency_sub_bucket_bits) - 1) };
+			sim_time_type upper{ ((sim_time_type)((1 << miss_latency_sub_bucket_bits) + sub_bucket + 1) << (exponent - miss_latency_sub_bucket_bits)) - 1 };
+			return upper < miss_latency_max ? upper : miss_latency_max;
+		}
+		return miss_latency_max;
+	}
+
+	void CXL_DRAM_Model::print_miss_latency_histogram() {
+		if (flash_read_count == 0) return;
+
+		of_overall << "Cache miss latency (ns): average " << miss_latency_sum / flash_read_count << "   max " << miss_latency_max << endl;
+		if (miss_latency_count > 0) {
+			of_overall << "Cache miss latency percentiles (ns): p50 " << miss_latency_percentile(50) << "   p99 " << miss_latency_percentile(99)
+				<< "   p99.9 " << miss_latency_percentile(99.9) << endl;
+		}
+		of_overall << "Cache miss latency histogram (us):" << endl;
+		for (unsigned int bucket = 0; bucket < miss_latency_bucket_count; bucket++) {
+			if (miss_latency_histogram[bucket] == 0) continue;
+			uint64_t low{ bucket == 0 ? 0 : (uint64_t)1 << (bucket - 1) };
+			if (bucket == miss_latency_bucket_count - 1) {
+				of_overall << "  [" << low << ", inf): " << miss_latency_histogram[bucket] << endl;
+			}
+			else {
+				of_overall << "  [" << low << ", " << ((uint64_t)1 << bucket) << "): " << miss_latency_histogram[bucket] << endl;
+			}
+		}
+	}
+
 	void CXL_DRAM_Model::service_cxl_dram_access(CXL_DRAM_ACCESS* request) {
 		if (dram_is_busy) {
 			request->arrive_dram_time = Simulator->Time();
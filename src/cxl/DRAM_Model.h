@@ -3,6 +3,7 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <vector>
 #include "../sim/Sim_Object.h"
 #include "../sim/Sim_Reporter.h"
 #include "../ssd/User_Request.h"
@@ -59,14 +60,33 @@ namespace SSD_Components {
 
 		void Execute_simulator_event(MQSimEngine::Sim_Event* ev);
 
+		//Fired for every host access that the device completes, identified by its lba and the time it entered the device
+		typedef void(*AccessServicedSignalHandlerType) (uint64_t lba, sim_time_type initiate_time);
+		void Connect_to_access_serviced_signal(AccessServicedSignalHandlerType function);
+		void Broadcast_access_serviced_signal(uint64_t lba, sim_time_type initiate_time);
+
 		bool dram_is_busy{ 0 }; 
 
 		uint64_t getDRAMAvailability();
+		uint64_t getQueueDepth() { return waiting_request_queue->size() + num_working_request; }
 
 		uint64_t cache_miss_count{ 0 }, cache_hum_count{ 0 },cache_hit_count{ 0 }, total_number_of_requests{ 0 }, flash_read_count{ 0 }, number_of_accesses{0}, prefetch_amount{0};
 		float perc{ 1 };
 		bool results_printed{ 0 };
 
+		//Latency distribution of the accesses that missed in the DRAM cache and were served by the flash back end
+		static const unsigned int miss_latency_bucket_count{ 24 };//Power-of-two buckets in microseconds: [0,1), [1,2), [2,4), ...
+		uint64_t miss_latency_histogram[miss_latency_bucket_count]{};
+		sim_time_type miss_latency_sum{ 0 }, miss_latency_max{ 0 };
+		//Log-linear buckets in nanoseconds for the percentiles: 16 buckets per power of two, which bounds the error to 1/16
+		static const unsigned int miss_latency_sub_bucket_bits{ 4 };
+		static const unsigned int miss_latency_fine_bucket_count{ (64 - miss_latency_sub_bucket_bits + 1) << miss_latency_sub_bucket_bits };
+		uint64_t miss_latency_fine_histogram[miss_latency_fine_bucket_count]{};
+		uint64_t miss_latency_count{ 0 };
+		void record_miss_latency(sim_time_type latency);
+		sim_time_type miss_latency_percentile(double percentile);
+		void print_miss_latency_histogram();
+
 	private:
 		unsigned int dram_row_size{0};//The size of the DRAM rows in bytes
 		unsigned int dram_data_rate{0};//in MT/s
@@ -82,6 +102,7 @@ namespace SSD_Components {
 		std::map<sim_time_type, list<CXL_DRAM_ACCESS*>>* list_of_current_access{ NULL };
 		uint64_t num_working_request{ 0 };
 		uint64_t num_chan{ 1 };
+		std::vector<AccessServicedSignalHandlerType> connected_access_serviced_signal_handlers;
 
 		
 
@@ -1,3 +1,4 @@
+#include "../sim/Sim_Defs.h"
 #include "DRAM_Subsystem.h"
 
 void lruTwoListClass::init(uint64_t numCL) {
@@ -313,7 +314,8 @@ namespace SSD_Components {
 	}
 
 	void dram_subsystem::initDRAM() {
-		dram_mapping = new map<uint64_t, uint64_t>;
+		dram_mapping = new unordered_map<uint64_t, uint64_t>;
+		dram_mapping->reserve(cpara.cache_portion_size / cpara.ssd_page_size);
 
 		uint64_t cache_page_number{ 0 };
 		all_freeCL = new vector<list<uint64_t>*>;
@@ -391,7 +393,7 @@ namespace SSD_Components {
 		dirtyCL = new map<uint64_t, uint64_t>;
 		
 		if (cpara.prefetch_policy != prefetchertype::no && !cpara.mix_mode) {
-			pref_dram_mapping = new map<uint64_t, uint64_t>;
+			pref_dram_mapping = new unordered_map<uint64_t, uint64_t>;
 			pref_freeCL = new list<uint64_t>;
 			pref_dirtyCL = new map<uint64_t, uint64_t>;
 		}
@@ -654,11 +656,11 @@ namespace SSD_Components {
 
 
 
-	void dram_subsystem::process_miss_data_ready_new(bool rw, uint64_t lba, list<uint64_t>* flush_lba, uint64_t simtime, set<uint64_t>* prefetched_lba, set<uint64_t>&taggedAddr, set<uint64_t>& prefetch_pollution_tracker,  set<uint64_t> not_finished) {
+	void dram_subsystem::process_miss_data_ready_new(bool rw, uint64_t lba, list<uint64_t>* flush_lba, uint64_t simtime, set<uint64_t>* prefetched_lba, set<uint64_t>&taggedAddr, prefetch_accounting& accounting, const set<uint64_t>& not_finished, list<uint64_t>* flush_write_count) {
 
 
 		list<uint64_t>* temp_freeCL{NULL};
-		map<uint64_t, uint64_t>* temp_dram_mapping{ NULL };
+		unordered_map<uint64_t, uint64_t>* temp_dram_mapping{ NULL };
 		map<uint64_t, uint64_t>* temp_dirtyCL{ NULL };
 		//set<uint64_t>* temp_cachedlba{ NULL };
 		vector<uint64_t>* temp_cachedlba{ NULL };
@@ -812,7 +814,7 @@ namespace SSD_Components {
 			}
 			else {
 				if (prefetched_lba->count(lba)) {
-					prefetch_pollution_tracker.insert(evict_lba_base_addr);
+					accounting.polluting_eviction(evict_lba_base_addr);
 				}
 			}
 			
@@ -822,6 +824,9 @@ namespace SSD_Components {
 
 			if (temp_dirtyCL->count(cl) > 0) {
 				flush_lba->push_back(evict_lba_base_addr);
+				if (flush_write_count) {
+					flush_write_count->push_back((*temp_dirtyCL)[cl]);
+				}
 				//evictf.of << evict_lba_base_addr << endl;
 				temp_dirtyCL->erase(cl);
 				flush_count++;
@@ -896,9 +901,65 @@ namespace SSD_Components {
 
 
 	uint64_t dram_subsystem::get_cache_index(uint64_t lba) {
+		if (partitions.size() > 0) {
+			for (auto& partition : partitions) {
+				if (lba <= partition.last_lba) {
+					return partition.first_set + lba % partition.set_count;
+				}
+			}
+			return partitions.back().first_set + lba % partitions.back().set_count;
+		}
 		return lba % (cpara.cache_portion_size / cpara.ssd_page_size / cpara.set_associativity);
 	}
 
+	//Gives each host a contiguous range of sets in proportion to its share (in percent). The hosts without a share split
+	//what is left, and the sets that remain after rounding are handed out one by one. The windows are in ascending order.
+	void dram_subsystem::partition_sets(const vector<pair<uint64_t, uint64_t>>& lba_windows, const vector<uint64_t>& shares) {
+		uint64_t set_count{ cpara.cache_portion_size / cpara.ssd_page_size / cpara.set_associativity };
+		uint64_t share_sum{ 0 }, unlisted_hosts{ 0 };
+		for (auto share : shares) {
+			share_sum += share;
+			if (share == 0) {
+				unlisted_hosts++;
+			}
+		}
+		if (share_sum > 100) {
+			PRINT_ERROR("DRAM subsystem: the cache shares of the hosts add up to more than 100%!")
+		}
+		if (lba_windows.size() > set_count) {
+			PRINT_ERROR("DRAM subsystem: there are more hosts than cache sets!")
+		}
+
+		vector<uint64_t> set_counts;
+		uint64_t assigned_sets{ 0 };
+		for (auto share : shares) {
+			double percentage{ share > 0 ? (double)share : (double)(100 - share_sum) / unlisted_hosts };
+			uint64_t count{ (uint64_t)(set_count * percentage / 100) };
+			if (count == 0) {
+				count = 1;
+			}
+			set_counts.push_back(count);
+			assigned_sets += count;
+		}
+		if (assigned_sets > set_count) {
+			PRINT_ERROR("DRAM subsystem: the cache is too small for the shares of the hosts!")
+		}
+		for (uint64_t i = 0; assigned_sets < set_count; i++, assigned_sets++) {
+			set_counts[i % set_counts.size()]++;
+		}
+
+		partitions.clear();
+		uint64_t first_set{ 0 };
+		for (uint64_t i = 0; i < lba_windows.size(); i++) {
+			set_partition partition;
+			partition.last_lba = lba_windows[i].second;
+			partition.first_set = first_set;
+			partition.set_count = set_counts[i];
+			partitions.push_back(partition);
+			first_set += set_counts[i];
+		}
+	}
+
 
 }
 
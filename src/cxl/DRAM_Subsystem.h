@@ -4,12 +4,14 @@
 #include <iostream>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <list>
 #include "CXL_Config.h"
 #include "OutputLog.h"
 #include "lrfu_heap.h"
 #include "CFLRU.h"
+#include "Prefetch_Accounting.h"
 
 class lruTwoListClass {
 private:
@@ -64,17 +66,19 @@ namespace SSD_Components {
 
 		void process_cache_hit(bool rw, uint64_t lba, bool& falsehit);
 		//void process_miss_data_ready(bool rw, uint64_t lba, list<uint64_t>* flush_lba, uint64_t simtime, set<uint64_t>* prefetched_lba);
-		void process_miss_data_ready_new(bool rw, uint64_t lba, list<uint64_t>* flush_lba, uint64_t simtime, set<uint64_t>* prefetched_lba, set<uint64_t>& taggedAddr, set<uint64_t>& prefetch_pollution_tracker, set<uint64_t> not_finished);
+		//flush_write_count receives the number of writes that each flushed line absorbed in the cache
+		void process_miss_data_ready_new(bool rw, uint64_t lba, list<uint64_t>* flush_lba, uint64_t simtime, set<uint64_t>* prefetched_lba, set<uint64_t>& taggedAddr, prefetch_accounting& accounting, const set<uint64_t>& not_finished, list<uint64_t>* flush_write_count = NULL);
 
 		bool is_next_evict_candidate(uint64_t lba);
 
 		uint64_t get_cache_index(uint64_t lba);
+		void partition_sets(const vector<pair<uint64_t, uint64_t>>& lba_windows, const vector<uint64_t>& shares);
 
 		uint64_t eviction_count{ 0 }, flush_count{0};
 
 	private:
 		cxl_config cpara;
-		map<uint64_t, uint64_t>* dram_mapping{ NULL }; // LBA, cache line index
+		unordered_map<uint64_t, uint64_t>* dram_mapping{ NULL }; // LBA, cache line index
 
 
 		list<uint64_t>* freeCL{ NULL }; // aligned by ssd block size
@@ -100,7 +104,7 @@ namespace SSD_Components {
 
 		//For mix seoeration mode
 
-		map<uint64_t, uint64_t>* pref_dram_mapping{ NULL };
+		unordered_map<uint64_t, uint64_t>* pref_dram_mapping{ NULL };
 		list<uint64_t>* pref_freeCL{ NULL };
 
 		set<uint64_t>* pref_cachedlba{ NULL };//for random 
@@ -113,6 +117,15 @@ namespace SSD_Components {
 		uint64_t* next_eviction_candidate{ NULL };
 		uint64_t* pref_next_eviction_candidate{ NULL };
 
+		//Cache sets reserved for the lines of each host, empty if the hosts share all sets
+		class set_partition {
+		public:
+			uint64_t last_lba;
+			uint64_t first_set;
+			uint64_t set_count;
+		};
+		vector<set_partition> partitions;
+
 	};
 
 
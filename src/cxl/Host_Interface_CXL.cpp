@@ -1,9 +1,13 @@
 
 #include <stdexcept>
+#include <algorithm>
 #include "../sim/Engine.h"
 #include "Host_Interface_CXL.h"
 #include "../ssd/NVM_Transaction_Flash_RD.h"
 #include "../ssd/NVM_Transaction_Flash_WR.h"
+#include "../ssd/Stats.h"
+#include "../ssd/TSU_Base.h"
+#include "../ssd/Address_Mapping_Unit_Page_Level.h"
 #include <fstream>
 
 //ofstream ofFlush{ "Flush_initiation_time.txt" };
@@ -15,24 +19,17 @@ ofstream oflat_no_cache{ "./Results/latency_results_no_cache.txt" };
 ofstream ofrepeated_access{ "./Results/repeated_access.txt" };
 ofstream of_delta{ "Prediction_delta.txt" };
 
-class prefetch_info_node {
-public:
-	uint64_t hit_count{ 0 };
-	bool late{ 0 };
-};
-
-map<uint64_t, prefetch_info_node> PREFETCH_INFO_MAP;
-map<uint64_t, prefetch_info_node> PREFETCH_INFO_MAP_SAMPLE;
-uint64_t LAST_CACHE_MISS{ 0 }, LAST_POLLUTION{ 0 }, LAST_PREFETCH{0};
-
-
-set<uint64_t> PREFETCH_ACCURACY_INFO;
-set<uint64_t> PREFETCH_LATE_INFO;
 namespace SSD_Components
 {
+	CXL_Manager* CXL_Manager::instance = NULL;
 
 	CXL_Manager::CXL_Manager(Host_Interface_Base* hosti) {
-		cxl_config_para.readConfigFile();
+		if (cxl_config::preset != NULL) {
+			cxl_config_para = *cxl_config::preset;
+		}
+		else {
+			cxl_config_para.readConfigFile();
+		}
 
 		dram = new dram_subsystem{ cxl_config_para };
 		dram->initDRAM();
@@ -40,10 +37,40 @@ namespace SSD_Components
 		mshr = new cxl_mshr;
 		prefetched_lba = new set<uint64_t>;
 		in_progress_prefetch_lba = new map<uint64_t, uint64_t>;
+		accounting = new prefetch_accounting{ cxl_config_para.prefetch_sampled_sets, cxl_config_para.prefetch_sampled_ways,
+			cxl_config_para.prefetch_sampling_interval, cxl_config_para.accounting_window };
+		if (cxl_config_para.epoch_length > 0) {
+			epoch_sampler = new cxl_epoch_sampler{ this, ((Host_Interface_CXL*)hi)->cxl_dram, cxl_config_para.epoch_length };
+		}
+		if (cxl_config_para.phase_window > 0 && cxl_config_para.has_cache && cxl_config_para.prefetch_policy != prefetchertype::no) {
+			phase_controller = new cxl_phase_controller{ cxl_config_para.phase_window, cxl_config_para.phase_miss_rate_threshold, cxl_config_para.prefetch_policy };
+		}
+		if (cxl_config_para.sampling_interval > 0) {
+			trace_sampler = new cxl_trace_sampler{ this, cxl_config_para.sampling_interval, cxl_config_para.sampling_clusters };
+		}
+		if (cxl_config_para.placement_heat_window == 0) {
+			cxl_config_para.placement_heat_window = max<uint64_t>(cxl_config_para.cache_portion_size / cxl_config_para.ssd_page_size, 1);
+		}
+
+		if (cxl_config_para.stream_striping != "No") {
+			//In the order of Flash_Plane_Allocation_Scheme_Type
+			const string orders[]{ "CWDP", "CWPD", "CDWP", "CDPW", "CPWD", "CPDW", "WCDP", "WCPD", "WDCP", "WDPC", "WPCD", "WPDC",
+				"DCWP", "DCPW", "DWCP", "DWPC", "DPCW", "DPWC", "PCWD", "PCDW", "PWCD", "PWDC", "PDCW", "PDWC" };
+			auto order = find(begin(orders), end(orders), cxl_config_para.stream_striping);
+			if (order == end(orders)) {
+				PRINT_ERROR("Unknown stream striping order " << cxl_config_para.stream_striping << " in config.txt!")
+			}
+			Address_Mapping_Unit_Page_Level::Stripe_by_lpa((Flash_Plane_Allocation_Scheme_Type)(order - begin(orders)));
+		}
 
 		((Host_Interface_CXL*)hi)->cxl_dram->total_number_of_requests = cxl_config_para.total_number_of_requets;
+		((Host_Interface_CXL*)hi)->cxl_dram->Connect_to_access_serviced_signal(handle_access_serviced);
+		instance = this;
 	}
 	CXL_Manager::~CXL_Manager() {
+		if (instance == this) {
+			instance = NULL;
+		}
 		if (dram) {
 			delete dram;
 		}
@@ -54,10 +81,157 @@ namespace SSD_Components
 			prefetched_lba->clear();
 			delete prefetched_lba;
 		}
+		if (accounting) {
+			delete accounting;
+		}
+		if (epoch_sampler) {
+			delete epoch_sampler;
+		}
+		if (phase_controller) {
+			delete phase_controller;
+		}
+		if (trace_sampler) {
+			delete trace_sampler;
+		}
+	}
+	//Streams are created in the order of the host IO flows, so the stream ID of a host is its flow ID
+	void CXL_Manager::Add_stream(LHA_type start_lsa, LHA_type end_lsa) {
+		cxl_stream_context stream;
+		stream.start_lsa = start_lsa;
+		stream.end_lsa = end_lsa;
+		streams.push_back(stream);
+
+		if (cxl_config_para.host_cache_shares.size() > 0 && cxl_config_para.has_cache && !cxl_config_para.dram_mode) {
+			vector<pair<uint64_t, uint64_t>> lba_windows;
+			vector<uint64_t> shares;
+			for (uint16_t stream_id = 0; stream_id < streams.size(); stream_id++) {
+				lba_windows.push_back(make_pair(streams[stream_id].start_lsa / cxl_config_para.num_sec, streams[stream_id].end_lsa / cxl_config_para.num_sec));
+				shares.push_back(stream_id < cxl_config_para.host_cache_shares.size() ? cxl_config_para.host_cache_shares[stream_id] : 0);
+			}
+			dram->partition_sets(lba_windows, shares);
+		}
+	}
+
+	//The windows of the streams do not overlap, so a cache line belongs to exactly one host
+	uint16_t CXL_Manager::stream_of(uint64_t lba) {
+		for (uint16_t stream_id = 1; stream_id < streams.size(); stream_id++) {
+			if (lba * cxl_config_para.num_sec < streams[stream_id].start_lsa) {
+				return stream_id - 1;
+			}
+		}
+
+		return (uint16_t)(streams.size() - 1);
+	}
+
+	/*
+	* The heat of a line adds up the writes that it absorbed in the cache before each flush, and halves every placement_heat_window
+	* flushes of the cache. A line whose heat is in [2^k, 2^(k+1)) gets placement ID k, so the lines that are rewritten often are
+	* kept apart from the cold ones in the write frontiers of the device. The lines whose heat has decayed to 0 are dropped once
+	* per window, so a line is only tracked for a few windows after its last flush.
+	*/
+	placement_id_type CXL_Manager::placement_of_flush(uint64_t lba, uint64_t write_count) {
+		placement_id_type placement_id{ 0 };
+		switch (cxl_config_para.write_placement) {
+		case writeplacement::hotness:
+		{
+			if (flush_count - flush_heat_swept_at >= cxl_config_para.placement_heat_window) {
+				for (auto it = flush_heat.begin(); it != flush_heat.end();) {
+					uint64_t halvings{ (flush_count - it->second.second) / cxl_config_para.placement_heat_window };
+					if (halvings >= 64 || (it->second.first >> halvings) == 0) {
+						it = flush_heat.erase(it);
+					}
+					else {
+						it++;
+					}
+				}
+				flush_heat_swept_at = flush_count;
+			}
+			pair<uint64_t, uint64_t>& heat{ flush_heat[lba] };
+			uint64_t halvings{ (flush_count - heat.second) / cxl_config_para.placement_heat_window };
+			heat.first = (halvings < 64 ? heat.first >> halvings : 0) + write_count;
+			heat.second = flush_count;
+			while (placement_id < MAX_PLACEMENT_HANDLES - 1 && (heat.first >> (placement_id + 1)) > 0) {
+				placement_id++;
+			}
+			break;
+		}
+		case writeplacement::host:
+			placement_id = stream_of(lba);
+			break;
+		default:
+			break;
+		}
+
+		if (placement_id >= flush_count_per_placement.size()) {
+			flush_count_per_placement.resize(placement_id + 1, 0);
+		}
+		flush_count_per_placement[placement_id]++;
+		return placement_id;
+	}
+
+	//Each host addresses the device from zero, its accesses are placed in the window of its stream
+	LHA_type CXL_Manager::device_lsa(uint64_t address, const cxl_stream_context& stream) {
+		LHA_type num_sec{ cxl_config_para.num_sec };
+
+		//No translate
+		//LHA_type lba{ address };
+		//translate 
+		// 4096 is the page size
+		LHA_type lsa{ address / (num_sec * 512) * num_sec }; //stream alignment will be done when dealing with transaction segmentation
+
+		if (stream.start_lsa > 0 || lsa > stream.end_lsa) {
+			lsa = stream.start_lsa + (lsa > stream.end_lsa - stream.start_lsa ? lsa % (stream.end_lsa - stream.start_lsa) : lsa);
+		}
+
+		return lsa;
 	}
+
+	void CXL_Manager::handle_access_serviced(uint64_t lba, sim_time_type initiate_time) {
+		if (instance == NULL) {
+			return;
+		}
+		sim_time_type latency{ Simulator->Time() - initiate_time };
+		if (instance->epoch_sampler) {
+			instance->epoch_sampler->access_serviced(latency);
+		}
+		if (instance->streams.size() == 0) {
+			return;
+		}
+		uint16_t stream_id{ instance->stream_of(lba) };
+		if (instance->trace_sampler) {
+			instance->trace_sampler->access_serviced(stream_id, initiate_time, latency);
+		}
+		cxl_stream_context& stream{ instance->streams[stream_id] };
+		stream.serviced_count++;
+		stream.latency_sum += latency;
+		if (latency > stream.latency_max) {
+			stream.latency_max = latency;
+		}
+		stream.last_service_time = Simulator->Time();
+	}
+
+	void CXL_Manager::print_stream_statistics() {
+		if (streams.size() < 2) {
+			return;
+		}
+		for (uint16_t stream_id = 0; stream_id < streams.size(); stream_id++) {
+			cxl_stream_context& stream{ streams[stream_id] };
+			sim_time_type active_time{ stream.last_service_time - stream.first_access_time };
+			double bandwidth{ active_time == 0 ? 0 : static_cast<double>(stream.serviced_count) * 64 / active_time };//64B cache lines, bytes per ns = GB/s
+			std::cout << "Host " << stream_id << ": accesses " << stream.access_count << "   cache hits " << stream.cache_hit_count << "   cache misses " << stream.cache_miss_count
+				<< "   prefetch hits " << stream.prefetch_hit_count << endl;
+			of_overall << "Host " << stream_id << ": accesses " << stream.access_count << "   cache hits " << stream.cache_hit_count << "   cache misses " << stream.cache_miss_count
+				<< "   prefetch hits " << stream.prefetch_hit_count << endl;
+			std::cout << "Host " << stream_id << ": average latency " << (stream.serviced_count == 0 ? 0 : stream.latency_sum / stream.serviced_count) << " ns   max latency "
+				<< stream.latency_max << " ns   bandwidth " << bandwidth << " GB/s" << endl;
+			of_overall << "Host " << stream_id << ": average latency " << (stream.serviced_count == 0 ? 0 : stream.latency_sum / stream.serviced_count) << " ns   max latency "
+				<< stream.latency_max << " ns   bandwidth " << bandwidth << " GB/s" << endl;
+		}
+	}
+
 	int CXL_Manager::prefetch_feedback() {
-		double paccuracy{ static_cast<double>(PREFETCH_ACCURACY_INFO.size()) / static_cast<double>(PREFETCH_INFO_MAP.size()) };
-		double plateness{ static_cast<double>(PREFETCH_LATE_INFO.size()) / static_cast<double>(PREFETCH_INFO_MAP.size()) };
+		double paccuracy{ accounting->window_accuracy() };
+		double plateness{ accounting->window_late_fraction() };
 		double pollution{ static_cast<double>(prefetch_pollution_count) / static_cast<double>(cache_miss_count) };
 
 		if (paccuracy >= accuracy_high && plateness >= late_thresh && pollution < pollution_thresh) {
@@ -99,19 +273,48 @@ namespace SSD_Components
 
 		return 0;
 	}
-	void CXL_Manager::prefetch_decision_maker(uint64_t lba, bool isMiss, uint64_t prefetch_hit_count) {
+
+	//Called at the end of each window of the phase controller
+	void CXL_Manager::reconfigure_prefetching() {
+		int action{ prefetch_feedback() };
+		prefetchertype policy{ phase_controller->select_prefetcher(cxl_config_para.prefetch_policy) };
+		cxl_config_para.prefetch_policy = policy;
+
+		//The tagged prefetcher is tuned through its level, the feedback-directed one tunes itself
+		if (policy == prefetchertype::tagged) {
+			for (auto& stream : streams) {
+				stream.prefetch_level += action;
+				if (stream.prefetch_level > 4) stream.prefetch_level = 4;
+				if (stream.prefetch_level < 0) stream.prefetch_level = 0;
+				stream.prefetchK = prefetch_aggre[stream.prefetch_level][0];
+				stream.prefetch_timing_offset = prefetch_aggre[stream.prefetch_level][1];
+			}
+		}
+
+		//The prefetch partition of the cache grows with useful prefetches and shrinks with useless or polluting ones
+		if (action > 0 && prefetch_share < 1) {
+			prefetch_share *= 2;
+		}
+		else if (action < 0 && prefetch_share > 1.0 / 16) {
+			prefetch_share /= 2;
+		}
+		prefetch_line_limit = prefetch_share < 1 ? static_cast<uint64_t>(prefetch_share * (cxl_config_para.cache_portion_size / cxl_config_para.ssd_page_size)) : 0;
+
+		phase_controller->log_decision(policy, streams.size() > 0 ? streams[0].prefetch_level : 0, prefetch_share);
+	}
+	void CXL_Manager::prefetch_decision_maker(uint64_t lba, bool isMiss, cxl_stream_context& stream) {
 		list<uint64_t> prefetchlba;
 
 		/*if (mshr->getSize() < 5 || flash_back_end_queue_size - flash_back_end_access_count - 1 < 9) {
 			return;
 		}*/
 		
-		if (in_progress_prefetch_lba->size() == prefetch_queue_size || flash_back_end_queue_size - flash_back_end_access_count < 1 + 1 + 0 ) {
-			previous_unused_lba = lba;
+		if (!functional && (in_progress_prefetch_lba->size() == prefetch_queue_size || flash_back_end_queue_size - flash_back_end_access_count < 1 + 1 + 0)) {
+			stream.previous_unused_lba = lba;
 			return;
 		}
 		
-		if (cxl_config_para.prefetch_policy == prefetchertype::no) {
+		if (cxl_config_para.prefetch_policy == prefetchertype::no || (prefetch_line_limit > 0 && prefetched_lba->size() >= prefetch_line_limit)) {
 			return;
 		}
 		else if (cxl_config_para.prefetch_policy == prefetchertype::tagged || cxl_config_para.prefetch_policy == prefetchertype::feedback_direct) {
@@ -119,12 +322,12 @@ namespace SSD_Components
 			
 				int action{ prefetch_feedback() };
 
-				prefetch_level += action;
-				if (prefetch_level > 4) prefetch_level = 4;
-				if (prefetch_level < 0) prefetch_level = 0;
-				vector<uint64_t> temp{ prefetch_aggre[prefetch_level] };
-				prefetchK = temp[0];
-				prefetch_timing_offset = temp[1];
+				stream.prefetch_level += action;
+				if (stream.prefetch_level > 4) stream.prefetch_level = 4;
+				if (stream.prefetch_level < 0) stream.prefetch_level = 0;
+				vector<uint64_t> temp{ prefetch_aggre[stream.prefetch_level] };
+				stream.prefetchK = temp[0];
+				stream.prefetch_timing_offset = temp[1];
 
 			}
 			
@@ -135,10 +338,10 @@ namespace SSD_Components
 				tagAssertedLBA.insert(lba);
 			}
 
-			for (uint64_t i = 1; i <= prefetchK; i++) {
-				uint64_t plba{ lba + i + prefetch_timing_offset };
+			for (uint64_t i = 1; i <= stream.prefetchK; i++) {
+				uint64_t plba{ lba + i + stream.prefetch_timing_offset };
 				if (!dram->isCacheHit(plba) && !mshr->isInProgress(plba) && (in_progress_prefetch_lba->count(plba) == 0) &&
-					plba*8 <= ((Input_Stream_CXL*)(((Host_Interface_CXL*)hi)->input_stream_manager->input_streams[0]))->End_logical_sector_address) {
+					plba * 8 >= stream.start_lsa && plba * 8 <= stream.end_lsa) {
 					prefetchlba.push_back(plba);
 					//prefetched_lba->insert(plba);
 					//tagAssertedLBA.insert(plba);
@@ -151,36 +354,36 @@ namespace SSD_Components
 
 		}
 		else if (cxl_config_para.prefetch_policy == prefetchertype::bo) {
-			if (lba >= boPrefetcher.offsetundertest && boPrefetcher.inhistory(lba - boPrefetcher.offsetundertest)) {
-				boPrefetcher.incrementscore(boPrefetcher.offsetundertest);
+			if (lba >= stream.boPrefetcher.offsetundertest && stream.boPrefetcher.inhistory(lba - stream.boPrefetcher.offsetundertest)) {
+				stream.boPrefetcher.incrementscore(stream.boPrefetcher.offsetundertest);
 			}
 
-			boPrefetcher.addhistory(lba);
-			boPrefetcher.offsetundertest++;
-
-			if (boPrefetcher.endround()) {
-				boPrefetcher.offsetundertest = 1;
-				boPrefetcher.round++;
-				if (boPrefetcher.endlphase()) {
-					boPrefetcher.round = 0;
-					boPrefetcher.findoffsets();
-					if (boPrefetcher.olist.size() > 0) {
-						boPrefetcher.prefetch_on = 1;
+			stream.boPrefetcher.addhistory(lba);
+			stream.boPrefetcher.offsetundertest++;
+
+			if (stream.boPrefetcher.endround()) {
+				stream.boPrefetcher.offsetundertest = 1;
+				stream.boPrefetcher.round++;
+				if (stream.boPrefetcher.endlphase()) {
+					stream.boPrefetcher.round = 0;
+					stream.boPrefetcher.findoffsets();
+					if (stream.boPrefetcher.olist.size() > 0) {
+						stream.boPrefetcher.prefetch_on = 1;
 					}
 					else {
-						boPrefetcher.prefetch_on = 0;
+						stream.boPrefetcher.prefetch_on = 0;
 					}
-					boPrefetcher.resetscore();
+					stream.boPrefetcher.resetscore();
 				}
 			}
 
-			if (boPrefetcher.prefetch_on) {
-				for (auto i : boPrefetcher.olist) {
+			if (stream.boPrefetcher.prefetch_on) {
+				for (auto i : stream.boPrefetcher.olist) {
 					uint64_t plba{ lba + (i)};
 					
 
 					if (!dram->isCacheHit(plba) && !mshr->isInProgress(plba) && (in_progress_prefetch_lba->count(plba)==0)  &&
-						plba * 8 <= ((Input_Stream_CXL*)(((Host_Interface_CXL*)hi)->input_stream_manager->input_streams[0]))->End_logical_sector_address) {
+						plba * 8 >= stream.start_lsa && plba * 8 <= stream.end_lsa) {
 						prefetchlba.push_back(plba);
 						//of_delta << i << endl;
 						//prefetched_lba->insert(plba);
@@ -190,13 +393,13 @@ namespace SSD_Components
 
 		}
 		else if (cxl_config_para.prefetch_policy == prefetchertype::leap && isMiss) {
-			leapPrefetcher.historyinsert(lba);
-			int64_t offset{ leapPrefetcher.findoffset() };
+			stream.leapPrefetcher.historyinsert(lba);
+			int64_t offset{ stream.leapPrefetcher.findoffset() };
 
-			uint64_t leapprefetchK{ leapPrefetcher.getk(prefetch_hit_count) };
+			uint64_t leapprefetchK{ stream.leapPrefetcher.getk(stream.prefetch_hit_count) };
 
 			if (offset == 0) {
-				offset = leapPrefetcher.last_offset;
+				offset = stream.leapPrefetcher.last_offset;
 				for (uint64_t i = 1; i <= leapprefetchK; i++) {
 
 					uint64_t plba{ lba + i };
@@ -206,7 +409,7 @@ namespace SSD_Components
 					//check if the prefetch block is in the cache or miss map
 					//prefetcher_ol.print_offset(plba - event->lba);
 					if (!dram->isCacheHit(plba) && !mshr->isInProgress(plba) && (in_progress_prefetch_lba->count(plba) == 0) &&
-						plba * 8 <= ((Input_Stream_CXL*)(((Host_Interface_CXL*)hi)->input_stream_manager->input_streams[0]))->End_logical_sector_address) {
+						plba * 8 >= stream.start_lsa && plba * 8 <= stream.end_lsa) {
 						
 						prefetchlba.push_back(plba);
 						//prefetched_lba->insert(plba);
@@ -222,7 +425,7 @@ namespace SSD_Components
 					//check if the prefetch block is in the cache or miss map
 					//prefetcher_ol.print_offset(plba - event->lba);
 					if (!dram->isCacheHit(plba) && !mshr->isInProgress(plba) && (in_progress_prefetch_lba->count(plba) == 0) &&
-						plba * 8 <= ((Input_Stream_CXL*)(((Host_Interface_CXL*)hi)->input_stream_manager->input_streams[0]))->End_logical_sector_address) {
+						plba * 8 >= stream.start_lsa && plba * 8 <= stream.end_lsa) {
 						
 						prefetchlba.push_back(plba);
 						//prefetched_lba->insert(plba);
@@ -230,7 +433,7 @@ namespace SSD_Components
 					}
 				}
 			}
-			leapPrefetcher.last_offset = offset;
+			stream.leapPrefetcher.last_offset = offset;
 
 
 		}
@@ -246,6 +449,16 @@ namespace SSD_Components
 		//	}
 		//}
 
+		//A functional access installs its prefetches at once, without the queues of the flash back end
+		if (functional) {
+			for (auto i : prefetchlba) {
+				prefetched_lba->insert(i);
+				functional_fill(i, 1);
+				accounting->prefetch_filled(i);
+			}
+			return;
+		}
+
 		if (prefetch_queue_size - in_progress_prefetch_lba->size() < flash_back_end_queue_size - flash_back_end_access_count - 1 -0 ) {
 			if (prefetchlba.size() > prefetch_queue_size - in_progress_prefetch_lba->size()) {
 				prefetchlba.resize(prefetch_queue_size - in_progress_prefetch_lba->size());
@@ -260,36 +473,64 @@ namespace SSD_Components
 		for (auto i : prefetchlba) {
 			prefetched_lba->insert(i);
 		}
+		account_prefetch_batch(prefetchlba);
 		((Host_Interface_CXL*)hi)->process_CXL_prefetch_requests(prefetchlba);
 
 
 	}
 
 
-	bool CXL_Manager::process_requests(uint64_t address, void* payload, bool is_pref_req) {
+	//Maps the prefetches of a batch to the planes that hold them. The reads that go to a plane or a die that an earlier read of
+	//the batch takes are serialized behind it, the rest can overlap in the flash back end.
+	void CXL_Manager::account_prefetch_batch(const list<uint64_t>& prefetchlba) {
+		if (prefetchlba.empty()) {
+			return;
+		}
+
+		Input_Stream_CXL* stream{ (Input_Stream_CXL*)hi->input_stream_manager->input_streams[0] };//The stream of the flash back end
+		set<uint64_t> planes, dies;
+		for (auto lba : prefetchlba) {
+			LHA_type lsa{ lba * cxl_config_para.num_sec };
+			if (lsa < stream->Start_logical_sector_address || lsa > stream->End_logical_sector_address) {
+				lsa = stream->Start_logical_sector_address + (lsa % (stream->End_logical_sector_address - stream->Start_logical_sector_address));
+			}
+			NVM::FlashMemory::Physical_Page_Address address;
+			if (!Address_Mapping_Unit_Page_Level::Get_plane_of_lpa(0, (lsa - stream->Start_logical_sector_address) / hi->sectors_per_subpage, address)) {
+				continue;
+			}
+			uint64_t die{ ((uint64_t)address.ChannelID << 32) | ((uint64_t)address.ChipID << 16) | address.DieID };
+			prefetch_batch_read_count++;
+			if (!planes.insert((die << 16) | address.PlaneID).second) {
+				prefetch_plane_conflict_count++;
+			}
+			if (!dies.insert(die).second) {
+				prefetch_die_conflict_count++;
+			}
+		}
+		prefetch_batch_count++;
+	}
+
+	//Looks up the cache line of a host access. Returns true if the access has to be sent to the flash back end,
+	//lsa is set to the first logical sector of the line on the device.
+	bool CXL_Manager::process_requests(uint64_t address, bool rw, bool is_pref_req, uint16_t stream_id, LHA_type& lsa) {
 
 		bool cache_miss{ 1 };
+		cxl_stream_context& stream{ streams[stream_id] };
 
-		Submission_Queue_Entry* sqe = (Submission_Queue_Entry*)payload;
-		sqe->Command_specific[2] = ((uint32_t)((uint16_t)cxl_config_para.num_sec)) & (uint32_t)(0x0000ffff);
-		LHA_type memory_addr{ (((LHA_type)sqe->Command_specific[1]) << 31 | (LHA_type)sqe->Command_specific[0]) };
-		
-		//No translate
-		//LHA_type lba{ memory_addr };
-		//translate 
-		// 4096 is the page size
-		LHA_type lba{ memory_addr / (sqe->Command_specific[2]*512) }; //stream alignment will be done when dealing with transaction segmentation
-		LHA_type lsa{ lba * sqe->Command_specific[2]}; // lsa to be used for request
+		lsa = device_lsa(address, stream); // lsa to be used for request
+		LHA_type lba{ lsa / cxl_config_para.num_sec };
 
-		if (lsa < ((Input_Stream_CXL*)hi->input_stream_manager->input_streams[0])->Start_logical_sector_address || lsa >((Input_Stream_CXL*)hi->input_stream_manager->input_streams[0])->End_logical_sector_address) {
-			lsa = ((Input_Stream_CXL*)hi->input_stream_manager->input_streams[0])->Start_logical_sector_address
-				+ (lsa % (((Input_Stream_CXL*)hi->input_stream_manager->input_streams[0])->End_logical_sector_address - (((Input_Stream_CXL*)hi->input_stream_manager->input_streams[0])->Start_logical_sector_address)));
-			lba = lsa / sqe->Command_specific[2];
+		if (!is_pref_req) {
+			if (stream.access_count == 0) {
+				stream.first_access_time = Simulator->Time();
+			}
+			stream.access_count++;
 		}
 
-
-		sqe->Command_specific[0] = (uint32_t)lsa;
-		sqe->Command_specific[1] = (uint32_t)(lsa >> 32);
+		bool hit{ cxl_config_para.has_cache && (cxl_config_para.dram_mode || dram->isCacheHit(lba)) };// && !dram->is_next_evict_candidate(lba)
+		if (trace_sampler && !is_pref_req) {
+			trace_sampler->access(stream_id, hit);
+		}
 
 		if (!cxl_config_para.has_cache) {
 			//ofprefetch_chance << flash_back_end_queue_size - flash_back_end_access_count - 1 << " cm" << endl;
@@ -298,10 +539,9 @@ namespace SSD_Components
 
 
 
-		if (cxl_config_para.dram_mode || dram->isCacheHit(lba)) {// && !dram->is_next_evict_candidate(lba)
+		if (hit) {
 
 			cache_miss = 0;
-			bool rw{ (sqe->Opcode == NVME_READ_OPCODE) ? true : false };
 			CXL_DRAM_ACCESS* dram_request{ new CXL_DRAM_ACCESS{64, lba, rw, CXL_DRAM_EVENTS::CACHE_HIT, Simulator->Time()} };
 			((Host_Interface_CXL*)hi)->Send_request_to_CXL_DRAM(dram_request);
 
@@ -311,14 +551,19 @@ namespace SSD_Components
 
 			//dram->process_cache_hit(rw, lba);
 
-			if(!is_pref_req)cache_hit_count++;
+			if (!is_pref_req) {
+				cache_hit_count++;
+				stream.cache_hit_count++;
+				if (phase_controller && phase_controller->record_access(stream_id, lba, 0)) {
+					reconfigure_prefetching();
+				}
+			}
 
 			if (!is_pref_req && prefetched_lba->count(lba)) {
 				prefetch_hit_count++;
-				PREFETCH_INFO_MAP[lba].hit_count++;
-				PREFETCH_INFO_MAP_SAMPLE[lba].hit_count++;
-				PREFETCH_ACCURACY_INFO.emplace(lba);
-				prefetch_decision_maker(lba, 0, prefetch_hit_count);
+				stream.prefetch_hit_count++;
+				accounting->prefetch_used(lba, 0);
+				prefetch_decision_maker(lba, 0, stream);
 
 				if (!is_pref_req) {
 					//ofprefetch_chance << flash_back_end_queue_size - flash_back_end_access_count - 1 << " ph" << endl;
@@ -340,7 +585,7 @@ namespace SSD_Components
 			if (!cxl_config_para.has_mshr) {
 				no_mshr_record_node n;
 				n.time = Simulator->Time();
-				n.rw = (sqe->Opcode == NVME_READ_OPCODE) ? true : false;
+				n.rw = rw;
 
 				if (no_mshr_requests_record.count(lba)) {
 					no_mshr_requests_record[lba].push_back(n);
@@ -364,9 +609,11 @@ namespace SSD_Components
 
 			if (mshr->isInProgress(lba)) {
 				cache_miss = 0;
+				if (!is_pref_req && phase_controller && phase_controller->record_access(stream_id, lba, !in_progress_prefetch_lba->count(lba))) {//A merge onto an in-flight prefetch is a late prefetch hit
+					reconfigure_prefetching();
+				}
 
-				Submission_Queue_Entry* nsqe{ new Submission_Queue_Entry{*sqe} };
-				mshr->insertRequest(lba, Simulator->Time(), nsqe);
+				mshr->insertRequest(lba, Simulator->Time(), rw);
 				if (mshr->isFull()) {
 					//notify cxl pcie device is full
 					hi->Notify_CXL_Host_mshr_full();
@@ -378,15 +625,13 @@ namespace SSD_Components
 				//	cout << "Check" << endl;
 				//}
 				if (!is_pref_req && !in_progress_prefetch_lba->count(lba)) {
-					if (prefetch_pollution_tracker.count(lba)) {
+					if (accounting->demand_miss(lba)) {
 						prefetch_pollution_count++;
-						prefetch_pollution_tracker.erase(prefetch_pollution_tracker.find(lba));
 					}
 				}
 
 
-				Submission_Queue_Entry* nsqe{ new Submission_Queue_Entry{*sqe} };
-				mshr->insertRequest(lba, Simulator->Time(), nsqe);
+				mshr->insertRequest(lba, Simulator->Time(), rw);
 				if (mshr->isFull()) {
 					//notify cxl pcie device is full
 					hi->Notify_CXL_Host_mshr_full();
@@ -394,11 +639,21 @@ namespace SSD_Components
 				
 				if (in_progress_prefetch_lba->count(lba)) {
 					cache_miss = 0;
+					if (!is_pref_req && phase_controller && phase_controller->record_access(stream_id, lba, 0)) {
+						reconfigure_prefetching();
+					}
+					if (!is_pref_req && ((Input_Stream_Manager_CXL*)hi->input_stream_manager)->Promote_latency_tolerant_read(lsa)) {
+						late_prefetch_promotion_count++;
+					}
 				}
 				else {
 					if (!is_pref_req) {
 						cache_miss_count++;
-						prefetch_decision_maker(lba, 1, prefetch_hit_count);
+						stream.cache_miss_count++;
+						if (phase_controller && phase_controller->record_access(stream_id, lba, 1)) {
+							reconfigure_prefetching();
+						}
+						prefetch_decision_maker(lba, 1, stream);
 					}
 				}
 			}
@@ -450,6 +705,65 @@ namespace SSD_Components
 		return cache_miss;
 	}
 
+	//Applies a host access to the cache and the prefetcher without timing: no events are created, the missing line and the lines
+	//that it prefetches are installed at once and dirty evictions are dropped. Returns true if the access hits in the cache.
+	bool CXL_Manager::functional_access(uint64_t address, bool rw, uint16_t stream_id) {
+		cxl_stream_context& stream{ streams[stream_id] };
+		uint64_t lba{ device_lsa(address, stream) / cxl_config_para.num_sec };
+
+		if (!cxl_config_para.has_cache) {
+			return 0;
+		}
+		if (cxl_config_para.dram_mode) {
+			return 1;
+		}
+
+		functional = 1;
+		bool hit{ dram->isCacheHit(lba) };
+		if (hit) {
+			bool falsehit{ 0 };
+			dram->process_cache_hit(rw, lba, falsehit);
+			if (phase_controller && phase_controller->record_access(stream_id, lba, 0)) {
+				reconfigure_prefetching();
+			}
+			if (prefetched_lba->count(lba)) {
+				accounting->prefetch_used(lba, 0);
+				prefetch_decision_maker(lba, 0, stream);
+			}
+		}
+		else if (mshr->isInProgress(lba) || in_progress_prefetch_lba->count(lba)) {//A line that is on its way from flash is filled by the timed simulation
+			if (phase_controller && phase_controller->record_access(stream_id, lba, !in_progress_prefetch_lba->count(lba))) {
+				reconfigure_prefetching();
+			}
+		}
+		else {
+			accounting->demand_miss(lba);
+			functional_fill(lba, rw);
+			if (phase_controller && phase_controller->record_access(stream_id, lba, 1)) {
+				reconfigure_prefetching();
+			}
+			prefetch_decision_maker(lba, 1, stream);
+		}
+		functional = 0;
+
+		return hit;
+	}
+
+	void CXL_Manager::functional_fill(uint64_t lba, bool rw) {
+		list<uint64_t> flush_lba;
+		dram->process_miss_data_ready_new(rw, lba, &flush_lba, Simulator->Time(), prefetched_lba, tagAssertedLBA, *accounting, serviced_before_lba);
+		functional_flush_count += flush_lba.size();
+	}
+
+	//Records that never reach the timed simulation are taken out of the total, so the end of the run is still detected
+	void CXL_Manager::exclude_requests(uint64_t count) {
+		if (count >= cxl_config_para.total_number_of_requets) {
+			PRINT_ERROR("Total_number_of_requests should include the trace records that are not simulated in detail!")
+		}
+		cxl_config_para.total_number_of_requets -= count;
+		((Host_Interface_CXL*)hi)->cxl_dram->total_number_of_requests -= count;
+	}
+
 	void CXL_Manager::request_serviced(User_Request* request) {
 
 
@@ -471,6 +785,7 @@ namespace SSD_Components
 			flash_back_end_access_count--;
 
 			oflat_no_cache << Simulator->Time() - request->STAT_InitiationTime << endl;
+			((Host_Interface_CXL*)hi)->cxl_dram->Broadcast_access_serviced_signal(lba, request->STAT_InitiationTime);
 
 
 			total_number_of_accesses++;
@@ -500,8 +815,11 @@ namespace SSD_Components
 				std::cout << "] " << 100 << "%" << std::endl;
 				std::cout << "Flash read count: " << no_cache_flash_read_count << endl;
 				std::cout << "Flash write count: " << no_cache_flash_write_count << endl;
-				std::cout << "Unique LBA ratio: " << static_cast<float>(unique_lba.size()) / static_cast<float>(cxl_config_para.total_number_of_requets) << endl;
+				std::cout << "Unique LBA ratio: " << static_cast<float>(unique_lba.estimate()) / static_cast<float>(cxl_config_para.total_number_of_requets) << endl;
 				std::cout << "Request ends at timestamp: " << static_cast<float>(Simulator->Time()) / 1000000000 << " s" << endl;
+				print_stream_statistics();
+				if (epoch_sampler) epoch_sampler->finish();
+				if (trace_sampler) trace_sampler->print_estimate();
 			}
 			return;
 		}
@@ -532,7 +850,8 @@ namespace SSD_Components
 				((Host_Interface_CXL*)hi)->Send_request_to_CXL_DRAM(dram_request);
 
 				list<uint64_t>* flush_lba{ new list<uint64_t> };
-				dram->process_miss_data_ready_new(n.rw, lba, flush_lba, Simulator->Time(), prefetched_lba, tagAssertedLBA,prefetch_pollution_tracker,serviced_before_lba);
+				list<uint64_t> flush_write_count;
+				dram->process_miss_data_ready_new(n.rw, lba, flush_lba, Simulator->Time(), prefetched_lba, tagAssertedLBA, *accounting, serviced_before_lba, &flush_write_count);
 				if (flash_back_end_access_count >= flash_back_end_queue_size) {
 					if (flash_back_end_access_count > flash_back_end_queue_size) {
 						std::cout << "Check" << endl;
@@ -555,20 +874,8 @@ namespace SSD_Components
 					uint64_t lsa{ lba * 8 };
 
 					flush_lba->pop_front();
-					Submission_Queue_Entry* sqe{ new Submission_Queue_Entry };
-					sqe->Command_Identifier = 0;
-					sqe->Opcode = NVME_WRITE_OPCODE;
-
-					sqe->Command_specific[0] = (uint32_t)lsa;
-					sqe->Command_specific[1] = (uint32_t)(lsa >> 32);
-					sqe->Command_specific[2] = ((uint32_t)((uint16_t)cxl_config_para.num_sec)) & (uint32_t)(0x0000ffff);
-
-					sqe->PRP_entry_1 = (DATA_MEMORY_REGION);//Dummy addresses, just to emulate data read/write access
-					sqe->PRP_entry_2 = (DATA_MEMORY_REGION + 0x1000);//Dummy addresses
-
-					((Request_Fetch_Unit_CXL*)(((Host_Interface_CXL*)hi)->request_fetch_unit))->Fetch_next_request(0);
-
-					((Request_Fetch_Unit_CXL*)(((Host_Interface_CXL*)hi)->request_fetch_unit))->Process_pcie_read_message(0, sqe, sizeof(Submission_Queue_Entry));
+					((Host_Interface_CXL*)hi)->Send_request_to_flash_back_end(NVME_WRITE_OPCODE, lsa, placement_of_flush(lba, flush_write_count.front()));
+					flush_write_count.pop_front();
 
 				}
 
@@ -685,6 +992,9 @@ namespace SSD_Components
 		if (request->Type == UserRequestType::READ) {
 			((Input_Stream_CXL*)input_streams[request->Stream_id])->Waiting_user_requests.push_back(request);
 			((Input_Stream_CXL*)input_streams[request->Stream_id])->STAT_number_of_read_requests++;
+			if (request->Latency_tolerant) {
+				latency_tolerant_reads.insert(std::make_pair(request->Start_LBA, request));
+			}
 			segment_user_request(request);
 			
 			((Host_Interface_CXL*)host_interface)->broadcast_user_request_arrival_signal(request);
@@ -707,6 +1017,12 @@ namespace SSD_Components
 		stream_id_type stream_id = request->Stream_id;
 		((Input_Stream_CXL*)input_streams[request->Stream_id])->Waiting_user_requests.remove(request);
 		((Input_Stream_CXL*)input_streams[stream_id])->On_the_fly_requests--;
+		if (request->Latency_tolerant) {
+			auto entry = latency_tolerant_reads.find(request->Start_LBA);
+			if (entry != latency_tolerant_reads.end() && entry->second == request) {
+				latency_tolerant_reads.erase(entry);
+			}
+		}
 
 		//list<uint64_t>* flush_lba{ new list<uint64_t> };
 		((Host_Interface_CXL*)host_interface)->cxl_man->request_serviced(request);
@@ -763,6 +1079,27 @@ namespace SSD_Components
 		return ((Input_Stream_CXL*)this->input_streams[stream_id])->Priority_class;
 	}
 
+	//A demand access caught up with an outstanding prefetch of the same line, so the flash transactions of the prefetch
+	//are serviced as demand reads from now on. Returns true if some of them were still queued as prefetch reads in the TSU.
+	bool Input_Stream_Manager_CXL::Promote_latency_tolerant_read(LHA_type start_lba)
+	{
+		auto entry = latency_tolerant_reads.find(start_lba);
+		if (entry == latency_tolerant_reads.end()) {
+			return false;
+		}
+
+		User_Request* request = entry->second;
+		latency_tolerant_reads.erase(entry);
+		request->Latency_tolerant = false;
+		bool moved = false;
+		for (auto tr : request->Transaction_list) {
+			if (TSU_Base::Promote_prefetch_read((NVM_Transaction_Flash*)tr)) {
+				moved = true;
+			}
+		}
+		return moved;
+	}
+
 	inline void Input_Stream_Manager_CXL::inform_host_request_completed(stream_id_type stream_id, User_Request* request)
 	{
 		//((Request_Fetch_Unit_CXL*)((Host_Interface_CXL*)host_interface)->request_fetch_unit)->Send_completion_queue_element(request, ((Input_Stream_CXL *)input_streams[stream_id])->Submission_head_informed_to_host);
@@ -834,6 +1171,7 @@ namespace SSD_Components
 				//cout << user_request->Start_LBA << endl;
 				NVM_Transaction_Flash_WR* transaction = new NVM_Transaction_Flash_WR(Transaction_Source_Type::USERIO, user_request->Stream_id,
 					transaction_size * SECTOR_SIZE_IN_BYTE, lpa, user_request, 0, access_status_bitmap, CurrentTimeStamp);
+				transaction->Placement_id = user_request->Placement_id;
 				user_request->Transaction_list.push_back(transaction);
 				input_streams[user_request->Stream_id]->STAT_number_of_write_transactions++;
 			}
@@ -930,6 +1268,7 @@ namespace SSD_Components
 				new_reqeust->Start_LBA = ((LHA_type)sqe->Command_specific[1]) << 31 | (LHA_type)sqe->Command_specific[0];//Command Dword 10 and Command Dword 11
 				new_reqeust->SizeInSectors = sqe->Command_specific[2] & (LHA_type)(0x0000ffff);
 				new_reqeust->Size_in_byte = new_reqeust->SizeInSectors * SECTOR_SIZE_IN_BYTE;
+				new_reqeust->Latency_tolerant = ((sqe->Command_specific[3] >> 4) & 0x3) == NVME_DSM_LATENCY_IDLE;
 				hi->cxl_man->flash_read_count++;
 				hi->cxl_man->flash_back_end_access_count++;
 				break;
@@ -939,6 +1278,9 @@ namespace SSD_Components
 				//cout << new_reqeust->Start_LBA << endl;
 				new_reqeust->SizeInSectors = sqe->Command_specific[2] & (LHA_type)(0x0000ffff);
 				new_reqeust->Size_in_byte = new_reqeust->SizeInSectors * SECTOR_SIZE_IN_BYTE;
+				if (((sqe->Command_specific[2] >> 20) & 0xf) == NVME_DTYPE_DATA_PLACEMENT) {
+					new_reqeust->Placement_id = (placement_id_type)(sqe->Command_specific[3] >> 16);
+				}
 				hi->cxl_man->flash_back_end_access_count++;
 				break;
 			default:
@@ -1034,9 +1376,63 @@ namespace SSD_Components
 		delete cxl_dram;
 	}
 
+	//An NVMe-style host that talks to the device through PCIe messages: the command is unpacked into a CXL.mem transaction
+	void Host_Interface_CXL::Consume_pcie_message(Host_Components::PCIe_Message* message)
+	{
+		Submission_Queue_Entry* sqe = (Submission_Queue_Entry*)message->Payload;
+		Host_Components::CXL_Mem_Transaction transaction;
+		transaction.Opcode = (sqe->Opcode == NVME_READ_OPCODE) ? Host_Components::CXL_Mem_Opcode::MEM_RD : Host_Components::CXL_Mem_Opcode::MEM_WR;
+		transaction.Tag = sqe->Command_Identifier;
+		transaction.Stream_id = 0;
+		transaction.Address = ((uint64_t)sqe->Command_specific[1]) << 32 | (uint64_t)sqe->Command_specific[0];
+		transaction.Issue_time = Simulator->Time();
+		delete sqe;
+		delete message;
+
+		Consume_cxl_mem_transaction(transaction);
+	}
+
+	LHA_type Host_Interface_CXL::Consume_cxl_mem_transaction(const Host_Components::CXL_Mem_Transaction& transaction)
+	{
+		bool rw{ transaction.Opcode == Host_Components::CXL_Mem_Opcode::MEM_RD };
+		LHA_type lsa;
+		if (cxl_man->process_requests(transaction.Address, rw, 0, transaction.Stream_id, lsa)) {
+			//With a device cache, a write miss fills the line from flash first and is merged in the DRAM
+			Send_request_to_flash_back_end((rw || cxl_man->cxl_config_para.has_cache) ? NVME_READ_OPCODE : NVME_WRITE_OPCODE, lsa);
+		}
+
+		return lsa / cxl_man->cxl_config_para.num_sec;
+	}
+
+	//The flash back end is driven through the NVMe request path of the SSD front end
+	//A write with a placement ID carries it as a data placement directive, and a latency-tolerant read carries an idle access latency hint
+	void Host_Interface_CXL::Send_request_to_flash_back_end(uint8_t opcode, LHA_type lsa, placement_id_type placement_id, bool latency_tolerant)
+	{
+		Submission_Queue_Entry* sqe = new Submission_Queue_Entry;
+		sqe->Command_Identifier = 0;
+		sqe->Opcode = opcode;
+		sqe->Command_specific[0] = (uint32_t)lsa;
+		sqe->Command_specific[1] = (uint32_t)(lsa >> 32);
+		sqe->Command_specific[2] = ((uint32_t)((uint16_t)cxl_man->cxl_config_para.num_sec)) & (uint32_t)(0x0000ffff);
+		sqe->Command_specific[3] = 0;
+		if (placement_id > 0) {
+			sqe->Command_specific[2] |= ((uint32_t)NVME_DTYPE_DATA_PLACEMENT) << 20;
+			sqe->Command_specific[3] = ((uint32_t)placement_id) << 16;
+		}
+		if (latency_tolerant) {
+			sqe->Command_specific[3] |= ((uint32_t)NVME_DSM_LATENCY_IDLE) << 4;
+		}
+		sqe->PRP_entry_1 = (DATA_MEMORY_REGION);//Dummy addresses, just to emulate data read/write access
+		sqe->PRP_entry_2 = (DATA_MEMORY_REGION + 0x1000);//Dummy addresses
+
+		request_fetch_unit->Fetch_next_request(0);
+		request_fetch_unit->Process_pcie_read_message(0, sqe, sizeof(Submission_Queue_Entry));
+	}
+
 	stream_id_type Host_Interface_CXL::Create_new_stream(IO_Flow_Priority_Class priority_class, LHA_type start_logical_sector_address, LHA_type end_logical_sector_address,
 		uint64_t submission_queue_base_address, uint64_t completion_queue_base_address)
 	{
+		cxl_man->Add_stream(start_logical_sector_address, end_logical_sector_address);
 		return ((Input_Stream_Manager_CXL*)input_stream_manager)->Create_new_stream(priority_class, start_logical_sector_address, end_logical_sector_address,
 			submission_queue_base_address, submission_queue_depth, completion_queue_base_address, completion_queue_depth);
 	}
@@ -1078,7 +1474,8 @@ namespace SSD_Components
 				Send_request_to_CXL_DRAM(dram_request);
 
 				list<uint64_t>* flush_lba{ new list<uint64_t> };
-				cxl_man->dram->process_miss_data_ready_new(n.rw, lba, flush_lba, Simulator->Time(), cxl_man->prefetched_lba,cxl_man->tagAssertedLBA , cxl_man->prefetch_pollution_tracker,cxl_man->serviced_before_lba);
+				list<uint64_t> flush_write_count;
+				cxl_man->dram->process_miss_data_ready_new(n.rw, lba, flush_lba, Simulator->Time(), cxl_man->prefetched_lba,cxl_man->tagAssertedLBA, *cxl_man->accounting, cxl_man->serviced_before_lba, &flush_write_count);
 				if (cxl_man->flash_back_end_access_count >= cxl_man->flash_back_end_queue_size) {
 					Notify_CXL_Host_flash_not_full();
 				}
@@ -1098,20 +1495,8 @@ namespace SSD_Components
 					uint64_t lsa{ lba * 8 };
 
 					flush_lba->pop_front();
-					Submission_Queue_Entry* sqe{ new Submission_Queue_Entry };
-					sqe->Command_Identifier = 0;
-					sqe->Opcode = NVME_WRITE_OPCODE;
-
-					sqe->Command_specific[0] = (uint32_t)lsa;
-					sqe->Command_specific[1] = (uint32_t)(lsa >> 32);
-					sqe->Command_specific[2] = ((uint32_t)((uint16_t)cxl_man->cxl_config_para.num_sec)) & (uint32_t)(0x0000ffff);
-
-					sqe->PRP_entry_1 = (DATA_MEMORY_REGION);//Dummy addresses, just to emulate data read/write access
-					sqe->PRP_entry_2 = (DATA_MEMORY_REGION + 0x1000);//Dummy addresses
-
-					((Request_Fetch_Unit_CXL*)(this->request_fetch_unit))->Fetch_next_request(0);
-
-					((Request_Fetch_Unit_CXL*)(this->request_fetch_unit))->Process_pcie_read_message(0, sqe, sizeof(Submission_Queue_Entry));
+					this->Send_request_to_flash_back_end(NVME_WRITE_OPCODE, lsa, cxl_man->placement_of_flush(lba, flush_write_count.front()));
+					flush_write_count.pop_front();
 
 				}
 
@@ -1228,51 +1613,68 @@ namespace SSD_Components
 		of_overall<< "Flush count: " << cxl_man->flush_count << endl;
 		std::cout << "Eviction count: " << cxl_man->dram->eviction_count << endl;
 		of_overall << "Eviction count: " << cxl_man->dram->eviction_count << endl;
+		if (cxl_man->cxl_config_para.write_placement != writeplacement::no) {
+			std::cout << "Flushes per placement ID:";
+			of_overall << "Flushes per placement ID:";
+			for (auto count : cxl_man->flush_count_per_placement) {
+				std::cout << " " << count;
+				of_overall << " " << count;
+			}
+			std::cout << endl;
+			of_overall << endl;
+		}
+		if (Stats::Host_write_count_subpgs > 0) {
+			//The subpages written by the host and moved by GC, per subpage written by the host
+			double write_amplification = static_cast<double>(Stats::Host_write_count_subpgs + Stats::Total_page_movements_for_gc) / Stats::Host_write_count_subpgs;
+			std::cout << "Flash write amplification: " << write_amplification << " (" << Stats::Total_page_movements_for_gc << " subpages moved by GC)" << endl;
+			of_overall << "Flash write amplification: " << write_amplification << " (" << Stats::Total_page_movements_for_gc << " subpages moved by GC)" << endl;
+		}
+		if (Stats::IssuedSuspendProgramCMD + Stats::IssuedSuspendEraseCMD > 0) {
+			std::cout << "Suspended flash programs: " << Stats::IssuedSuspendProgramCMD << "   erases: " << Stats::IssuedSuspendEraseCMD << endl;
+			of_overall << "Suspended flash programs: " << Stats::IssuedSuspendProgramCMD << "   erases: " << Stats::IssuedSuspendEraseCMD << endl;
+		}
+		if (cxl_man->prefetch_batch_count > 0) {
+			double reads_per_batch{ (double)cxl_man->prefetch_batch_read_count / cxl_man->prefetch_batch_count };
+			double plane_conflicts{ (double)cxl_man->prefetch_plane_conflict_count / cxl_man->prefetch_batch_count };
+			double die_conflicts{ (double)cxl_man->prefetch_die_conflict_count / cxl_man->prefetch_batch_count };
+			std::cout << "Prefetch batches: " << cxl_man->prefetch_batch_count << "   flash reads per batch: " << reads_per_batch
+				<< "   plane conflicts per batch: " << plane_conflicts << "   die conflicts per batch: " << die_conflicts << endl;
+			of_overall << "Prefetch batches: " << cxl_man->prefetch_batch_count << "   flash reads per batch: " << reads_per_batch
+				<< "   plane conflicts per batch: " << plane_conflicts << "   die conflicts per batch: " << die_conflicts << endl;
+		}
+		if (cxl_man->late_prefetch_promotion_count > 0) {
+			std::cout << "Late prefetches promoted to demand: " << cxl_man->late_prefetch_promotion_count << endl;
+			of_overall << "Late prefetches promoted to demand: " << cxl_man->late_prefetch_promotion_count << endl;
+		}
 
 		std::cout << "Request ends at timestamp: " << static_cast<float>(Simulator->Time()) / 1000000000 << " s" << endl;
 		of_overall << "Request ends at timestamp: " << static_cast<float>(Simulator->Time()) / 1000000000 << " s" << endl;
 		std::cout << "Repeated flash access count: " << cxl_man->repeated_flash_access_count << endl;
 		of_overall << "Repeated flash access count: " << cxl_man->repeated_flash_access_count << endl;
-		if (PREFETCH_INFO_MAP.size() == 0) return;
-
-		uint64_t accurate_prefetch{ 0 };
-		uint64_t late_prefetch{ 0 };
-
-		for (auto & i : PREFETCH_INFO_MAP) {
-			if (i.second.hit_count > 0) {
-				accurate_prefetch++;
-				if (i.second.late) {
-					late_prefetch++;
-				}
-			}
-		}
-		//uint64_t accurate_prefetch_sample{ 0 };
-		//uint64_t late_prefetch_sample{ 0 };
-		//for (auto& i : PREFETCH_INFO_MAP_SAMPLE) {
-		//	if (i.second.hit_count > 0) {
-		//		accurate_prefetch_sample++;
-		//		if (i.second.late) {
-		//			late_prefetch_sample++;
-		//		}
-		//	}
-		//}
-		/*of_overall << "Prefetch Coverage (sampled): " << static_cast<float>(cxl_man->prefetch_hit_count - LAST_PREFETCH) / static_cast<float>(43000000)<<endl;
-		of_overall << "Prefetch Accuracy (sampled): " << static_cast<float>(accurate_prefetch_sample) / static_cast<float>(PREFETCH_INFO_MAP_SAMPLE.size()+1) << endl;
-		of_overall << "Prefetch Lateness (sampled): " << static_cast<float>(late_prefetch_sample) / static_cast<float>(accurate_prefetch_sample+1) << endl;
-		of_overall << "Prefetch Pollution (sampled): " << static_cast<float>(cxl_man->prefetch_pollution_count - LAST_POLLUTION) / static_cast<float>(cxl_man->cache_miss_count - LAST_CACHE_MISS +1) << endl;
-		LAST_POLLUTION = cxl_man->prefetch_pollution_count;
-		LAST_CACHE_MISS = cxl_man->cache_miss_count;
-		LAST_PREFETCH = cxl_man->prefetch_hit_count; 
-		PREFETCH_INFO_MAP_SAMPLE.clear();*/
+		cxl_man->print_stream_statistics();
+		if (cxl_man->epoch_sampler) cxl_man->epoch_sampler->finish();
+		if (cxl_man->phase_controller) cxl_man->phase_controller->print_statistics();
+		if (cxl_man->trace_sampler) cxl_man->trace_sampler->print_estimate();
+		if (cxl_man->prefetch_issue_count == 0) return;
 
 		std::cout << "Prefetch Coverage: " << static_cast<float>(cxl_man->prefetch_hit_count) / static_cast<float>(cxl_man->cxl_config_para.total_number_of_requets) << endl;
 		of_overall << "Prefetch Coverage: " << static_cast<float>(cxl_man->prefetch_hit_count) / static_cast<float>(cxl_man->cxl_config_para.total_number_of_requets) << endl;
-		std::cout << "Prefetch Accuracy: " << static_cast<float>(accurate_prefetch) / static_cast<float>(PREFETCH_INFO_MAP.size()) << endl;
-		of_overall << "Prefetch Accuracy: " << static_cast<float>(accurate_prefetch) / static_cast<float>(PREFETCH_INFO_MAP.size()) << endl;
-		std::cout << "Prefetch Lateness: " << static_cast<float>(late_prefetch) / static_cast<float>(accurate_prefetch) << endl;
-		of_overall << "Prefetch Lateness: " << static_cast<float>(late_prefetch) / static_cast<float>(accurate_prefetch) << endl;
+		std::cout << "Prefetch Accuracy: " << static_cast<float>(cxl_man->accounting->accuracy()) << endl;
+		of_overall << "Prefetch Accuracy: " << static_cast<float>(cxl_man->accounting->accuracy()) << endl;
+		std::cout << "Prefetch Lateness: " << static_cast<float>(cxl_man->accounting->lateness()) << endl;
+		of_overall << "Prefetch Lateness: " << static_cast<float>(cxl_man->accounting->lateness()) << endl;
 		std::cout << "Prefetch Pollution: " << static_cast<float>(cxl_man->prefetch_pollution_count) / static_cast<float>(cxl_man->cache_miss_count)<< endl;
 		of_overall << "Prefetch Pollution: " << static_cast<float>(cxl_man->prefetch_pollution_count) / static_cast<float>(cxl_man->cache_miss_count) << endl;
+		if (cxl_man->prefetch_fill_count > 0) {
+			//Throughput of the prefetch fills from flash, from the first prefetch to the last fill
+			double fill_latency = static_cast<double>(cxl_man->prefetch_fill_latency_sum) / cxl_man->prefetch_fill_count;
+			double fill_throughput = static_cast<double>(cxl_man->prefetch_fill_count * cxl_man->cxl_config_para.num_sec * 512) * 1000
+				/ (cxl_man->last_prefetch_fill_time - cxl_man->first_prefetch_issue_time + 1);
+			std::cout << "Prefetch Fill Latency: " << fill_latency << " ns" << endl;
+			of_overall << "Prefetch Fill Latency: " << fill_latency << " ns" << endl;
+			std::cout << "Prefetch Fill Throughput: " << fill_throughput << " MB/s" << endl;
+			of_overall << "Prefetch Fill Throughput: " << fill_throughput << " MB/s" << endl;
+		}
 
 	}
 
@@ -1306,45 +1708,13 @@ namespace SSD_Components
 			CXL_DRAM_EVENTS evt{ CXL_DRAM_EVENTS::CACHE_MISS };
 			if (first_entry == NULL) { //disregard slow prefetch
 				evt = CXL_DRAM_EVENTS::PREFETCH_READY; 
-
-				if (PREFETCH_INFO_MAP.count(lba) == 0) {
-					prefetch_info_node n;
-					PREFETCH_INFO_MAP.emplace(lba, n);
-				}
-				if (PREFETCH_INFO_MAP_SAMPLE.count(lba) == 0) {
-					prefetch_info_node n;
-					PREFETCH_INFO_MAP_SAMPLE.emplace(lba, n);
-				}
-
+				cxl_man->accounting->prefetch_filled(lba);
 			}
 			else {
 				if (this->cxl_man->in_progress_prefetch_lba->count(lba)) {
 					evt = CXL_DRAM_EVENTS::SLOW_PREFETCH;
 					oflatep << first_entry->time << " " << Simulator->Time() << endl;
-					if (PREFETCH_INFO_MAP.count(lba) == 0) {
-						prefetch_info_node n;
-						n.late = 1;
-						n.hit_count++;
-						PREFETCH_INFO_MAP.emplace(lba, n);
-						PREFETCH_ACCURACY_INFO.emplace(lba);
-						PREFETCH_LATE_INFO.emplace(lba);
-					}
-					else {
-						PREFETCH_INFO_MAP[lba].late = 1;
-						PREFETCH_INFO_MAP[lba].hit_count++;
-						PREFETCH_ACCURACY_INFO.emplace(lba);
-						PREFETCH_LATE_INFO.emplace(lba);
-					}
-					if (PREFETCH_INFO_MAP_SAMPLE.count(lba) == 0) {
-						prefetch_info_node n;
-						n.late = 1;
-						n.hit_count++;
-						PREFETCH_INFO_MAP_SAMPLE.emplace(lba, n);
-					}
-					else {
-						PREFETCH_INFO_MAP_SAMPLE[lba].late = 1;
-						PREFETCH_INFO_MAP_SAMPLE[lba].hit_count++;
-					}
+					cxl_man->accounting->prefetch_used(lba, 1);
 				}
 			}
 
@@ -1360,18 +1730,23 @@ namespace SSD_Components
 			CXL_DRAM_ACCESS* dram_request{ new CXL_DRAM_ACCESS{static_cast<unsigned int>(64), lba, rw, evt, itime} };
 			Send_request_to_CXL_DRAM(dram_request);
 
-			if (first_entry)rw = (first_entry->sqe->Opcode == NVME_READ_OPCODE) ? 1 : 0;
+			if (first_entry)rw = first_entry->rw;
 			else rw = 1;
 
 			list<uint64_t>* flush_lba{ new list<uint64_t> };
-			this->cxl_man->dram->process_miss_data_ready_new(rw, lba, flush_lba, Simulator->Time(), this->cxl_man->prefetched_lba, this->cxl_man->tagAssertedLBA, this->cxl_man->prefetch_pollution_tracker,cxl_man->serviced_before_lba);
+			list<uint64_t> flush_write_count;
+			this->cxl_man->dram->process_miss_data_ready_new(rw, lba, flush_lba, Simulator->Time(), this->cxl_man->prefetched_lba, this->cxl_man->tagAssertedLBA, *this->cxl_man->accounting, cxl_man->serviced_before_lba, &flush_write_count);
 			if (cxl_man->flash_back_end_access_count >= cxl_man->flash_back_end_queue_size) {
 				Notify_CXL_Host_flash_not_full();
 			}
 			cxl_man->flash_back_end_access_count--;
 
 			if (this->cxl_man->in_progress_prefetch_lba->count(lba)) {
-				this->cxl_man->in_progress_prefetch_lba->erase(this->cxl_man->in_progress_prefetch_lba->find(lba));
+				auto prefetch = this->cxl_man->in_progress_prefetch_lba->find(lba);
+				cxl_man->prefetch_fill_count++;
+				cxl_man->prefetch_fill_latency_sum += Simulator->Time() - prefetch->second;
+				cxl_man->last_prefetch_fill_time = Simulator->Time();
+				this->cxl_man->in_progress_prefetch_lba->erase(prefetch);
 			}
 
 
@@ -1384,20 +1759,8 @@ namespace SSD_Components
 				uint64_t lsa{ lba * 8 };
 
 				flush_lba->pop_front();
-				Submission_Queue_Entry* sqe{ new Submission_Queue_Entry };
-				sqe->Command_Identifier = 0;
-				sqe->Opcode = NVME_WRITE_OPCODE;
-
-				sqe->Command_specific[0] = (uint32_t)lsa;
-				sqe->Command_specific[1] = (uint32_t)(lsa >> 32);
-				sqe->Command_specific[2] = ((uint32_t)((uint16_t)cxl_man->cxl_config_para.num_sec)) & (uint32_t)(0x0000ffff);
-
-				sqe->PRP_entry_1 = (DATA_MEMORY_REGION);//Dummy addresses, just to emulate data read/write access
-				sqe->PRP_entry_2 = (DATA_MEMORY_REGION + 0x1000);//Dummy addresses
-
-				((Request_Fetch_Unit_CXL*)(this->request_fetch_unit))->Fetch_next_request(0);
-
-				((Request_Fetch_Unit_CXL*)(this->request_fetch_unit))->Process_pcie_read_message(0, sqe, sizeof(Submission_Queue_Entry));
+				this->Send_request_to_flash_back_end(NVME_WRITE_OPCODE, lsa, cxl_man->placement_of_flush(lba, flush_write_count.front()));
+				flush_write_count.pop_front();
 
 			}
 
@@ -1415,9 +1778,7 @@ namespace SSD_Components
 			if (falsehit) cxl_man->falsehitcount++;
 
 			if (cxl_man->prefetched_lba->count(lba)) {
-				PREFETCH_INFO_MAP[lba].hit_count++;
-				PREFETCH_INFO_MAP_SAMPLE[lba].hit_count++;
-				PREFETCH_ACCURACY_INFO.emplace(lba);
+				cxl_man->accounting->prefetch_used(lba, 0);
 			}
 		}
 
@@ -1430,9 +1791,7 @@ namespace SSD_Components
 			if (falsehit) cxl_man->falsehitcount++;
 
 			if (cxl_man->prefetched_lba->count(lba)) {
-				PREFETCH_INFO_MAP[lba].hit_count++;
-				PREFETCH_INFO_MAP_SAMPLE[lba].hit_count++;
-				PREFETCH_ACCURACY_INFO.emplace(lba);
+				cxl_man->accounting->prefetch_used(lba, 0);
 			}
 		}
 		completed_removed_from_mshr = completely_removed;
@@ -1447,31 +1806,12 @@ namespace SSD_Components
 
 			prefetchlba.pop_front();
 
-			Submission_Queue_Entry* sqe = new Submission_Queue_Entry;
-			sqe->Command_Identifier = 0;
-			sqe->Opcode = NVME_READ_OPCODE;
-			//sqe->Command_specific[0] = (uint32_t)lba * 4096; //cxl_man->process_requests will do a translation
-			//sqe->Command_specific[1] = (uint32_t)(lba * 4096 >> 32);
-			sqe->Command_specific[0] = (uint32_t)(lba * cxl_man->cxl_config_para.num_sec); //cxl_man->process_requests will do a translation
-			sqe->Command_specific[1] = (uint32_t)((lba * cxl_man->cxl_config_para.num_sec) >> 32);
-			sqe->Command_specific[2] = ((uint32_t)((uint16_t)cxl_man->cxl_config_para.num_sec)) & (uint32_t)(0x0000ffff); // magic number
-			sqe->PRP_entry_1 = (DATA_MEMORY_REGION);//Dummy addresses, just to emulate data read/write access
-			sqe->PRP_entry_2 = (DATA_MEMORY_REGION + 0x1000);//Dummy addresses
-
-			//if (!(cxl_man->process_requests(0, sqe, 1))) {
-			//	delete sqe;
-			//	continue;
-			//}
-			//else {
-
-			//	sqe->Opcode = NVME_READ_OPCODE;
-			//	request_fetch_unit->Fetch_next_request(0);
-			//}
-
 			cxl_man->in_progress_prefetch_lba->emplace(lba, Simulator->Time());
-			request_fetch_unit->Fetch_next_request(0);
-
-			request_fetch_unit->Process_pcie_read_message(0, sqe, sizeof(Submission_Queue_Entry));
+			if (cxl_man->prefetch_issue_count == 0) {
+				cxl_man->first_prefetch_issue_time = Simulator->Time();
+			}
+			cxl_man->prefetch_issue_count++;
+			Send_request_to_flash_back_end(NVME_READ_OPCODE, lba * cxl_man->cxl_config_para.num_sec, 0, true);
 
 		}
 
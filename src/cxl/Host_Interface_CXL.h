@@ -5,6 +5,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include "../sim/Sim_Event.h"
 #include "../ssd/Host_Interface_Base.h"
@@ -16,6 +17,10 @@
 #include "DRAM_Model.h"
 #include "OutputLog.h"
 #include "Prefetching_Alg.h"
+#include "Prefetch_Accounting.h"
+#include "CXL_Epoch_Sampler.h"
+#include "CXL_Phase_Controller.h"
+#include "CXL_Trace_Sampler.h"
 
 using namespace std;
 
@@ -28,7 +33,23 @@ public:
 
 namespace SSD_Components
 {
+	//A host that shares the device: its window of the device address space, its prefetcher state and its statistics
+	class cxl_stream_context {
+	public:
+		LHA_type start_lsa{ 0 }, end_lsa{ 0 };
+
+		uint64_t previous_unused_lba{ 0 };
+		uint16_t prefetchK{ 4 };
+		uint16_t prefetch_timing_offset{ 16 };
+		int prefetch_level{ 4 };
+		boClass boPrefetcher;
+		leapClass leapPrefetcher;
 
+		uint64_t access_count{ 0 }, cache_hit_count{ 0 }, cache_miss_count{ 0 }, prefetch_hit_count{ 0 };
+		uint64_t serviced_count{ 0 };
+		sim_time_type latency_sum{ 0 }, latency_max{ 0 };
+		sim_time_type first_access_time{ 0 }, last_service_time{ 0 };
+	};
 
 	class CXL_Manager {
 	public:
@@ -36,9 +57,20 @@ namespace SSD_Components
 		CXL_Manager(Host_Interface_Base* hosti);
 		~CXL_Manager();
 		
-		bool process_requests(uint64_t address, void* payload, bool is_pref_req);
+		bool process_requests(uint64_t address, bool rw, bool is_pref_req, uint16_t stream_id, LHA_type& lsa);
+		bool functional_access(uint64_t address, bool rw, uint16_t stream_id);
+		void functional_fill(uint64_t lba, bool rw);
+		void exclude_requests(uint64_t count);
 		void request_serviced(User_Request* request);
 
+		void Add_stream(LHA_type start_lsa, LHA_type end_lsa);
+		uint16_t stream_of(uint64_t lba);
+		placement_id_type placement_of_flush(uint64_t lba, uint64_t write_count);
+		void print_stream_statistics();
+		LHA_type device_lsa(uint64_t address, const cxl_stream_context& stream);
+		static void handle_access_serviced(uint64_t lba, sim_time_type initiate_time);
+		vector<cxl_stream_context> streams;
+
 
 
 		cxl_mshr* mshr;
@@ -50,39 +82,43 @@ namespace SSD_Components
 
 		//prefetchers
 
-		void prefetch_decision_maker(uint64_t lba, bool isMiss, uint64_t prefetch_hit_count);
+		void prefetch_decision_maker(uint64_t lba, bool isMiss, cxl_stream_context& stream);
+		void account_prefetch_batch(const list<uint64_t>& prefetchlba);
 		int prefetch_feedback();
+		void reconfigure_prefetching();
+		cxl_phase_controller* phase_controller{ NULL };
+		double prefetch_share{ 1 };//The share of the cache lines that prefetched lines may take
+		uint64_t prefetch_line_limit{ 0 };//0 if prefetches are not limited
 		double accuracy_high{ 0.75 }, accuracy_low{ 0.4 }, late_thresh{ 0.01 }, pollution_thresh{ 0.25 };
 
 		set<uint64_t>* prefetched_lba;
 		map<uint64_t, uint64_t>* in_progress_prefetch_lba;
 		uint64_t prefetch_queue_size{ 1024 };
 
-		//tagged prefetcher
-		uint64_t previous_unused_lba{0};
-
+		//tagged prefetcher, the prefetcher state of each host is kept in its stream context
 		set<uint64_t> tagAssertedLBA;
-		uint16_t prefetchK{ 4 };
-		uint16_t prefetch_timing_offset{16};
-		int prefetch_level{ 4 };
 		vector<vector<uint64_t>> prefetch_aggre{ {1,4}, {1,8},{2,16},{4,32},{4,64} };
 
-		//Best-offset prefetcher
-		boClass boPrefetcher;
-
-		//leap
-		leapClass leapPrefetcher;
-
 		//for dram avaialable scheduling
 		set<uint64_t> serviced_before_lba;
 		set<uint64_t> not_yet_serviced_lba;
 
 		cxl_config cxl_config_para;
 		uint64_t cache_miss_count{ 0 }, cache_hit_count{ 0 }, total_number_of_accesses{ 0 }, prefetch_hit_count{ 0 }, flush_count{ 0 }, flash_read_count{ 0 }, no_cache_flash_write_count{ 0 }, no_cache_flash_read_count{0};
-		uint64_t prefetch_pollution_count{ 0 };
-		set<uint64_t> prefetch_pollution_tracker;
-
-		set<uint64_t> unique_lba;
+		uint64_t prefetch_pollution_count{ 0 }, prefetch_issue_count{ 0 };
+		uint64_t prefetch_fill_count{ 0 };//Prefetches whose data has arrived from flash
+		uint64_t prefetch_batch_count{ 0 }, prefetch_batch_read_count{ 0 };
+		uint64_t prefetch_plane_conflict_count{ 0 }, prefetch_die_conflict_count{ 0 };//Prefetch reads whose plane or die is taken by an earlier read of their batch
+		uint64_t late_prefetch_promotion_count{ 0 };//Prefetches that a demand access caught up with while they were queued as prefetch reads in the TSU, and moved to the demand reads
+		sim_time_type prefetch_fill_latency_sum{ 0 }, first_prefetch_issue_time{ 0 }, last_prefetch_fill_time{ 0 };
+		prefetch_accounting* accounting{ NULL };
+		cxl_epoch_sampler* epoch_sampler{ NULL };
+		cxl_trace_sampler* trace_sampler{ NULL };
+		bool functional{ 0 };//Set while a functional access updates the prefetcher
+		uint64_t functional_flush_count{ 0 };
+		vector<uint64_t> flush_count_per_placement;
+
+		distinct_counter unique_lba;
 
 
 		uint64_t flash_back_end_queue_size{ 1024 };
@@ -101,6 +137,12 @@ namespace SSD_Components
 
 		Host_Interface_Base* hi{NULL};
 
+		//The heat of each flushed line and the flush count at its last update
+		unordered_map<uint64_t, pair<uint64_t, uint64_t>> flush_heat;
+		uint64_t flush_heat_swept_at{ 0 };//The flush count when the lines that had cooled down were last dropped from flush_heat
+
+		static CXL_Manager* instance;
+
 
 
 
@@ -153,7 +195,9 @@ namespace SSD_Components
 		uint16_t Get_submission_queue_depth(stream_id_type stream_id);
 		uint16_t Get_completion_queue_depth(stream_id_type stream_id);
 		IO_Flow_Priority_Class Get_priority_class(stream_id_type stream_id);
+		bool Promote_latency_tolerant_read(LHA_type start_lba);
 	private:
+		std::unordered_map<LHA_type, User_Request*> latency_tolerant_reads;//The waiting prefetch reads by their start LBA
 		void segment_user_request(User_Request* user_request);
 		void inform_host_request_completed(stream_id_type stream_id, User_Request* request);
 	};
@@ -194,26 +238,9 @@ namespace SSD_Components
 		CXL_Manager* cxl_man;
 		CXL_DRAM_Model* cxl_dram;
 
-		void Consume_pcie_message(Host_Components::PCIe_Message* message)
-		{
-			if (!(cxl_man->process_requests(message->Address, message->Payload, 0))) {
-				delete message;
-				return;
-			}
-			else {
-
-				if(cxl_man->cxl_config_para.has_cache)((Submission_Queue_Entry*)message->Payload)->Opcode = NVME_READ_OPCODE;
-				request_fetch_unit->Fetch_next_request(0);
-			}
-
-			if (message->Type == Host_Components::PCIe_Message_Type::READ_COMP) {
-				request_fetch_unit->Process_pcie_read_message(message->Address, message->Payload, message->Payload_size);
-			}
-			else {
-				request_fetch_unit->Process_pcie_write_message(message->Address, message->Payload, message->Payload_size);
-			}
-			delete message;
-		}
+		void Consume_pcie_message(Host_Components::PCIe_Message* message);
+		LHA_type Consume_cxl_mem_transaction(const Host_Components::CXL_Mem_Transaction& transaction);
+		void Send_request_to_flash_back_end(uint8_t opcode, LHA_type lsa, placement_id_type placement_id = 0, bool latency_tolerant = false);
 
 		void Update_CXL_DRAM_state(bool rw, uint64_t lba, bool& falsehit){
 			this->cxl_man->dram->process_cache_hit(rw, lba, falsehit);
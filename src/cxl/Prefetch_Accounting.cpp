@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <cmath>
+#include "../sim/Sim_Defs.h"
+#include "Prefetch_Accounting.h"
+
+static uint64_t mix_hash(uint64_t key) {
+	key += 0x9e3779b97f4a7c15ULL;
+	key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+	return key ^ (key >> 31);
+}
+
+counting_bloom_filter::counting_bloom_filter(uint64_t counter_count, uint64_t hash_count) : counters(counter_count, 0), hash_count(hash_count) {
+}
+
+uint64_t counting_bloom_filter::index(uint64_t key, uint64_t i) {
+	uint64_t h1{ mix_hash(key) };
+	uint64_t h2{ mix_hash(key ^ 0x5bd1e9955bd1e995ULL) | 1 };
+	return (h1 + i * h2) % counters.size();
+}
+
+void counting_bloom_filter::insert(uint64_t key) {
+	for (uint64_t i = 0; i < hash_count; i++) {
+		uint8_t& c{ counters[index(key, i)] };
+		if (c < UINT8_MAX) c++;
+	}
+	insert_count++;
+}
+
+bool counting_bloom_filter::contains(uint64_t key) {
+	for (uint64_t i = 0; i < hash_count; i++) {
+		if (counters[index(key, i)] == 0) return 0;
+	}
+	return 1;
+}
+
+void counting_bloom_filter::remove(uint64_t key) {
+	if (!contains(key)) return;
+	for (uint64_t i = 0; i < hash_count; i++) {
+		uint8_t& c{ counters[index(key, i)] };
+		if (c < UINT8_MAX) c--;//A saturated counter no longer knows its count
+	}
+}
+
+void counting_bloom_filter::clear() {
+	std::fill(counters.begin(), counters.end(), 0);
+	insert_count = 0;
+}
+
+
+distinct_counter::distinct_counter(uint64_t register_bits) : registers(1ULL << register_bits, 0), register_bits(register_bits) {
+}
+
+void distinct_counter::insert(uint64_t key) {
+	uint64_t h{ mix_hash(key) };
+	uint64_t r{ h >> (64 - register_bits) };
+	uint64_t w{ h << register_bits };
+	uint8_t rank{ 1 };
+	while (rank <= 64 - register_bits && (w & (1ULL << 63)) == 0) {
+		rank++;
+		w <<= 1;
+	}
+	if (registers[r] < rank) registers[r] = rank;
+}
+
+uint64_t distinct_counter::estimate() {
+	double m{ static_cast<double>(registers.size()) };
+	double sum{ 0 };
+	uint64_t zeros{ 0 };
+	for (auto r : registers) {
+		sum += std::ldexp(1.0, -r);
+		if (r == 0) zeros++;
+	}
+	double e{ 0.7213 / (1 + 1.079 / m) * m * m / sum };
+	if (e <= 2.5 * m && zeros > 0) {
+		e = m * std::log(m / zeros);//Linear counting is more accurate for small cardinalities
+	}
+	return static_cast<uint64_t>(e + 0.5);
+}
+
+
+prefetch_accounting::prefetch_accounting(uint64_t sampled_sets, uint64_t ways, uint64_t sampling_interval, uint64_t window)
+	: sampled_sets(sampled_sets), ways(ways), sampling_interval(sampling_interval), window(window) {
+	if (sampled_sets == 0 || ways == 0 || sampling_interval == 0) {
+		PRINT_ERROR("Prefetch accounting: the number of sampled sets, their ways and the sampling interval should be greater than zero!")
+	}
+	if (window == 0) {
+		PRINT_ERROR("Prefetch accounting: the accounting window should be greater than zero!")
+	}
+	tags.resize(sampled_sets * ways);
+	//16 counters per key of a window keep the false positive rate of each generation below 0.3%
+	pollution_filters[0] = new counting_bloom_filter(16 * window, 4);
+	pollution_filters[1] = new counting_bloom_filter(16 * window, 4);
+}
+
+prefetch_accounting::~prefetch_accounting() {
+	delete pollution_filters[0];
+	delete pollution_filters[1];
+}
+
+bool prefetch_accounting::is_sampled(uint64_t lba, uint64_t& set) {
+	uint64_t h{ mix_hash(lba) };
+	if (h % sampling_interval != 0) return 0;
+	set = (h / sampling_interval) % sampled_sets;
+	return 1;
+}
+
+shadow_tag* prefetch_accounting::find_tag(uint64_t lba, uint64_t set) {
+	for (uint64_t i = set * ways; i < (set + 1) * ways; i++) {
+		if (tags[i].valid && tags[i].lba == lba) return &tags[i];
+	}
+	return NULL;
+}
+
+void prefetch_accounting::prefetch_filled(uint64_t lba) {
+	uint64_t set;
+	if (!is_sampled(lba, set)) return;
+
+	shadow_tag* tag{ find_tag(lba, set) };
+	if (tag) {//Prefetched again while its tag is alive, it is still the same prefetch as far as accuracy is concerned
+		tag->last_fill = fill_count;
+		return;
+	}
+
+	tag = &tags[set * ways];
+	for (uint64_t i = set * ways; i < (set + 1) * ways; i++) {
+		if (!tags[i].valid) {
+			tag = &tags[i];
+			break;
+		}
+		if (tags[i].last_fill < tag->last_fill) tag = &tags[i];
+	}
+	if (tag->valid) {
+		retired_fill_count++;
+		live_fill_count--;
+		if (tag->used) {
+			retired_used_count++;
+			live_used_count--;
+		}
+		if (tag->late) {
+			retired_late_count++;
+			live_late_count--;
+		}
+	}
+
+	fill_count++;
+	tag->lba = lba;
+	tag->last_fill = fill_count;
+	tag->valid = 1;
+	tag->used = 0;
+	tag->late = 0;
+	live_fill_count++;
+
+	window_fill_count++;
+	if (fill_count % window == 0) {
+		window_fill_count /= 2;
+		window_used_count /= 2;
+		window_late_count /= 2;
+	}
+}
+
+void prefetch_accounting::prefetch_used(uint64_t lba, bool late) {
+	uint64_t set;
+	if (!is_sampled(lba, set)) return;
+
+	shadow_tag* tag{ find_tag(lba, set) };
+	if (tag == NULL) {
+		if (!late) return;//The tag was retired before the use
+		prefetch_filled(lba);//A late prefetch is used before its data arrives
+		tag = find_tag(lba, set);
+	}
+
+	if (!tag->used) {
+		tag->used = 1;
+		live_used_count++;
+		window_used_count++;
+	}
+	if (late && !tag->late) {
+		tag->late = 1;
+		live_late_count++;
+		window_late_count++;
+	}
+}
+
+void prefetch_accounting::polluting_eviction(uint64_t lba) {
+	if (pollution_filters[0]->getSize() == window) {
+		counting_bloom_filter* older{ pollution_filters[1] };
+		older->clear();
+		pollution_filters[1] = pollution_filters[0];
+		pollution_filters[0] = older;
+	}
+	pollution_filters[0]->insert(lba);
+}
+
+bool prefetch_accounting::demand_miss(uint64_t lba) {
+	for (auto filter : pollution_filters) {
+		if (filter->contains(lba)) {
+			filter->remove(lba);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+double prefetch_accounting::accuracy() {
+	uint64_t fills{ retired_fill_count + live_fill_count };
+	if (fills == 0) return 0;
+	return static_cast<double>(retired_used_count + live_used_count) / static_cast<double>(fills);
+}
+
+double prefetch_accounting::lateness() {
+	uint64_t used{ retired_used_count + live_used_count };
+	if (used == 0) return 0;
+	return static_cast<double>(retired_late_count + live_late_count) / static_cast<double>(used);
+}
+
+double prefetch_accounting::window_accuracy() {
+	if (window_fill_count == 0) return 0;
+	return window_used_count / window_fill_count;
+}
+
+double prefetch_accounting::window_late_fraction() {
+	if (window_fill_count == 0) return 0;
+	return window_late_count / window_fill_count;
+}
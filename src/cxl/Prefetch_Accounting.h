@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+//A counting Bloom filter with saturating 8-bit counters
+class counting_bloom_filter {
+public:
+	counting_bloom_filter(uint64_t counter_count, uint64_t hash_count);
+
+	void insert(uint64_t key);
+	bool contains(uint64_t key);
+	void remove(uint64_t key);
+	void clear();
+	uint64_t getSize() { return insert_count; }
+
+private:
+	vector<uint8_t> counters;
+	uint64_t hash_count;
+	uint64_t insert_count{ 0 };
+
+	uint64_t index(uint64_t key, uint64_t i);
+};
+
+//A HyperLogLog sketch that estimates the number of distinct keys in a fixed number of registers
+class distinct_counter {
+public:
+	distinct_counter(uint64_t register_bits = 14);
+
+	void insert(uint64_t key);
+	uint64_t estimate();
+
+private:
+	vector<uint8_t> registers;
+	uint64_t register_bits;
+};
+
+class shadow_tag {
+public:
+	uint64_t lba{ 0 };
+	uint64_t last_fill{ 0 };
+	bool valid{ 0 };
+	bool used{ 0 };
+	bool late{ 0 };
+};
+
+/*
+* Fixed-memory accuracy, lateness and pollution accounting for the prefetchers.
+* Accuracy and lateness are measured on a sample of the LBA space: an LBA belongs to a shadow set if its hash is a multiple
+* of the sampling interval, and each shadow set keeps the tags of its most recently filled prefetches. A tag that is replaced
+* is retired into the totals. The feedback-directed prefetcher reads windowed counters that are halved every window of sampled fills.
+* Pollution is detected with two generations of counting Bloom filters that hold the demand lines evicted by prefetched fills;
+* the older generation is dropped once the newer one has seen a window of evictions.
+*/
+class prefetch_accounting {
+public:
+	prefetch_accounting(uint64_t sampled_sets, uint64_t ways, uint64_t sampling_interval, uint64_t window);
+	~prefetch_accounting();
+
+	void prefetch_filled(uint64_t lba);//The data of a prefetch is ready in the cache
+	void prefetch_used(uint64_t lba, bool late);//A demand access found a prefetched line, or merged with an in-flight prefetch if late
+	void polluting_eviction(uint64_t lba);//A demand line was evicted to make room for a prefetched line
+	bool demand_miss(uint64_t lba);//Returns true if the missed line had been evicted by a prefetch
+
+	double accuracy();
+	double lateness();
+	double window_accuracy();
+	double window_late_fraction();//Late prefetches per fill, the lateness measure of the feedback thresholds
+	uint64_t sampled_fills() { return retired_fill_count + live_fill_count; }
+	uint64_t sampled_uses() { return retired_used_count + live_used_count; }
+
+private:
+	vector<shadow_tag> tags;
+	uint64_t sampled_sets, ways, sampling_interval, window;
+	uint64_t fill_count{ 0 };//Sampled fills, also the age stamp of the tags
+
+	uint64_t retired_fill_count{ 0 }, retired_used_count{ 0 }, retired_late_count{ 0 };
+	uint64_t live_fill_count{ 0 }, live_used_count{ 0 }, live_late_count{ 0 };
+	double window_fill_count{ 0 }, window_used_count{ 0 }, window_late_count{ 0 };
+
+	counting_bloom_filter* pollution_filters[2];//The current and the previous generation
+
+	bool is_sampled(uint64_t lba, uint64_t& set);
+	shadow_tag* find_tag(uint64_t lba, uint64_t set);
+};
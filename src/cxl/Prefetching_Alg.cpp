@@ -18,9 +18,11 @@ void boClass::bosetvalues(uint64_t hsize, uint64_t maxoff, uint64_t  b, uint64_t
 
 void boClass::addhistory(uint64_t addr) {
 	if (rrtable.size() >= maxtablesize) {
+		rrindex.erase(rrindex.find(rrtable.front()));
 		rrtable.pop_front();
 	}
 	rrtable.push_back(addr);
+	rrindex.insert(addr);
 }
 
 void boClass::incrementscore(uint64_t offset) {
@@ -28,10 +30,7 @@ void boClass::incrementscore(uint64_t offset) {
 }
 
 bool boClass::inhistory(uint64_t addr) {
-	for (auto i : rrtable) {
-		if (i == addr) return 1;
-	}
-	return 0;
+	return rrindex.find(addr) != rrindex.end();
 }
 uint64_t boClass::findmax() {
 	uint64_t max{ offsetscore[0] };
@@ -87,6 +86,7 @@ void boClass::reset() {
 	olist.clear();
 	for (auto& i : offsetscore) i = 0;
 	rrtable.clear();
+	rrindex.clear();
 
 }
 
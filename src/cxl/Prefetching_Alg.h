@@ -6,12 +6,14 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_set>
 
 using namespace std;
 
 class boClass {
 private:
 	list<uint64_t> rrtable;
+	unordered_multiset<uint64_t> rrindex;//The addresses of rrtable, for the lookups of every offset under test
 	uint64_t maxtablesize{ 1024 };
 	uint64_t maxoffset{ 128 };
 	vector <uint64_t> offsetscore;
@@ -18,12 +18,17 @@ unsigned int Device_Parameter_Set::Data_Cache_DRAM_Data_Busrt_Size = 4;//The num
 sim_time_type Device_Parameter_Set::Data_Cache_DRAM_tRCD = 13;//tRCD parameter to access DRAM in the data cache, the unit is nano-seconds
 sim_time_type Device_Parameter_Set::Data_Cache_DRAM_tCL = 13;//tCL parameter to access DRAM in the data cache, the unit is nano-seconds
 sim_time_type Device_Parameter_Set::Data_Cache_DRAM_tRP = 13;//tRP parameter to access DRAM in the data cache, the unit is nano-seconds
+unsigned int Device_Parameter_Set::Data_Cache_Bloom_Filter_Capacity = 1024 * 1024;//The number of distinct LPAs per flow that the hot data filter of the advanced data cache holds in one period at its false-positive rate
+double Device_Parameter_Set::Data_Cache_Bloom_Filter_False_Positive_Rate = 0.01;
+sim_time_type Device_Parameter_Set::Data_Cache_Bloom_Filter_Reset_Period = 1000000000;//The hot data filter forgets the LPAs written before the last reset, the unit is nano-seconds
 SSD_Components::Flash_Address_Mapping_Type Device_Parameter_Set::Address_Mapping = SSD_Components::Flash_Address_Mapping_Type::PAGE_LEVEL;
 bool Device_Parameter_Set::Ideal_Mapping_Table = false;//If mapping is ideal, then all the mapping entries are found in the DRAM and there is no need to read mapping entries from flash
 unsigned int Device_Parameter_Set::CMT_Capacity = 2 * 1024 * 1024;//Size of SRAM/DRAM space that is used to cache address mapping table in bytes
 SSD_Components::CMT_Sharing_Mode Device_Parameter_Set::CMT_Sharing_Mode = SSD_Components::CMT_Sharing_Mode::SHARED;//How the entire CMT space is shared among concurrently running flows
 SSD_Components::Flash_Plane_Allocation_Scheme_Type Device_Parameter_Set::Plane_Allocation_Scheme = SSD_Components::Flash_Plane_Allocation_Scheme_Type::CWDP;
 SSD_Components::Flash_Scheduling_Type Device_Parameter_Set::Transaction_Scheduling_Policy = SSD_Components::Flash_Scheduling_Type::OUT_OF_ORDER;
+SSD_Components::Flash_Priority_Scheduling_Type Device_Parameter_Set::Transaction_Priority_Scheduling = SSD_Components::Flash_Priority_Scheduling_Type::NONE;
+unsigned int Device_Parameter_Set::Transaction_Priority_Weights[SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT] = { 8, 1, 2, 1 };
 double Device_Parameter_Set::Overprovisioning_Ratio = 0.07;//The ratio of spare space with respect to the whole available storage space of SSD
 double Device_Parameter_Set::GC_Exec_Threshold = 0.05;//The threshold for the ratio of free pages that used to trigger GC
 SSD_Components::GC_Block_Selection_Policy_Type Device_Parameter_Set::GC_Block_Selection_Policy = SSD_Components::GC_Block_Selection_Policy_Type::RGA;
@@ -36,11 +41,15 @@ unsigned int Device_Parameter_Set::Static_Wearleveling_Threshold = 100;
 sim_time_type Device_Parameter_Set::Preferred_suspend_erase_time_for_read = 700000;//in nano-seconds
 sim_time_type Device_Parameter_Set::Preferred_suspend_erase_time_for_write = 700000;//in nano-seconds
 sim_time_type Device_Parameter_Set::Preferred_suspend_write_time_for_read = 100000;//in nano-seconds
+sim_time_type Device_Parameter_Set::Read_Latency_SLO = 0;//in nano-seconds
+unsigned int Device_Parameter_Set::Max_Suspensions_Per_Operation = 2;
+sim_time_type Device_Parameter_Set::Write_Batching_Window = 0;//in nano-seconds
 unsigned int Device_Parameter_Set::Flash_Channel_Count = 8;
 unsigned int Device_Parameter_Set::Flash_Channel_Width = 1;//Channel width in byte
 unsigned int Device_Parameter_Set::Channel_Transfer_Rate = 300;//MT/s
 unsigned int Device_Parameter_Set::Chip_No_Per_Channel = 4;
 SSD_Components::ONFI_Protocol Device_Parameter_Set::Flash_Comm_Protocol = SSD_Components::ONFI_Protocol::NVDDR2;
+unsigned int Device_Parameter_Set::Placement_Handle_Count = 1;
 Flash_Parameter_Set Device_Parameter_Set::Flash_Parameters;
 
 void Device_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
@@ -145,6 +154,18 @@ void Device_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 	val = std::to_string(Data_Cache_DRAM_tRP);
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Data_Cache_Bloom_Filter_Capacity";
+	val = std::to_string(Data_Cache_Bloom_Filter_Capacity);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Data_Cache_Bloom_Filter_False_Positive_Rate";
+	val = std::to_string(Data_Cache_Bloom_Filter_False_Positive_Rate);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Data_Cache_Bloom_Filter_Reset_Period";
+	val = std::to_string(Data_Cache_Bloom_Filter_Reset_Period);
+	xmlwriter.Write_attribute_string(attr, val);
+
 	attr = "Address_Mapping";
 	switch (Address_Mapping) {
 		case SSD_Components::Flash_Address_Mapping_Type::PAGE_LEVEL:
@@ -271,6 +292,29 @@ void Device_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 	}
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Transaction_Priority_Scheduling";
+	switch (Transaction_Priority_Scheduling) {
+		case SSD_Components::Flash_Priority_Scheduling_Type::NONE:
+			val = "NONE";
+			break;
+		case SSD_Components::Flash_Priority_Scheduling_Type::STRICT:
+			val = "STRICT";
+			break;
+		case SSD_Components::Flash_Priority_Scheduling_Type::WEIGHTED:
+			val = "WEIGHTED";
+			break;
+		default:
+			break;
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Transaction_Priority_Weights";
+	val = "";
+	for (unsigned int priority_class = 0; priority_class < SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT; priority_class++) {
+		val += (priority_class == 0 ? "" : ",") + std::to_string(Transaction_Priority_Weights[priority_class]);
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
 	attr = "Overprovisioning_Ratio";
 	val = std::to_string(Overprovisioning_Ratio);
 	xmlwriter.Write_attribute_string(attr, val);
@@ -340,6 +384,18 @@ void Device_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 	val = std::to_string(Preferred_suspend_write_time_for_read);
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Read_Latency_SLO";
+	val = std::to_string(Read_Latency_SLO);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Max_Suspensions_Per_Operation";
+	val = std::to_string(Max_Suspensions_Per_Operation);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Write_Batching_Window";
+	val = std::to_string(Write_Batching_Window);
+	xmlwriter.Write_attribute_string(attr, val);
+
 	attr = "Flash_Channel_Count";
 	val = std::to_string(Flash_Channel_Count);
 	xmlwriter.Write_attribute_string(attr, val);
@@ -361,11 +417,21 @@ void Device_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 		case SSD_Components::ONFI_Protocol::NVDDR2:
 			val = "NVDDR2";
 			break;
+		case SSD_Components::ONFI_Protocol::NVDDR3:
+			val = "NVDDR3";
+			break;
+		case SSD_Components::ONFI_Protocol::TOGGLE:
+			val = "TOGGLE";
+			break;
 		default:
 			break;
 	}
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Placement_Handle_Count";
+	val = std::to_string(Placement_Handle_Count);
+	xmlwriter.Write_attribute_string(attr, val);
+
 	Flash_Parameters.XML_serialize(xmlwriter);
 
 	xmlwriter.Write_close_tag();
@@ -446,6 +512,21 @@ void Device_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
 			} else if (strcmp(param->name(), "Data_Cache_DRAM_tRP") == 0) {
 				std::string val = param->value();
 				Data_Cache_DRAM_tRP = std::stoul(val);
+			} else if (strcmp(param->name(), "Data_Cache_Bloom_Filter_Capacity") == 0) {
+				std::string val = param->value();
+				Data_Cache_Bloom_Filter_Capacity = std::stoul(val);
+				if (Data_Cache_Bloom_Filter_Capacity == 0) {
+					PRINT_ERROR("Data_Cache_Bloom_Filter_Capacity should be positive")
+				}
+			} else if (strcmp(param->name(), "Data_Cache_Bloom_Filter_False_Positive_Rate") == 0) {
+				std::string val = param->value();
+				Data_Cache_Bloom_Filter_False_Positive_Rate = std::stod(val);
+				if (Data_Cache_Bloom_Filter_False_Positive_Rate <= 0 || Data_Cache_Bloom_Filter_False_Positive_Rate >= 1) {
+					PRINT_ERROR("Data_Cache_Bloom_Filter_False_Positive_Rate should be in (0, 1)")
+				}
+			} else if (strcmp(param->name(), "Data_Cache_Bloom_Filter_Reset_Period") == 0) {
+				std::string val = param->value();
+				Data_Cache_Bloom_Filter_Reset_Period = std::stoull(val);
 			} else if (strcmp(param->name(), "Address_Mapping") == 0) {
 				std::string val = param->value();
 				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
@@ -538,6 +619,40 @@ void Device_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
 				} else {
 					PRINT_ERROR("Unknown transaction scheduling type specified in the SSD configuration file")
 				}
+			} else if (strcmp(param->name(), "Transaction_Priority_Scheduling") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				if (strcmp(val.c_str(), "NONE") == 0) {
+					Transaction_Priority_Scheduling = SSD_Components::Flash_Priority_Scheduling_Type::NONE;
+				} else if (strcmp(val.c_str(), "STRICT") == 0) {
+					Transaction_Priority_Scheduling = SSD_Components::Flash_Priority_Scheduling_Type::STRICT;
+				} else if (strcmp(val.c_str(), "WEIGHTED") == 0) {
+					Transaction_Priority_Scheduling = SSD_Components::Flash_Priority_Scheduling_Type::WEIGHTED;
+				} else {
+					PRINT_ERROR("Unknown transaction priority scheduling type specified in the SSD configuration file")
+				}
+			} else if (strcmp(param->name(), "Transaction_Priority_Weights") == 0) {
+				std::string val = param->value();
+				unsigned int priority_class = 0;
+				size_t start = 0;
+				while (start <= val.size()) {
+					size_t end = val.find(',', start);
+					if (end == std::string::npos) {
+						end = val.size();
+					}
+					if (priority_class == SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT) {
+						PRINT_ERROR("Transaction_Priority_Weights should have " << SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT << " comma-separated values")
+					}
+					Transaction_Priority_Weights[priority_class] = std::stoul(val.substr(start, end - start));
+					if (Transaction_Priority_Weights[priority_class] == 0) {
+						PRINT_ERROR("The weights of the transaction priority classes should be positive")
+					}
+					priority_class++;
+					start = end + 1;
+				}
+				if (priority_class != SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT) {
+					PRINT_ERROR("Transaction_Priority_Weights should have " << SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT << " comma-separated values")
+				}
 			} else if (strcmp(param->name(), "Overprovisioning_Ratio") == 0) {
 				std::string val = param->value();
 				Overprovisioning_Ratio = std::stod(val);
@@ -596,6 +711,15 @@ void Device_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
 			} else if (strcmp(param->name(), "Preferred_suspend_write_time_for_read") == 0) {
 				std::string val = param->value();
 				Preferred_suspend_write_time_for_read = std::stoull(val);
+			} else if (strcmp(param->name(), "Read_Latency_SLO") == 0) {
+				std::string val = param->value();
+				Read_Latency_SLO = std::stoull(val);
+			} else if (strcmp(param->name(), "Max_Suspensions_Per_Operation") == 0) {
+				std::string val = param->value();
+				Max_Suspensions_Per_Operation = std::stoul(val);
+			} else if (strcmp(param->name(), "Write_Batching_Window") == 0) {
+				std::string val = param->value();
+				Write_Batching_Window = std::stoull(val);
 			} else if (strcmp(param->name(), "Flash_Channel_Count") == 0) {
 				std::string val = param->value();
 				Flash_Channel_Count = std::stoul(val);
@@ -613,9 +737,19 @@ void Device_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
 				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
 				if (strcmp(val.c_str(), "NVDDR2") == 0) {
 					Flash_Comm_Protocol = SSD_Components::ONFI_Protocol::NVDDR2;
+				} else if (strcmp(val.c_str(), "NVDDR3") == 0) {
+					Flash_Comm_Protocol = SSD_Components::ONFI_Protocol::NVDDR3;
+				} else if (strcmp(val.c_str(), "TOGGLE") == 0) {
+					Flash_Comm_Protocol = SSD_Components::ONFI_Protocol::TOGGLE;
 				} else {
 					PRINT_ERROR("Unknown flash communication protocol type specified in the SSD configuration file")
 				}
+			} else if (strcmp(param->name(), "Placement_Handle_Count") == 0) {
+				std::string val = param->value();
+				Placement_Handle_Count = std::stoul(val);
+				if (Placement_Handle_Count == 0 || Placement_Handle_Count > MAX_PLACEMENT_HANDLES) {
+					PRINT_ERROR("Placement_Handle_Count should be between 1 and " << MAX_PLACEMENT_HANDLES)
+				}
 			}
 			else if (strcmp(param->name(), "Flash_Parameter_Set") == 0)
 			{
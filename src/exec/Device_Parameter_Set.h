@@ -31,12 +31,17 @@ public:
 	static sim_time_type Data_Cache_DRAM_tRCD;//tRCD parameter to access DRAM in the data cache, the unit is nano-seconds
 	static sim_time_type Data_Cache_DRAM_tCL;//tCL parameter to access DRAM in the data cache, the unit is nano-seconds
 	static sim_time_type Data_Cache_DRAM_tRP;//tRP parameter to access DRAM in the data cache, the unit is nano-seconds
+	static unsigned int Data_Cache_Bloom_Filter_Capacity;//The number of distinct LPAs per flow that the hot data filter of the advanced data cache holds in one period at its false-positive rate
+	static double Data_Cache_Bloom_Filter_False_Positive_Rate;
+	static sim_time_type Data_Cache_Bloom_Filter_Reset_Period;//The hot data filter forgets the LPAs written before the last reset, the unit is nano-seconds
 	static SSD_Components::Flash_Address_Mapping_Type Address_Mapping;
 	static bool Ideal_Mapping_Table;//If mapping is ideal, then all the mapping entries are found in the DRAM and there is no need to read mapping entries from flash
 	static unsigned int CMT_Capacity;//Size of SRAM/DRAM space that is used to cache address mapping table, the unit is bytes
 	static SSD_Components::CMT_Sharing_Mode CMT_Sharing_Mode;//How the entire CMT space is shared among concurrently running flows
 	static SSD_Components::Flash_Plane_Allocation_Scheme_Type Plane_Allocation_Scheme;
 	static SSD_Components::Flash_Scheduling_Type Transaction_Scheduling_Policy;
+	static SSD_Components::Flash_Priority_Scheduling_Type Transaction_Priority_Scheduling;//How demand reads, prefetch reads, write-backs and GC share a chip
+	static unsigned int Transaction_Priority_Weights[SSD_Components::TRANSACTION_PRIORITY_CLASS_COUNT];//The weights of the priority classes in the same order, used by weighted scheduling
 	static double Overprovisioning_Ratio;//The ratio of spare space with respect to the whole available storage space of SSD
 	static double GC_Exec_Threshold;//The threshold for the ratio of free pages that used to trigger GC
 	static SSD_Components::GC_Block_Selection_Policy_Type GC_Block_Selection_Policy;
@@ -49,11 +54,15 @@ public:
 	static sim_time_type Preferred_suspend_erase_time_for_read;//in nano-seconds, if the remaining time of the ongoing erase is smaller than Prefered_suspend_erase_time_for_read, then the ongoing erase operation will be suspended
 	static sim_time_type Preferred_suspend_erase_time_for_write;//in nano-seconds, if the remaining time of the ongoing erase is smaller than Prefered_suspend_erase_time_for_write, then the ongoing erase operation will be suspended
 	static sim_time_type Preferred_suspend_write_time_for_read;//in nano-seconds, if the remaining time of the ongoing write is smaller than Prefered_suspend_write_time_for_read, then the ongoing erase operation will be suspended
+	static sim_time_type Read_Latency_SLO;//in nano-seconds, if it is not zero, an ongoing program or erase is suspended only if the projected latency of a queued demand read exceeds it
+	static unsigned int Max_Suspensions_Per_Operation;//The number of times that a program or erase can be suspended for the Read_Latency_SLO
+	static sim_time_type Write_Batching_Window;//in nano-seconds, if it is not zero, user writes are staged for up to this time to form multi-plane and multi-die programs
 	static unsigned int Flash_Channel_Count;
 	static unsigned int Flash_Channel_Width;//Channel width in byte
 	static unsigned int Channel_Transfer_Rate;//MT/s
 	static unsigned int Chip_No_Per_Channel;
 	static SSD_Components::ONFI_Protocol Flash_Comm_Protocol;
+	static unsigned int Placement_Handle_Count;//The number of user write frontiers per plane and stream, the placement ID of a write selects one of them
 	static Flash_Parameter_Set Flash_Parameters;
 	void XML_serialize(Utils::XmlWriter& xmlwriter);
 	void XML_deserialize(rapidxml::xml_node<> *node);
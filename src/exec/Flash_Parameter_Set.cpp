@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <string.h>
+#include <sstream>
 #include "../sim/Engine.h"
 #include "Flash_Parameter_Set.h"
 
@@ -21,6 +22,30 @@ unsigned int Flash_Parameter_Set::Block_No_Per_Plane = 2048;
 unsigned int Flash_Parameter_Set::Page_No_Per_Block = 256;//Page no per block
 unsigned int Flash_Parameter_Set::Page_Capacity = 8192;//Flash page capacity in bytes
 unsigned int Flash_Parameter_Set::Page_Metadat_Capacity = 1872;//Flash page capacity in bytes
+bool Flash_Parameter_Set::Read_Retry_Model = false;//Enables the read-retry/soft-decode error model of the flash chips
+unsigned int Flash_Parameter_Set::Initial_PE_Cycles = 0;//The P/E cycle count of all blocks at the start of the simulation
+double Flash_Parameter_Set::Initial_Retention_Hours = 0;//The age of the preconditioned data in hours
+double Flash_Parameter_Set::Base_RBER = 0.0001;//Raw bit error rate of a fresh block
+double Flash_Parameter_Set::Wear_RBER_Factor = 20;//RBER growth at Block_PE_Cycles_Limit relative to a fresh block
+double Flash_Parameter_Set::Retention_RBER_Factor = 1;//RBER growth per decade of retention hours
+double Flash_Parameter_Set::Read_Disturb_RBER_Per_Read = 0.000000002;//RBER added by each read to the same block since its last erase
+double Flash_Parameter_Set::ECC_Correctable_RBER = 0.004;//The RBER at which hard-decision decoding starts failing
+unsigned int Flash_Parameter_Set::Max_Read_Retry_Steps = 8;
+double Flash_Parameter_Set::Read_Retry_Step_Gain = 0.6;//The fraction of raw bit errors left after each read reference shift
+sim_time_type Flash_Parameter_Set::Read_Retry_Step_Overhead = 1000;//in nano-seconds
+sim_time_type Flash_Parameter_Set::Soft_Decode_Latency = 30000;//in nano-seconds
+NVM::FlashMemory::Cache_Command_Mode Flash_Parameter_Set::CMD_Cache_Support = NVM::FlashMemory::Cache_Command_Mode::NONE;
+sim_time_type Flash_Parameter_Set::Cache_Read_Busy_Time = 3000;//tRCBSY: moving a sensed page to the cache register, in nano-seconds
+sim_time_type Flash_Parameter_Set::Cache_Program_Busy_Time = 3000;//tCBSY: moving the data in the cache register to the page register, in nano-seconds
+bool Flash_Parameter_Set::Page_Register_Read_Reuse = false;//A read of a page that is still in the page register of its plane skips the sensing (tR)
+
+//std::to_string only keeps six decimal digits, which is not enough for bit error rates
+static std::string error_rate_to_string(double error_rate)
+{
+	std::ostringstream oss;
+	oss << error_rate;
+	return oss.str();
+}
 
 void Flash_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 {
@@ -128,6 +153,85 @@ void Flash_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 	val = std::to_string(Page_Metadat_Capacity);
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Read_Retry_Model";
+	val = (Read_Retry_Model ? "true" : "false");
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Initial_PE_Cycles";
+	val = std::to_string(Initial_PE_Cycles);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Initial_Retention_Hours";
+	val = std::to_string(Initial_Retention_Hours);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Base_RBER";
+	val = error_rate_to_string(Base_RBER);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Wear_RBER_Factor";
+	val = std::to_string(Wear_RBER_Factor);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Retention_RBER_Factor";
+	val = std::to_string(Retention_RBER_Factor);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Read_Disturb_RBER_Per_Read";
+	val = error_rate_to_string(Read_Disturb_RBER_Per_Read);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "ECC_Correctable_RBER";
+	val = error_rate_to_string(ECC_Correctable_RBER);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Max_Read_Retry_Steps";
+	val = std::to_string(Max_Read_Retry_Steps);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Read_Retry_Step_Gain";
+	val = std::to_string(Read_Retry_Step_Gain);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Read_Retry_Step_Overhead";
+	val = std::to_string(Read_Retry_Step_Overhead);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Soft_Decode_Latency";
+	val = std::to_string(Soft_Decode_Latency);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "CMD_Cache_Support";
+	switch (CMD_Cache_Support) {
+		case NVM::FlashMemory::Cache_Command_Mode::NONE:
+			val = "NONE";
+			break;
+		case NVM::FlashMemory::Cache_Command_Mode::READ:
+			val = "READ";
+			break;
+		case NVM::FlashMemory::Cache_Command_Mode::PROGRAM:
+			val = "PROGRAM";
+			break;
+		case NVM::FlashMemory::Cache_Command_Mode::READ_PROGRAM:
+			val = "READ_PROGRAM";
+			break;
+		default:
+			break;
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Cache_Read_Busy_Time";
+	val = std::to_string(Cache_Read_Busy_Time);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Cache_Program_Busy_Time";
+	val = std::to_string(Cache_Program_Busy_Time);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Page_Register_Read_Reuse";
+	val = (Page_Register_Read_Reuse ? "true" : "false");
+	xmlwriter.Write_attribute_string(attr, val);
+
 	xmlwriter.Write_close_tag();
 }
 
@@ -207,6 +311,67 @@ void Flash_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
 			} else if (strcmp(param->name(), "Page_Metadat_Capacity") == 0) {
 				std::string val = param->value();
 				Page_Metadat_Capacity = std::stoul(val);
+			} else if (strcmp(param->name(), "Read_Retry_Model") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				Read_Retry_Model = (val.compare("FALSE") == 0 ? false : true);
+			} else if (strcmp(param->name(), "Initial_PE_Cycles") == 0) {
+				std::string val = param->value();
+				Initial_PE_Cycles = std::stoul(val);
+			} else if (strcmp(param->name(), "Initial_Retention_Hours") == 0) {
+				std::string val = param->value();
+				Initial_Retention_Hours = std::stod(val);
+			} else if (strcmp(param->name(), "Base_RBER") == 0) {
+				std::string val = param->value();
+				Base_RBER = std::stod(val);
+			} else if (strcmp(param->name(), "Wear_RBER_Factor") == 0) {
+				std::string val = param->value();
+				Wear_RBER_Factor = std::stod(val);
+			} else if (strcmp(param->name(), "Retention_RBER_Factor") == 0) {
+				std::string val = param->value();
+				Retention_RBER_Factor = std::stod(val);
+			} else if (strcmp(param->name(), "Read_Disturb_RBER_Per_Read") == 0) {
+				std::string val = param->value();
+				Read_Disturb_RBER_Per_Read = std::stod(val);
+			} else if (strcmp(param->name(), "ECC_Correctable_RBER") == 0) {
+				std::string val = param->value();
+				ECC_Correctable_RBER = std::stod(val);
+			} else if (strcmp(param->name(), "Max_Read_Retry_Steps") == 0) {
+				std::string val = param->value();
+				Max_Read_Retry_Steps = std::stoul(val);
+			} else if (strcmp(param->name(), "Read_Retry_Step_Gain") == 0) {
+				std::string val = param->value();
+				Read_Retry_Step_Gain = std::stod(val);
+			} else if (strcmp(param->name(), "Read_Retry_Step_Overhead") == 0) {
+				std::string val = param->value();
+				Read_Retry_Step_Overhead = std::stoull(val);
+			} else if (strcmp(param->name(), "Soft_Decode_Latency") == 0) {
+				std::string val = param->value();
+				Soft_Decode_Latency = std::stoull(val);
+			} else if (strcmp(param->name(), "CMD_Cache_Support") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				if (strcmp(val.c_str(), "NONE") == 0) {
+					CMD_Cache_Support = NVM::FlashMemory::Cache_Command_Mode::NONE;
+				} else if (strcmp(val.c_str(), "READ") == 0) {
+					CMD_Cache_Support = NVM::FlashMemory::Cache_Command_Mode::READ;
+				} else if (strcmp(val.c_str(), "PROGRAM") == 0) {
+					CMD_Cache_Support = NVM::FlashMemory::Cache_Command_Mode::PROGRAM;
+				} else if (strcmp(val.c_str(), "READ_PROGRAM") == 0) {
+					CMD_Cache_Support = NVM::FlashMemory::Cache_Command_Mode::READ_PROGRAM;
+				} else {
+					PRINT_ERROR("Unknown cache command support specified in the input file")
+				}
+			} else if (strcmp(param->name(), "Cache_Read_Busy_Time") == 0) {
+				std::string val = param->value();
+				Cache_Read_Busy_Time = std::stoull(val);
+			} else if (strcmp(param->name(), "Cache_Program_Busy_Time") == 0) {
+				std::string val = param->value();
+				Cache_Program_Busy_Time = std::stoull(val);
+			} else if (strcmp(param->name(), "Page_Register_Read_Reuse") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				Page_Register_Read_Reuse = (val.compare("FALSE") == 0 ? false : true);
 			}
 		}
 	} catch (...) {
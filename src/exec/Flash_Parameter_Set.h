@@ -26,6 +26,22 @@ public:
 	static unsigned int Page_No_Per_Block;//Page no per block
 	static unsigned int Page_Capacity;//Flash page capacity in bytes
 	static unsigned int Page_Metadat_Capacity;//Flash page metadata capacity in bytes
+	static bool Read_Retry_Model;//Enables the read-retry/soft-decode error model of the flash chips
+	static unsigned int Initial_PE_Cycles;//The P/E cycle count of all blocks at the start of the simulation
+	static double Initial_Retention_Hours;//The age of the preconditioned data in hours
+	static double Base_RBER;//Raw bit error rate of a fresh block
+	static double Wear_RBER_Factor;//RBER growth at Block_PE_Cycles_Limit relative to a fresh block
+	static double Retention_RBER_Factor;//RBER growth per decade of retention hours
+	static double Read_Disturb_RBER_Per_Read;//RBER added by each read to the same block since its last erase
+	static double ECC_Correctable_RBER;//The RBER at which hard-decision decoding starts failing
+	static unsigned int Max_Read_Retry_Steps;
+	static double Read_Retry_Step_Gain;//The fraction of raw bit errors left after each read reference shift
+	static sim_time_type Read_Retry_Step_Overhead;//in nano-seconds
+	static sim_time_type Soft_Decode_Latency;//in nano-seconds
+	static NVM::FlashMemory::Cache_Command_Mode CMD_Cache_Support;
+	static sim_time_type Cache_Read_Busy_Time;//tRCBSY: moving a sensed page to the cache register, in nano-seconds
+	static sim_time_type Cache_Program_Busy_Time;//tCBSY: moving the data in the cache register to the page register, in nano-seconds
+	static bool Page_Register_Read_Reuse;//A read of a page that is still in the page register of its plane skips the sensing (tR)
 	void XML_serialize(Utils::XmlWriter& xmlwriter);
 	void XML_deserialize(rapidxml::xml_node<> *node);
 };
@@ -6,6 +6,7 @@
 #include "../host/PCIe_Root_Complex.h"
 #include "../host/IO_Flow_Synthetic.h"
 #include "../host/IO_Flow_Trace_Based.h"
+#include "../host/IO_Flow_CPU_Cores.h"
 #include "../utils/StringTools.h"
 #include "../utils/Logical_Address_Partitioning_Unit.h"
 
@@ -42,6 +43,17 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 
 	this->PCIe_switch->cxl_pcie = this->cxl_pcie;
 
+	const cxl_config& cxl_config_para = ((SSD_Components::Host_Interface_CXL*)ssd_host_interface)->cxl_man->cxl_config_para;
+	if (cxl_config_para.link_model) {
+		this->cxl_link = new Host_Components::CXL_Link(this->ID() + ".CXLLink", cxl_config_para, this->cxl_pcie, this->PCIe_switch);
+		this->cxl_pcie->Set_cxl_link(this->cxl_link);
+		((SSD_Components::Host_Interface_CXL*)ssd_host_interface)->cxl_dram->Connect_to_access_serviced_signal(Host_Components::CXL_Link::Handle_access_serviced);
+		Simulator->AddObject(this->cxl_link);
+	}
+	else {
+		this->cxl_link = NULL;
+	}
+
 
 	//Create IO flows
 	LHA_type address_range_per_flow = ssd_host_interface->Get_max_logical_sector_address() / parameters->IO_Flow_Definitions.size();
@@ -79,7 +91,7 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 					Utils::Logical_Address_Partitioning_Unit::Start_lha_available_to_flow(flow_id),
 					Utils::Logical_Address_Partitioning_Unit::End_lha_available_to_flow(flow_id),
 					((double)flow_param->Working_Set_Percentage / 100.0), FLOW_ID_TO_Q_ID(flow_id), nvme_sq_size, nvme_cq_size,
-					flow_param->Priority_Class, flow_param->Read_Percentage / double(100.0), flow_param->Address_Distribution, flow_param->Percentage_of_Hot_Region / double(100.0),
+					flow_param->Priority_Class, flow_param->Read_Percentage / double(100.0), flow_param->Address_Distribution, flow_param->Percentage_of_Hot_Region / double(100.0), flow_param->Zipf_Theta, flow_param->Address_Histogram,
 					flow_param->Request_Size_Distribution, flow_param->Average_Request_Size, flow_param->Variance_Request_Size,
 					flow_param->Synthetic_Generator_Type, (flow_param->Bandwidth == 0? 0 :NanoSecondCoeff / ((flow_param->Bandwidth / SECTOR_SIZE_IN_BYTE) / flow_param->Average_Request_Size)),
 					flow_param->Average_No_of_Reqs_in_Queue, flow_param->Generated_Aligned_Addresses, flow_param->Address_Alignment_Unit,
@@ -100,8 +112,29 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 					ssd_host_interface->GetType(), this->PCIe_root_complex, this->SATA_hba,
 					parameters->Enable_ResponseTime_Logging, parameters->ResponseTime_Logging_Period_Length, parameters->Input_file_path + ".IO_Flow.No_" + std::to_string(flow_id) + ".log", this->cxl_pcie);
 
+				((Host_Components::IO_Flow_Trace_Based*)io_flow)->Set_cxl_manager(((SSD_Components::Host_Interface_CXL*)ssd_host_interface)->cxl_man);
+
 				this->IO_flows.push_back(io_flow);
-				this->cxl_pcie->Set_io_flow(io_flow);
+				this->cxl_pcie->Set_io_flow(flow_id, io_flow, flow_id < cxl_config_para.host_weights.size() ? cxl_config_para.host_weights[flow_id] : 1);
+				break;
+			}
+			case Flow_Type::CPU_CORES: {
+				IO_Flow_Parameter_Set_CPU_Cores* flow_param = (IO_Flow_Parameter_Set_CPU_Cores*)parameters->IO_Flow_Definitions[flow_id];
+				if (flow_param->Working_Set_Percentage > 100 || flow_param->Working_Set_Percentage < 1) {
+					flow_param->Working_Set_Percentage = 100;
+				}
+				io_flow = new Host_Components::IO_Flow_CPU_Cores(this->ID() + ".IO_Flow.CPU.No_" + std::to_string(flow_id), flow_id,
+					Utils::Logical_Address_Partitioning_Unit::Start_lha_available_to_flow(flow_id), Utils::Logical_Address_Partitioning_Unit::End_lha_available_to_flow(flow_id),
+					((double)flow_param->Working_Set_Percentage / 100.0), FLOW_ID_TO_Q_ID(flow_id), nvme_sq_size, nvme_cq_size,
+					flow_param->Priority_Class, flow_param->Initial_Occupancy_Percentage / double(100.0),
+					flow_param->Core_Count, flow_param->Kernels, flow_param->Accesses_Per_Core, flow_param->ROB_Size, flow_param->MLP,
+					flow_param->Think_Time, flow_param->Read_Percentage / double(100.0), flow_param->Pointer_Chains,
+					flow_param->Address_Distribution, flow_param->Percentage_of_Hot_Region / double(100.0), flow_param->Zipf_Theta, flow_param->Address_Histogram, flow_param->Seed,
+					ssd_host_interface->GetType(), this->PCIe_root_complex, this->SATA_hba,
+					parameters->Enable_ResponseTime_Logging, parameters->ResponseTime_Logging_Period_Length, parameters->Input_file_path + ".IO_Flow.No_" + std::to_string(flow_id) + ".log", this->cxl_pcie);
+
+				this->IO_flows.push_back(io_flow);
+				this->cxl_pcie->Set_io_flow(flow_id, io_flow, flow_id < cxl_config_para.host_weights.size() ? cxl_config_para.host_weights[flow_id] : 1, true);
 				break;
 			}
 			default:
@@ -113,6 +146,11 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 
 	
 
+	//With the link model, the link returns the responses to the host
+	if (this->cxl_link == NULL && this->cxl_pcie->Has_response_consumers()) {
+		((SSD_Components::Host_Interface_CXL*)ssd_host_interface)->cxl_dram->Connect_to_access_serviced_signal(Host_Components::CXL_PCIe::Handle_access_serviced);
+	}
+
 	this->PCIe_root_complex->Set_io_flows(&this->IO_flows);
 	//if (((SSD_Components::Host_Interface_NVMe*)ssd_host_interface)->GetType() == HostInterface_Types::SATA) {
 	//	this->SATA_hba->Set_io_flows(&this->IO_flows);
@@ -128,6 +166,7 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 Host_System::~Host_System() 
 {
 	delete this->Link;
+	delete this->cxl_link;
 	delete this->PCIe_root_complex;
 	delete this->PCIe_switch;
 	if (ssd_device->Host_interface->GetType() == HostInterface_Types::SATA) {
@@ -3,6 +3,7 @@
 #include <set>
 #include <cstring>
 #include <algorithm>
+#include <sstream>
 
 //All serialization and deserialization functions should be replaced by a C++ reflection implementation
 void IO_Flow_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
@@ -256,6 +257,18 @@ void IO_Flow_Parameter_Set_Synthetic::XML_serialize(Utils::XmlWriter& xmlwriter)
 		case Utils::Address_Distribution_Type::RANDOM_UNIFORM:
 			val = "RANDOM_UNIFORM";
 			break;
+		case Utils::Address_Distribution_Type::ZIPF:
+			val = "ZIPF";
+			break;
+		case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+			val = "SCRAMBLED_ZIPF";
+			break;
+		case Utils::Address_Distribution_Type::LATEST:
+			val = "LATEST";
+			break;
+		case Utils::Address_Distribution_Type::EMPIRICAL:
+			val = "EMPIRICAL";
+			break;
 	}
 	xmlwriter.Write_attribute_string(attr, val);
 	 
@@ -264,6 +277,17 @@ void IO_Flow_Parameter_Set_Synthetic::XML_serialize(Utils::XmlWriter& xmlwriter)
 	val = std::to_string(Percentage_of_Hot_Region);
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Zipf_Theta";
+	val = std::to_string(Zipf_Theta);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Address_Histogram";
+	val = "";
+	for (auto weight : Address_Histogram) {
+		val += (val.size() > 0 ? "," : "") + std::to_string(weight);
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
 	attr = "Generated_Aligned_Addresses";
 	val = (Generated_Aligned_Addresses ? "true" : "false");
 	xmlwriter.Write_attribute_string(attr, val);
@@ -350,12 +374,32 @@ void IO_Flow_Parameter_Set_Synthetic::XML_deserialize(rapidxml::xml_node<> *node
 					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_HOTCOLD;
 				} else if (strcmp(val.c_str(), "RANDOM_UNIFORM") == 0) {
 					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_UNIFORM;
+				} else if (strcmp(val.c_str(), "ZIPF") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::ZIPF;
+				} else if (strcmp(val.c_str(), "SCRAMBLED_ZIPF") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::SCRAMBLED_ZIPF;
+				} else if (strcmp(val.c_str(), "LATEST") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::LATEST;
+				} else if (strcmp(val.c_str(), "EMPIRICAL") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::EMPIRICAL;
 				} else {
 					PRINT_ERROR("Wrong address distribution type for input synthetic flow")
 				}
 			} else if (strcmp(param->name(), "Percentage_of_Hot_Region") == 0) {
 				std::string val = param->value();
 				Percentage_of_Hot_Region = std::stoi(val);
+			} else if (strcmp(param->name(), "Zipf_Theta") == 0) {
+				std::string val = param->value();
+				Zipf_Theta = std::stod(val);
+			} else if (strcmp(param->name(), "Address_Histogram") == 0) {
+				std::string val = param->value();
+				std::replace(val.begin(), val.end(), ',', ' ');
+				std::istringstream weights(val);
+				double weight;
+				Address_Histogram.clear();
+				while (weights >> weight) {
+					Address_Histogram.push_back(weight);
+				}
 			} else if (strcmp(param->name(), "Generated_Aligned_Addresses") == 0) {
 				std::string val = param->value();
 				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
@@ -477,4 +521,191 @@ void IO_Flow_Parameter_Set_Trace_Based::XML_deserialize(rapidxml::xml_node<> *no
 	} catch (...) {
 		PRINT_ERROR("Error in IO_Flow_Parameter_Set_Trace_Based!")
 	}
-}
\ No newline at end of file
+}
+
+static const char* cpu_kernel_names[] = { "STREAM", "GATHER", "POINTER_CHASE", "HASH_PROBE" };
+
+void IO_Flow_Parameter_Set_CPU_Cores::XML_serialize(Utils::XmlWriter& xmlwriter)
+{
+	std::string tmp = "IO_Flow_Parameter_Set_CPU_Cores";
+	xmlwriter.Write_open_tag(tmp);
+	IO_Flow_Parameter_Set::XML_serialize(xmlwriter);
+
+	std::string attr = "Core_Count";
+	std::string val = std::to_string(Core_Count);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Kernels";
+	val = "";
+	for (unsigned int i = 0; i < Kernels.size(); i++) {
+		if (i > 0) {
+			val += ",";
+		}
+		val += cpu_kernel_names[(int)Kernels[i]];
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Accesses_Per_Core";
+	val = std::to_string(Accesses_Per_Core);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "ROB_Size";
+	val = std::to_string(ROB_Size);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "MLP";
+	val = std::to_string(MLP);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Think_Time";
+	val = std::to_string(Think_Time);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Read_Percentage";
+	val = std::to_string(Read_Percentage);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Pointer_Chains";
+	val = std::to_string(Pointer_Chains);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Working_Set_Percentage";
+	val = std::to_string(Working_Set_Percentage);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Address_Distribution";
+	switch (Address_Distribution) {
+		case Utils::Address_Distribution_Type::RANDOM_HOTCOLD:
+			val = "RANDOM_HOTCOLD";
+			break;
+		case Utils::Address_Distribution_Type::ZIPF:
+			val = "ZIPF";
+			break;
+		case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+			val = "SCRAMBLED_ZIPF";
+			break;
+		case Utils::Address_Distribution_Type::EMPIRICAL:
+			val = "EMPIRICAL";
+			break;
+		default:
+			val = "RANDOM_UNIFORM";
+			break;
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Percentage_of_Hot_Region";
+	val = std::to_string(Percentage_of_Hot_Region);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Zipf_Theta";
+	val = std::to_string(Zipf_Theta);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Address_Histogram";
+	val = "";
+	for (auto weight : Address_Histogram) {
+		val += (val.size() > 0 ? "," : "") + std::to_string(weight);
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Seed";
+	val = std::to_string(Seed);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	xmlwriter.Write_close_tag();
+}
+
+void IO_Flow_Parameter_Set_CPU_Cores::XML_deserialize(rapidxml::xml_node<> *node)
+{
+	IO_Flow_Parameter_Set::XML_deserialize(node);
+
+	try {
+		for (auto param = node->first_node(); param; param = param->next_sibling()) {
+			if (strcmp(param->name(), "Core_Count") == 0) {
+				std::string val = param->value();
+				Core_Count = std::stoul(val);
+			} else if (strcmp(param->name(), "Kernels") == 0) {
+				Kernels.clear();
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				std::string::size_type start = 0;
+				while (start <= val.size()) {
+					std::string::size_type end = val.find(',', start);
+					if (end == std::string::npos) {
+						end = val.size();
+					}
+					std::string kernel = val.substr(start, end - start);
+					kernel.erase(std::remove_if(kernel.begin(), kernel.end(), ::isspace), kernel.end());
+					bool found = false;
+					for (int k = 0; k < 4; k++) {
+						if (kernel == cpu_kernel_names[k]) {
+							Kernels.push_back((Host_Components::CPU_Kernel_Type)k);
+							found = true;
+						}
+					}
+					if (!found) {
+						PRINT_ERROR("Unknown CPU kernel specified in the input file: " << kernel)
+					}
+					start = end + 1;
+				}
+			} else if (strcmp(param->name(), "Accesses_Per_Core") == 0) {
+				std::string val = param->value();
+				Accesses_Per_Core = std::stoul(val);
+			} else if (strcmp(param->name(), "ROB_Size") == 0) {
+				std::string val = param->value();
+				ROB_Size = std::stoul(val);
+			} else if (strcmp(param->name(), "MLP") == 0) {
+				std::string val = param->value();
+				MLP = std::stoul(val);
+			} else if (strcmp(param->name(), "Think_Time") == 0) {
+				std::string val = param->value();
+				Think_Time = std::stoull(val);
+			} else if (strcmp(param->name(), "Read_Percentage") == 0) {
+				std::string val = param->value();
+				Read_Percentage = std::stoul(val);
+			} else if (strcmp(param->name(), "Pointer_Chains") == 0) {
+				std::string val = param->value();
+				Pointer_Chains = std::stoul(val);
+			} else if (strcmp(param->name(), "Working_Set_Percentage") == 0) {
+				std::string val = param->value();
+				Working_Set_Percentage = std::stoul(val);
+			} else if (strcmp(param->name(), "Address_Distribution") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				if (strcmp(val.c_str(), "RANDOM_UNIFORM") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_UNIFORM;
+				} else if (strcmp(val.c_str(), "RANDOM_HOTCOLD") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_HOTCOLD;
+				} else if (strcmp(val.c_str(), "ZIPF") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::ZIPF;
+				} else if (strcmp(val.c_str(), "SCRAMBLED_ZIPF") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::SCRAMBLED_ZIPF;
+				} else if (strcmp(val.c_str(), "EMPIRICAL") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::EMPIRICAL;
+				} else {
+					PRINT_ERROR("Wrong address distribution type for input CPU cores flow")
+				}
+			} else if (strcmp(param->name(), "Percentage_of_Hot_Region") == 0) {
+				std::string val = param->value();
+				Percentage_of_Hot_Region = std::stoul(val);
+			} else if (strcmp(param->name(), "Zipf_Theta") == 0) {
+				std::string val = param->value();
+				Zipf_Theta = std::stod(val);
+			} else if (strcmp(param->name(), "Address_Histogram") == 0) {
+				std::string val = param->value();
+				std::replace(val.begin(), val.end(), ',', ' ');
+				std::istringstream weights(val);
+				double weight;
+				Address_Histogram.clear();
+				while (weights >> weight) {
+					Address_Histogram.push_back(weight);
+				}
+			} else if (strcmp(param->name(), "Seed") == 0) {
+				std::string val = param->value();
+				Seed = std::stoi(val);
+			}
+		}
+	} catch (...) {
+		PRINT_ERROR("Error in IO_Flow_Parameter_Set_CPU_Cores!")
+	}
+}
@@ -2,15 +2,17 @@
 #define IO_FLOW_PARAMETER_SET_H
 
 #include <string>
+#include <vector>
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "../ssd/Host_Interface_Defs.h"
 #include "../host/IO_Flow_Synthetic.h"
 #include "../host/IO_Flow_Trace_Based.h"
+#include "../host/IO_Flow_CPU_Cores.h"
 #include "../utils/Workload_Statistics.h"
 #include "../utils/DistributionTypes.h"
 #include "Parameter_Set_Base.h"
 
-enum class Flow_Type { SYNTHETIC, TRACE };
+enum class Flow_Type { SYNTHETIC, TRACE, CPU_CORES };
 class IO_Flow_Parameter_Set : public Parameter_Set_Base
 {
 public:
@@ -38,6 +40,8 @@ public:
 	char Read_Percentage;
 	Utils::Address_Distribution_Type Address_Distribution;
 	char Percentage_of_Hot_Region;//This parameters used if the address distribution type is hot/cold (i.e., (100-H)% of the whole I/O requests are going to a H% hot region of the storage space)
+	double Zipf_Theta = 0.99;//Skew of the ZIPF, SCRAMBLED_ZIPF and LATEST address distributions
+	std::vector<double> Address_Histogram;//Relative access frequencies of equal slices of the working set, used by the EMPIRICAL address distribution
 	bool Generated_Aligned_Addresses;
 	unsigned int Address_Alignment_Unit;
 	Utils::Request_Size_Distribution_Type Request_Size_Distribution;
@@ -67,4 +71,27 @@ public:
 	void XML_deserialize(rapidxml::xml_node<> *node);
 };
 
+class IO_Flow_Parameter_Set_CPU_Cores : public IO_Flow_Parameter_Set
+{
+public:
+	IO_Flow_Parameter_Set_CPU_Cores() { this->Type = Flow_Type::CPU_CORES; }
+	unsigned int Core_Count = 4;
+	std::vector<Host_Components::CPU_Kernel_Type> Kernels = { Host_Components::CPU_Kernel_Type::STREAM };//Assigned to the cores in round robin
+	unsigned int Accesses_Per_Core = 10000;
+	unsigned int ROB_Size = 64;//Memory operations in the reorder buffer of a core
+	unsigned int MLP = 10;//Misses that a core can have in flight
+	sim_time_type Think_Time = 10;//Computation between two memory operations of a core, in nanoseconds
+	unsigned int Read_Percentage = 100;
+	unsigned int Pointer_Chains = 1;//Independent chains of a pointer-chase core
+	unsigned int Working_Set_Percentage = 100;
+	Utils::Address_Distribution_Type Address_Distribution = Utils::Address_Distribution_Type::RANDOM_UNIFORM;//Of the random lines of the GATHER, POINTER_CHASE and HASH_PROBE kernels
+	unsigned int Percentage_of_Hot_Region = 20;
+	double Zipf_Theta = 0.99;
+	std::vector<double> Address_Histogram;
+	int Seed = 12344;
+
+	void XML_serialize(Utils::XmlWriter& xmlwriter);
+	void XML_deserialize(rapidxml::xml_node<> *node);
+};
+
 #endif // !IO_FLOW_PARAMETER_SET_H
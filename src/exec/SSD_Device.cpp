@@ -13,6 +13,7 @@
 #include "../ssd/TSU_OutofOrder.h"
 #include "../ssd/TSU_FLIN.h"
 #include "../ssd/ONFI_Channel_NVDDR2.h"
+#include "../ssd/ONFI_Channel_HighSpeed.h"
 #include "../ssd/NVM_PHY_ONFI_NVDDR2.h"
 #include "../utils/Logical_Address_Partitioning_Unit.h"
 
@@ -70,11 +71,28 @@ SSD_Device::SSD_Device(Device_Parameter_Set* parameters, std::vector<IO_Flow_Par
 					throw std::invalid_argument("The specified flash technologies is not supported");
 			}
 
+			NVM::FlashMemory::Read_Retry_Parameters read_retry_parameters;
+			read_retry_parameters.Enabled = parameters->Flash_Parameters.Read_Retry_Model;
+			read_retry_parameters.Rated_PE_cycles = parameters->Flash_Parameters.Block_PE_Cycles_Limit;
+			read_retry_parameters.Initial_PE_cycles = parameters->Flash_Parameters.Initial_PE_Cycles;
+			read_retry_parameters.Initial_retention_hours = parameters->Flash_Parameters.Initial_Retention_Hours;
+			read_retry_parameters.Base_RBER = parameters->Flash_Parameters.Base_RBER;
+			read_retry_parameters.Wear_RBER_factor = parameters->Flash_Parameters.Wear_RBER_Factor;
+			read_retry_parameters.Retention_RBER_factor = parameters->Flash_Parameters.Retention_RBER_Factor;
+			read_retry_parameters.Read_disturb_RBER_per_read = parameters->Flash_Parameters.Read_Disturb_RBER_Per_Read;
+			read_retry_parameters.ECC_correctable_RBER = parameters->Flash_Parameters.ECC_Correctable_RBER;
+			read_retry_parameters.Max_retry_steps = parameters->Flash_Parameters.Max_Read_Retry_Steps;
+			read_retry_parameters.Retry_step_RBER_reduction = parameters->Flash_Parameters.Read_Retry_Step_Gain;
+			read_retry_parameters.Retry_step_overhead = parameters->Flash_Parameters.Read_Retry_Step_Overhead;
+			read_retry_parameters.Soft_decode_latency = parameters->Flash_Parameters.Soft_Decode_Latency;
+
 			//Step 2: create memory channels to connect chips to the controller
 			this->Channel_count = parameters->Flash_Channel_Count;
 			this->Chip_no_per_channel = parameters->Chip_No_Per_Channel;
 			switch (parameters->Flash_Comm_Protocol) {
-				case SSD_Components::ONFI_Protocol::NVDDR2: {
+				case SSD_Components::ONFI_Protocol::NVDDR2:
+				case SSD_Components::ONFI_Protocol::NVDDR3:
+				case SSD_Components::ONFI_Protocol::TOGGLE: {
 					SSD_Components::ONFI_Channel_NVDDR2** channels = new SSD_Components::ONFI_Channel_NVDDR2*[parameters->Flash_Channel_Count];
 					for (unsigned int channel_cntr = 0; channel_cntr < parameters->Flash_Channel_Count; channel_cntr++) {
 						NVM::FlashMemory::Flash_Chip** chips = new NVM::FlashMemory::Flash_Chip*[parameters->Chip_No_Per_Channel];
@@ -83,12 +101,19 @@ SSD_Device::SSD_Device(Device_Parameter_Set* parameters, std::vector<IO_Flow_Par
 								channel_cntr, chip_cntr, parameters->Flash_Parameters.Flash_Technology, parameters->Flash_Parameters.Die_No_Per_Chip, parameters->Flash_Parameters.Plane_No_Per_Die,
 								parameters->Flash_Parameters.Block_No_Per_Plane, parameters->Flash_Parameters.Page_No_Per_Block,
 								read_latencies, write_latencies, parameters->Flash_Parameters.Block_Erase_Latency,
-								parameters->Flash_Parameters.Suspend_Program_Time, parameters->Flash_Parameters.Suspend_Erase_Time);
+								parameters->Flash_Parameters.Suspend_Program_Time, parameters->Flash_Parameters.Suspend_Erase_Time,
+								parameters->Flash_Parameters.Cache_Read_Busy_Time, parameters->Flash_Parameters.Cache_Program_Busy_Time,
+								parameters->Flash_Parameters.Page_Register_Read_Reuse, read_retry_parameters, (read_retry_parameters.Enabled ? parameters->Seed++ : parameters->Seed));
 							Simulator->AddObject(chips[chip_cntr]);//Each simulation object (a child of MQSimEngine::Sim_Object) should be added to the engine
 						}
-						channels[channel_cntr] = new SSD_Components::ONFI_Channel_NVDDR2(channel_cntr, parameters->Chip_No_Per_Channel,
-							chips, parameters->Flash_Channel_Width,
-							(sim_time_type)((double)1000 / parameters->Channel_Transfer_Rate) * 2, (sim_time_type)((double)1000 / parameters->Channel_Transfer_Rate) * 2);
+						if (parameters->Flash_Comm_Protocol == SSD_Components::ONFI_Protocol::NVDDR2) {
+							channels[channel_cntr] = new SSD_Components::ONFI_Channel_NVDDR2(channel_cntr, parameters->Chip_No_Per_Channel,
+								chips, parameters->Flash_Channel_Width,
+								(sim_time_type)((double)1000 / parameters->Channel_Transfer_Rate) * 2, (sim_time_type)((double)1000 / parameters->Channel_Transfer_Rate) * 2);
+						} else {
+							channels[channel_cntr] = new SSD_Components::ONFI_Channel_HighSpeed(channel_cntr, parameters->Chip_No_Per_Channel,
+								chips, parameters->Flash_Channel_Width, parameters->Channel_Transfer_Rate, parameters->Flash_Comm_Protocol);
+						}
 						device->Channels.push_back(channels[channel_cntr]);//Channels should not be added to the simulator core, they are passive object that do not handle any simulation event
 					}
 
@@ -127,13 +152,20 @@ SSD_Device::SSD_Device(Device_Parameter_Set* parameters, std::vector<IO_Flow_Par
 				program_suspension = true;
 				erase_suspension = true;
 			}
+			bool cache_read = parameters->Flash_Parameters.CMD_Cache_Support == NVM::FlashMemory::Cache_Command_Mode::READ
+				|| parameters->Flash_Parameters.CMD_Cache_Support == NVM::FlashMemory::Cache_Command_Mode::READ_PROGRAM;
+			bool cache_program = parameters->Flash_Parameters.CMD_Cache_Support == NVM::FlashMemory::Cache_Command_Mode::PROGRAM
+				|| parameters->Flash_Parameters.CMD_Cache_Support == NVM::FlashMemory::Cache_Command_Mode::READ_PROGRAM;
 			switch (parameters->Transaction_Scheduling_Policy) {
 				case SSD_Components::Flash_Scheduling_Type::OUT_OF_ORDER:
 					tsu = new SSD_Components::TSU_OutOfOrder(ftl->ID() + ".TSU", ftl, static_cast<SSD_Components::NVM_PHY_ONFI_NVDDR2*>(device->PHY),
 						parameters->Flash_Channel_Count, parameters->Chip_No_Per_Channel,
-						parameters->Flash_Parameters.Die_No_Per_Chip, parameters->Flash_Parameters.Plane_No_Per_Die,
+						parameters->Flash_Parameters.Die_No_Per_Chip, parameters->Flash_Parameters.Plane_No_Per_Die, parameters->Flash_Parameters.Page_Capacity,
 						parameters->Preferred_suspend_write_time_for_read, parameters->Preferred_suspend_erase_time_for_read, parameters->Preferred_suspend_erase_time_for_write,
-						erase_suspension, program_suspension);
+						erase_suspension, program_suspension, cache_read, cache_program,
+						parameters->Read_Latency_SLO, parameters->Max_Suspensions_Per_Operation,
+						parameters->Transaction_Priority_Scheduling, parameters->Transaction_Priority_Weights,
+						parameters->Write_Batching_Window);
 					break;
 				/*case SSD_Components::Flash_Scheduling_Type::FLIN:
 				{
@@ -166,7 +198,7 @@ SSD_Device::SSD_Device(Device_Parameter_Set* parameters, std::vector<IO_Flow_Par
 			fbm = new SSD_Components::Flash_Block_Manager(NULL, parameters->Flash_Parameters.Block_PE_Cycles_Limit,
 				(unsigned int)io_flows->size(), parameters->Flash_Channel_Count, parameters->Chip_No_Per_Channel,
 				parameters->Flash_Parameters.Die_No_Per_Chip, parameters->Flash_Parameters.Plane_No_Per_Die,
-				parameters->Flash_Parameters.Block_No_Per_Plane, parameters->Flash_Parameters.Page_No_Per_Block);
+				parameters->Flash_Parameters.Block_No_Per_Plane, parameters->Flash_Parameters.Page_No_Per_Block, parameters->Placement_Handle_Count);
 			ftl->BlockManager = fbm;
 
 			//Step 7: create Address_Mapping_Unit
@@ -245,6 +277,9 @@ SSD_Device::SSD_Device(Device_Parameter_Set* parameters, std::vector<IO_Flow_Par
 						parameters->Flash_Parameters.Block_No_Per_Plane, parameters->Flash_Parameters.Page_No_Per_Block,
 						parameters->Flash_Parameters.Page_Capacity / SECTOR_SIZE_IN_BYTE, parameters->Flash_Parameters.Page_Capacity, parameters->Overprovisioning_Ratio,
 						parameters->CMT_Sharing_Mode);
+					if (parameters->Flash_Parameters.Page_Register_Read_Reuse) {
+						((SSD_Components::Address_Mapping_Unit_Page_Level*)amu)->Place_unwritten_reads_on_static_pages();
+					}
 					break;
 				case SSD_Components::Flash_Address_Mapping_Type::HYBRID:
 					amu = new SSD_Components::Address_Mapping_Unit_Hybrid(ftl->ID() + ".AddressMappingUnit", ftl, (SSD_Components::NVM_PHY_ONFI*) device->PHY,
@@ -301,7 +336,8 @@ SSD_Device::SSD_Device(Device_Parameter_Set* parameters, std::vector<IO_Flow_Par
 						parameters->Data_Cache_DRAM_Data_Busrt_Size, parameters->Data_Cache_DRAM_tRCD, parameters->Data_Cache_DRAM_tCL, parameters->Data_Cache_DRAM_tRP,
 						caching_modes, parameters->Data_Cache_Sharing_Mode, (unsigned int)io_flows->size(),
 						parameters->Flash_Parameters.Page_Capacity / SECTOR_SIZE_IN_BYTE, parameters->Flash_Channel_Count * parameters->Chip_No_Per_Channel * parameters->Flash_Parameters.Die_No_Per_Chip * parameters->Flash_Parameters.Plane_No_Per_Die * parameters->Flash_Parameters.Page_Capacity* BUFFERING_SCALE_4K / SECTOR_SIZE_IN_BYTE,
-						parameters->Flash_Channel_Count* parameters->Chip_No_Per_Channel* parameters->Flash_Parameters.Die_No_Per_Chip* parameters->Flash_Parameters.Plane_No_Per_Die*BUFFERING_SCALE_4K);
+						parameters->Flash_Channel_Count* parameters->Chip_No_Per_Channel* parameters->Flash_Parameters.Die_No_Per_Chip* parameters->Flash_Parameters.Plane_No_Per_Die*BUFFERING_SCALE_4K,
+						parameters->Data_Cache_Bloom_Filter_Capacity, parameters->Data_Cache_Bloom_Filter_False_Positive_Rate, parameters->Data_Cache_Bloom_Filter_Reset_Period);
 
 					break;
 				default:
@@ -407,10 +443,14 @@ void SSD_Device::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter
 	xmlwriter.Write_open_tag(tmp);
 
 	this->Host_interface->Report_results_in_XML(ID(), xmlwriter);
+	this->Cache_manager->Report_results_in_XML(ID(), xmlwriter);
 	if (Memory_Type == NVM::NVM_Type::FLASH) {
 		((SSD_Components::FTL*)this->Firmware)->Report_results_in_XML(ID(), xmlwriter);
 		((SSD_Components::FTL*)this->Firmware)->TSU->Report_results_in_XML(ID(), xmlwriter);
 
+		for (unsigned int channel_cntr = 0; channel_cntr < Channel_count; channel_cntr++) {
+			((SSD_Components::ONFI_Channel_Base*)Channels[channel_cntr])->Report_results_in_XML(ID(), xmlwriter);
+		}
 		for (unsigned int channel_cntr = 0; channel_cntr < Channel_count; channel_cntr++) {
 			for (unsigned int chip_cntr = 0; chip_cntr < Chip_no_per_channel; chip_cntr++) {
 				((SSD_Components::ONFI_Channel_NVDDR2*)Channels[channel_cntr])->Chips[chip_cntr]->Report_results_in_XML(ID(), xmlwriter);
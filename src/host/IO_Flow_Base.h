@@ -16,6 +16,7 @@
 #include "PCIe_Root_Complex.h"
 #include "SATA_HBA.h"
 #include "../utils/Workload_Statistics.h"
+#include "../cxl/CXL_Mem_Transaction.h"
 
 namespace Host_Components
 {
@@ -55,6 +56,7 @@ namespace Host_Components
 		Submission_Queue_Entry* NVMe_read_sqe(uint64_t address);
 		const NVMe_Queue_Pair* Get_nvme_queue_pair_info();
 		virtual void SATA_consume_io_request(Host_IO_Request* request);
+		virtual void CXL_consume_response(const CXL_Mem_Transaction& transaction) {}//Only called for the flows that CXL_PCIe notifies of their responses
 		LHA_type Get_start_lsa_on_device();
 		LHA_type Get_end_lsa_address_on_device();
 		uint32_t Get_generated_request_count();
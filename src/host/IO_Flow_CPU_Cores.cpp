@@ -0,0 +1,451 @@
+#include <algorithm>
+#include "../sim/Engine.h"
+#include "IO_Flow_CPU_Cores.h"
+#include "../cxl/OutputLog.h"
+
+#define CPU_LINE_SIZE_IN_BYTES 64
+#define NO_DEPENDENCY UINT64_MAX
+#define GATHER_INDICES_PER_LINE 8//An index line holds the 8B indices of the next 8 gathered elements
+
+namespace Host_Components
+{
+	static const char* kernel_name(CPU_Kernel_Type kernel) {
+		switch (kernel) {
+			case CPU_Kernel_Type::STREAM: return "Stream";
+			case CPU_Kernel_Type::GATHER: return "Gather";
+			case CPU_Kernel_Type::POINTER_CHASE: return "Pointer_chase";
+			case CPU_Kernel_Type::HASH_PROBE: return "Hash_probe";
+		}
+		return "";
+	}
+
+	IO_Flow_CPU_Cores::IO_Flow_CPU_Cores(const sim_object_id_type& name, uint16_t flow_id, LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, double working_set_ratio, uint16_t io_queue_id,
+		uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class priority_class, double initial_occupancy_ratio,
+		unsigned int core_count, const std::vector<CPU_Kernel_Type>& kernels, unsigned int accesses_per_core, unsigned int rob_size, unsigned int mlp,
+		sim_time_type think_time, double read_ratio, unsigned int pointer_chains,
+		Utils::Address_Distribution_Type address_distribution, double hot_region_ratio, double zipf_theta, const std::vector<double>& address_histogram, int seed,
+		HostInterface_Types SSD_device_type, PCIe_Root_Complex* pcie_root_complex, SATA_HBA* sata_hba,
+		bool enabled_logging, sim_time_type logging_period, std::string logging_file_path, CXL_PCIe* cxl_pcie) :
+		IO_Flow_Base(name, flow_id, start_lsa_on_device, LHA_type(start_lsa_on_device + (end_lsa_on_device - start_lsa_on_device) * working_set_ratio), io_queue_id, nvme_submission_queue_size, nvme_completion_queue_size, priority_class, 0, initial_occupancy_ratio, core_count * accesses_per_core, SSD_device_type, pcie_root_complex, sata_hba, enabled_logging, logging_period, logging_file_path),
+		cxl_pcie(cxl_pcie), accesses_per_core(accesses_per_core), rob_size(rob_size), mlp(mlp), think_time(think_time), read_ratio(read_ratio),
+		pointer_chains(pointer_chains), working_set_ratio(working_set_ratio), seed(seed), address_distribution(address_distribution), hot_region_ratio(hot_region_ratio),
+		zipf_generator(NULL), histogram_table(NULL), finished_core_count(0)
+	{
+		if (core_count == 0 || kernels.size() == 0) {
+			PRINT_ERROR("IO flow " << name << ": at least one core and one kernel should be defined!")
+		}
+		if (accesses_per_core == 0 || rob_size == 0 || mlp == 0 || pointer_chains == 0) {
+			PRINT_ERROR("IO flow " << name << ": the accesses per core, the ROB size, the MLP and the pointer chains should be greater than zero!")
+		}
+		if ((uint64_t)core_count * mlp > UINT16_MAX + 1) {
+			PRINT_ERROR("IO flow " << name << ": the cores can not have more than " << UINT16_MAX + 1 << " requests in flight!")
+		}
+		if (this->working_set_ratio == 0) {
+			PRINT_ERROR("The working set ratio is set to zero for workload " << name)
+		}
+
+		line_count = (this->end_lsa_on_device - this->start_lsa_on_device + 1) * SECTOR_SIZE_IN_BYTE / CPU_LINE_SIZE_IN_BYTES;
+		hot_line_count = 0;
+		switch (address_distribution) {
+			case Utils::Address_Distribution_Type::RANDOM_UNIFORM:
+				break;
+			case Utils::Address_Distribution_Type::RANDOM_HOTCOLD:
+				if (hot_region_ratio <= 0 || hot_region_ratio >= 1) {
+					PRINT_ERROR("IO flow " << name << ": the hot region should be between 1 and 99 percent of the working set!")
+				}
+				hot_line_count = std::max((uint64_t)1, (uint64_t)(line_count * hot_region_ratio));
+				break;
+			case Utils::Address_Distribution_Type::ZIPF:
+			case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+				if (zipf_theta < 0) {
+					PRINT_ERROR("The Zipf theta of workload " << name << " should not be negative")
+				}
+				zipf_generator = new Utils::Zipf_Generator(line_count, zipf_theta);
+				break;
+			case Utils::Address_Distribution_Type::EMPIRICAL:
+			{
+				double weight_sum = 0;
+				for (auto weight : address_histogram) {
+					if (weight < 0) {
+						PRINT_ERROR("Negative weight in the address histogram of workload " << name)
+					}
+					weight_sum += weight;
+				}
+				if (weight_sum <= 0) {
+					PRINT_ERROR("The EMPIRICAL address distribution of workload " << name << " needs an Address_Histogram")
+				}
+				histogram_table = new Utils::Alias_Table(address_histogram);
+				break;
+			}
+			default:
+				PRINT_ERROR("IO flow " << name << ": the random lines of the cores can only be drawn from the RANDOM_UNIFORM, RANDOM_HOTCOLD, ZIPF, SCRAMBLED_ZIPF and EMPIRICAL distributions!")
+		}
+		cores.resize(core_count);
+		for (unsigned int core_id = 0; core_id < core_count; core_id++) {
+			CPU_Core& core = cores[core_id];
+			core.Kernel = kernels[core_id % kernels.size()];
+			core.Random = new Utils::RandomGenerator(seed + core_id);
+			core.Window_head_seq = 0;
+			core.Fetched_ops = 0;
+			core.Next_fetch_time = 0;
+			core.Rob_full = false;
+			core.Rob_full_since = 0;
+			core.Outstanding = 0;
+			core.Registered_event_time = MAXIMUM_TIME;
+			core.Stream_line = line_count / core_count * core_id;//The streams of the cores start in disjoint parts of the working set
+			core.Last_index_seq = NO_DEPENDENCY;
+			core.Chain_tail_seq.assign(pointer_chains, NO_DEPENDENCY);
+			core.Completed_loads = 0;
+			core.Completed_stores = 0;
+			core.Load_latency_sum = 0;
+			core.Load_latency_max = 0;
+			core.Rob_stall_time = 0;
+			core.Outstanding_time_sum = 0;
+			core.Finish_time = 0;
+		}
+		for (uint64_t tag = 0; tag < (uint64_t)core_count * mlp; tag++) {
+			free_tags.push_back((uint16_t)tag);
+		}
+	}
+
+	IO_Flow_CPU_Cores::~IO_Flow_CPU_Cores()
+	{
+		for (auto& core : cores) {
+			delete core.Random;
+		}
+		delete zipf_generator;
+		delete histogram_table;
+	}
+
+	//The requests of this flow are created by the cores when their operations issue
+	Host_IO_Request* IO_Flow_CPU_Cores::Generate_next_request()
+	{
+		return NULL;
+	}
+
+	void IO_Flow_CPU_Cores::Start_simulation()
+	{
+		IO_Flow_Base::Start_simulation();
+		for (unsigned int core_id = 0; core_id < cores.size(); core_id++) {
+			cores[core_id].Registered_event_time = Simulator->Time();
+			Simulator->Register_sim_event(Simulator->Time(), this, (void*)(intptr_t)core_id, static_cast<int>(CPU_Core_Event_Type::CORE_READY));
+		}
+	}
+
+	void IO_Flow_CPU_Cores::Validate_simulation_config()
+	{
+	}
+
+	void IO_Flow_CPU_Cores::Execute_simulator_event(MQSimEngine::Sim_Event* event)
+	{
+		if (event->Type == static_cast<int>(CPU_Core_Event_Type::CORE_READY)) {
+			advance((unsigned int)(intptr_t)event->Parameters);
+			return;
+		}
+
+		for (unsigned int core_id = 0; core_id < cores.size(); core_id++) {
+			advance(core_id);
+		}
+	}
+
+	void IO_Flow_CPU_Cores::fetch(CPU_Core& core)
+	{
+		sim_time_type now = Simulator->Time();
+		if (core.Rob_full) {
+			if (core.Window.size() >= rob_size) {
+				return;
+			}
+			core.Rob_full = false;
+			core.Rob_stall_time += now - core.Rob_full_since;
+			if (core.Next_fetch_time < now) {
+				core.Next_fetch_time = now;
+			}
+		}
+
+		while (core.Fetched_ops < accesses_per_core && core.Next_fetch_time <= now) {
+			if (core.Window.size() >= rob_size) {
+				core.Rob_full = true;
+				core.Rob_full_since = core.Next_fetch_time;
+				return;
+			}
+
+			uint64_t seq = core.Fetched_ops;
+			CPU_Core_Op op;
+			op.Write = false;
+			op.Depends_on = NO_DEPENDENCY;
+			op.State = CPU_Op_State::WAITING;
+			op.Fetch_time = core.Next_fetch_time;
+			uint64_t line = 0;
+			switch (core.Kernel) {
+				case CPU_Kernel_Type::STREAM:
+					line = core.Stream_line++ % line_count;
+					op.Write = core.Random->FloatRandom() >= read_ratio;
+					break;
+				case CPU_Kernel_Type::GATHER://a[idx[i]]: an index line, then the elements that its indices point to
+					if (seq % (GATHER_INDICES_PER_LINE + 1) == 0) {
+						line = core.Stream_line++ % line_count;
+						core.Last_index_seq = seq;
+					}
+					else {
+						line = random_line(core);
+						op.Depends_on = core.Last_index_seq;
+						op.Write = core.Random->FloatRandom() >= read_ratio;
+					}
+					break;
+				case CPU_Kernel_Type::POINTER_CHASE://Each load of a chain reads the address of the next one
+					line = random_line(core);
+					op.Depends_on = core.Chain_tail_seq[seq % pointer_chains];
+					core.Chain_tail_seq[seq % pointer_chains] = seq;
+					break;
+				case CPU_Kernel_Type::HASH_PROBE://A bucket of a hashed key, then the entry that the bucket points to
+					line = random_line(core);
+					if (seq % 2 == 0) {
+						core.Last_index_seq = seq;
+					}
+					else {
+						op.Depends_on = core.Last_index_seq;
+						op.Write = core.Random->FloatRandom() >= read_ratio;
+					}
+					break;
+			}
+			op.Address = line * CPU_LINE_SIZE_IN_BYTES;
+
+			core.Window.push_back(op);
+			core.Fetched_ops++;
+			core.Next_fetch_time += think_time;
+		}
+	}
+
+	uint64_t IO_Flow_CPU_Cores::random_line(CPU_Core& core)
+	{
+		switch (address_distribution) {
+			case Utils::Address_Distribution_Type::RANDOM_HOTCOLD:
+				//As in the synthetic flows, the hot region takes the share of the accesses that the cold region takes of the lines
+				if (core.Random->FloatRandom() < hot_region_ratio) {
+					return hot_line_count < line_count ? core.Random->Uniform_ulong(hot_line_count, line_count - 1) : 0;
+				}
+				return core.Random->Uniform_ulong(0, hot_line_count - 1);
+			case Utils::Address_Distribution_Type::ZIPF:
+				return zipf_generator->Next(core.Random);
+			case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+				return Utils::Scramble_rank(zipf_generator->Next(core.Random), line_count);
+			case Utils::Address_Distribution_Type::EMPIRICAL:
+			{
+				uint64_t slice = histogram_table->Next(core.Random);
+				uint64_t first_line = slice * line_count / histogram_table->Size();
+				uint64_t last_line = (slice + 1) * line_count / histogram_table->Size();
+				return last_line > first_line ? core.Random->Uniform_ulong(first_line, last_line - 1) : first_line;
+			}
+			default:
+				return core.Random->Uniform_ulong(0, line_count - 1);
+		}
+	}
+
+	bool IO_Flow_CPU_Cores::dependency_done(CPU_Core& core, const CPU_Core_Op& op)
+	{
+		if (op.Depends_on == NO_DEPENDENCY || op.Depends_on < core.Window_head_seq) {
+			return true;
+		}
+
+		return core.Window[op.Depends_on - core.Window_head_seq].State == CPU_Op_State::DONE;
+	}
+
+	bool IO_Flow_CPU_Cores::issue(unsigned int core_id, CPU_Core_Op& op, uint64_t seq)
+	{
+		if (!cxl_pcie->device_avail(flow_id)) {
+			cxl_pcie->skipped_trace_reading[flow_id]++;
+			return false;
+		}
+
+		Host_IO_Request* request = new Host_IO_Request;
+		request->Type = op.Write ? Host_IO_Request_Type::WRITE : Host_IO_Request_Type::READ;
+		request->Start_LBA = op.Address;
+		request->LBA_count = 1;
+		request->Arrival_time = op.Fetch_time;
+		request->Enqueue_time = Simulator->Time();
+		request->Source_flow_id = flow_id;
+		request->IO_queue_info = free_tags.back();
+		free_tags.pop_back();
+
+		In_flight_op& in_flight_op = in_flight[request->IO_queue_info];
+		in_flight_op.Core_id = core_id;
+		in_flight_op.Seq = seq;
+		in_flight_op.Write = op.Write;
+		in_flight_op.Fetch_time = op.Fetch_time;
+		in_flight_op.Issue_time = Simulator->Time();
+
+		cxl_pcie->Enqueue_request(request);
+		Simulator->Register_sim_event(Simulator->Time(), cxl_pcie, 0, 0);
+
+		//A store retires into the store buffer right away, but its line stays in flight until the device completes it
+		op.State = op.Write ? CPU_Op_State::DONE : CPU_Op_State::ISSUED;
+		cores[core_id].Outstanding++;
+		STAT_generated_request_count++;
+		if (op.Write) {
+			STAT_generated_write_request_count++;
+		}
+		else {
+			STAT_generated_read_request_count++;
+		}
+
+		return true;
+	}
+
+	void IO_Flow_CPU_Cores::retire(CPU_Core& core)
+	{
+		while (core.Window.size() > 0 && core.Window.front().State == CPU_Op_State::DONE) {
+			core.Window.pop_front();
+			core.Window_head_seq++;
+		}
+	}
+
+	void IO_Flow_CPU_Cores::advance(unsigned int core_id)
+	{
+		CPU_Core& core = cores[core_id];
+		bool progress = true;
+		while (progress) {
+			fetch(core);
+
+			uint64_t seq = core.Window_head_seq;
+			for (auto& op : core.Window) {
+				if (core.Outstanding >= mlp) {
+					break;
+				}
+				if (op.State == CPU_Op_State::WAITING && dependency_done(core, op)) {
+					if (!issue(core_id, op, seq)) {
+						break;
+					}
+				}
+				seq++;
+			}
+
+			//Retired stores make room in the reorder buffer for the next operations
+			uint64_t head = core.Window_head_seq;
+			retire(core);
+			progress = core.Window_head_seq != head;
+		}
+
+		if (core.Fetched_ops < accesses_per_core && !core.Rob_full && core.Next_fetch_time > Simulator->Time()
+			&& core.Registered_event_time != core.Next_fetch_time) {
+			core.Registered_event_time = core.Next_fetch_time;
+			Simulator->Register_sim_event(core.Next_fetch_time, this, (void*)(intptr_t)core_id, static_cast<int>(CPU_Core_Event_Type::CORE_READY));
+		}
+
+		if (core.Finish_time == 0 && core.Fetched_ops == accesses_per_core && core.Window.size() == 0 && core.Outstanding == 0) {
+			core.Finish_time = Simulator->Time();
+			finished_core_count++;
+			if (finished_core_count == cores.size()) {
+				print_statistics();
+			}
+		}
+	}
+
+	void IO_Flow_CPU_Cores::CXL_consume_response(const CXL_Mem_Transaction& transaction)
+	{
+		auto entry = in_flight.find(transaction.Tag);
+		if (entry == in_flight.end()) {
+			return;
+		}
+		In_flight_op op = entry->second;
+		in_flight.erase(entry);
+		free_tags.push_back(transaction.Tag);
+
+		CPU_Core& core = cores[op.Core_id];
+		sim_time_type latency = Simulator->Time() - op.Issue_time;
+		core.Outstanding--;
+		core.Outstanding_time_sum += latency;
+
+		STAT_serviced_request_count++;
+		STAT_sum_device_response_time += latency;
+		if (latency > STAT_max_device_response_time) {
+			STAT_max_device_response_time = latency;
+		}
+		if (latency < STAT_min_device_response_time) {
+			STAT_min_device_response_time = latency;
+		}
+		sim_time_type request_delay = Simulator->Time() - op.Fetch_time;
+		STAT_sum_request_delay += request_delay;
+		if (request_delay > STAT_max_request_delay) {
+			STAT_max_request_delay = request_delay;
+		}
+		if (request_delay < STAT_min_request_delay) {
+			STAT_min_request_delay = request_delay;
+		}
+		if (op.Write) {
+			STAT_serviced_write_request_count++;
+			core.Completed_stores++;
+		}
+		else {
+			STAT_serviced_read_request_count++;
+			core.Completed_loads++;
+			core.Load_latency_sum += latency;
+			if (latency > core.Load_latency_max) {
+				core.Load_latency_max = latency;
+			}
+			core.Window[op.Seq - core.Window_head_seq].State = CPU_Op_State::DONE;
+		}
+
+		advance(op.Core_id);
+	}
+
+	void IO_Flow_CPU_Cores::print_statistics()
+	{
+		sim_time_type run_time = 0;
+		uint64_t operation_count = 0;
+		double slowdown_sum = 0;
+		for (unsigned int core_id = 0; core_id < cores.size(); core_id++) {
+			CPU_Core& core = cores[core_id];
+			sim_time_type core_time = std::max(core.Finish_time, (sim_time_type)1);
+			sim_time_type compute_time = (sim_time_type)accesses_per_core * think_time;
+			double slowdown = compute_time == 0 ? 0 : (double)core_time / compute_time;
+			run_time = std::max(run_time, core.Finish_time);
+			operation_count += core.Completed_loads + core.Completed_stores;
+			slowdown_sum += slowdown;
+
+			std::cout << "CPU core " << core_id << " (" << kernel_name(core.Kernel) << "): loads " << core.Completed_loads << "   stores " << core.Completed_stores
+				<< "   run time " << core.Finish_time / 1000 << " us   average load latency " << (core.Completed_loads == 0 ? 0 : core.Load_latency_sum / core.Completed_loads)
+				<< " ns   max load latency " << core.Load_latency_max << " ns" << endl;
+			of_overall << "CPU core " << core_id << " (" << kernel_name(core.Kernel) << "): loads " << core.Completed_loads << "   stores " << core.Completed_stores
+				<< "   run time " << core.Finish_time / 1000 << " us   average load latency " << (core.Completed_loads == 0 ? 0 : core.Load_latency_sum / core.Completed_loads)
+				<< " ns   max load latency " << core.Load_latency_max << " ns" << endl;
+			std::cout << "CPU core " << core_id << ": ROB stall " << (double)core.Rob_stall_time / core_time * 100 << " %   achieved MLP " << (double)core.Outstanding_time_sum / core_time
+				<< "   slowdown over compute time " << slowdown << endl;
+			of_overall << "CPU core " << core_id << ": ROB stall " << (double)core.Rob_stall_time / core_time * 100 << " %   achieved MLP " << (double)core.Outstanding_time_sum / core_time
+				<< "   slowdown over compute time " << slowdown << endl;
+		}
+
+		double operations_per_us = run_time == 0 ? 0 : (double)operation_count * 1000 / run_time;
+		std::cout << "CPU cores: run time " << run_time / 1000 << " us   memory operations per us " << operations_per_us << "   average slowdown " << slowdown_sum / cores.size() << endl;
+		of_overall << "CPU cores: run time " << run_time / 1000 << " us   memory operations per us " << operations_per_us << "   average slowdown " << slowdown_sum / cores.size() << endl;
+	}
+
+	void IO_Flow_CPU_Cores::Get_statistics(Utils::Workload_Statistics& stats, LPA_type(*)(LHA_type lha),
+		page_status_type(*)(LHA_type lha))
+	{
+		//For preconditioning, the cores are seen as a closed-loop synthetic flow that accesses its working set uniformly
+		stats.Type = Utils::Workload_Type::SYNTHETIC;
+		stats.generator_type = Utils::Request_Generator_Type::QUEUE_DEPTH;
+		stats.Stream_id = io_queue_id - 1;
+		stats.Initial_occupancy_ratio = initial_occupancy_ratio;
+		stats.Working_set_ratio = working_set_ratio;
+		stats.Read_ratio = read_ratio;
+		stats.random_request_type_generator_seed = seed;
+		stats.Address_distribution_type = Utils::Address_Distribution_Type::RANDOM_UNIFORM;
+		stats.Ratio_of_hot_addresses_to_whole_working_set = 0;
+		stats.Ratio_of_traffic_accessing_hot_region = 1;
+		stats.random_address_generator_seed = seed;
+		stats.random_hot_address_generator_seed = seed;
+		stats.random_hot_cold_generator_seed = seed;
+		stats.generate_aligned_addresses = true;
+		stats.alignment_value = 8;
+		stats.Request_size_distribution_type = Utils::Request_Size_Distribution_Type::FIXED;
+		stats.Average_request_size_sector = 8;//The device reads and writes its flash in 4KB pages
+		stats.STDEV_reuqest_size = 0;
+		stats.random_request_size_generator_seed = seed;
+		stats.Request_queue_depth = (unsigned int)cores.size() * mlp;
+		stats.random_time_interval_generator_seed = seed;
+		stats.Average_inter_arrival_time_nano_sec = think_time;
+		stats.Min_LHA = start_lsa_on_device;
+		stats.Max_LHA = end_lsa_on_device;
+	}
+}
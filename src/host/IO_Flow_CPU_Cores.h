@@ -0,0 +1,121 @@
+#ifndef IO_FLOW_CPU_CORES_H
+#define IO_FLOW_CPU_CORES_H
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "IO_Flow_Base.h"
+#include "../utils/RandomGenerator.h"
+#include "../utils/Address_Distributions.h"
+#include "../utils/DistributionTypes.h"
+#include "../cxl/CXL_PCIe.h"
+
+namespace Host_Components
+{
+	//The access kernel that a core runs on the memory of the CXL device
+	enum class CPU_Kernel_Type { STREAM, GATHER, POINTER_CHASE, HASH_PROBE };
+	enum class CPU_Core_Event_Type { RESUME = 0, CORE_READY = 1 };//RESUME is the event that CXL_PCIe registers when the admission queue of the flow drains
+	enum class CPU_Op_State { WAITING, ISSUED, DONE };
+
+	struct CPU_Core_Op
+	{
+		LHA_type Address;//Host physical byte address of the 64B line
+		bool Write;
+		uint64_t Depends_on;//Sequence number of the load that produces the address of this operation
+		CPU_Op_State State;
+		sim_time_type Fetch_time;
+	};
+
+	struct CPU_Core
+	{
+		CPU_Kernel_Type Kernel;
+		Utils::RandomGenerator* Random;
+
+		std::deque<CPU_Core_Op> Window;//The memory operations of the reorder buffer, oldest first
+		uint64_t Window_head_seq;
+		uint64_t Fetched_ops;
+		sim_time_type Next_fetch_time;
+		bool Rob_full;
+		sim_time_type Rob_full_since;
+		unsigned int Outstanding;
+		sim_time_type Registered_event_time;
+
+		uint64_t Stream_line;
+		uint64_t Last_index_seq;
+		std::vector<uint64_t> Chain_tail_seq;
+
+		uint64_t Completed_loads, Completed_stores;
+		sim_time_type Load_latency_sum, Load_latency_max;
+		sim_time_type Rob_stall_time;
+		sim_time_type Outstanding_time_sum;
+		sim_time_type Finish_time;
+	};
+
+	/*
+	* Models the host cores that run load/store kernels on memory attached through the CXL device.
+	* Each core fetches one memory operation every think time into a reorder buffer of ROB size operations. An operation
+	* issues as soon as the load that produces its address has completed and the core has fewer than MLP misses in flight,
+	* so independent operations overlap and dependent ones are serialized. The buffer retires in order, and the front end
+	* stalls while it is full. The run time of the cores, relative to the time they spend on computation, is the slowdown
+	* that the application sees from the memory of the device.
+	*/
+	class IO_Flow_CPU_Cores : public IO_Flow_Base
+	{
+	public:
+		IO_Flow_CPU_Cores(const sim_object_id_type& name, uint16_t flow_id, LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, double working_set_ratio, uint16_t io_queue_id,
+			uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class priority_class, double initial_occupancy_ratio,
+			unsigned int core_count, const std::vector<CPU_Kernel_Type>& kernels, unsigned int accesses_per_core, unsigned int rob_size, unsigned int mlp,
+			sim_time_type think_time, double read_ratio, unsigned int pointer_chains,
+			Utils::Address_Distribution_Type address_distribution, double hot_region_ratio, double zipf_theta, const std::vector<double>& address_histogram, int seed,
+			HostInterface_Types SSD_device_type, PCIe_Root_Complex* pcie_root_complex, SATA_HBA* sata_hba,
+			bool enabled_logging, sim_time_type logging_period, std::string logging_file_path, CXL_PCIe* cxl_pcie);
+		~IO_Flow_CPU_Cores();
+		Host_IO_Request* Generate_next_request();
+		void CXL_consume_response(const CXL_Mem_Transaction& transaction);
+		void Start_simulation();
+		void Validate_simulation_config();
+		void Execute_simulator_event(MQSimEngine::Sim_Event*);
+		void Get_statistics(Utils::Workload_Statistics& stats, LPA_type(*Convert_host_logical_address_to_device_address)(LHA_type lha),
+			page_status_type(*Find_NVM_subunit_access_bitmap)(LHA_type lha));
+	private:
+		struct In_flight_op
+		{
+			unsigned int Core_id;
+			uint64_t Seq;
+			bool Write;
+			sim_time_type Fetch_time;
+			sim_time_type Issue_time;
+		};
+
+		CXL_PCIe* cxl_pcie;
+		std::vector<CPU_Core> cores;
+		unsigned int accesses_per_core;
+		unsigned int rob_size;
+		unsigned int mlp;
+		sim_time_type think_time;
+		double read_ratio;
+		unsigned int pointer_chains;
+		double working_set_ratio;
+		int seed;
+		uint64_t line_count;//64B lines in the working set
+		Utils::Address_Distribution_Type address_distribution;
+		uint64_t hot_line_count;//The hot region of RANDOM_HOTCOLD is the first lines of the working set
+		double hot_region_ratio;
+		Utils::Zipf_Generator* zipf_generator;
+		Utils::Alias_Table* histogram_table;
+		std::unordered_map<uint16_t, In_flight_op> in_flight;//By the tag of the request
+		std::vector<uint16_t> free_tags;
+		unsigned int finished_core_count;
+
+		void advance(unsigned int core_id);
+		void fetch(CPU_Core& core);
+		uint64_t random_line(CPU_Core& core);
+		bool issue(unsigned int core_id, CPU_Core_Op& op, uint64_t seq);
+		bool dependency_done(CPU_Core& core, const CPU_Core_Op& op);
+		void retire(CPU_Core& core);
+		void print_statistics();
+	};
+}
+
+#endif // !IO_FLOW_CPU_CORES_H
@@ -14,7 +14,7 @@ namespace Host_Components
 	IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type& name, uint16_t flow_id,
 		LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, double working_set_ratio, uint16_t io_queue_id,
 		uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class priority_class,
-		double read_ratio, Utils::Address_Distribution_Type address_distribution, double hot_region_ratio,
+		double read_ratio, Utils::Address_Distribution_Type address_distribution, double hot_region_ratio, double zipf_theta, const std::vector<double>& address_histogram,
 		Utils::Request_Size_Distribution_Type request_size_distribution, unsigned int average_request_size, unsigned int variance_request_size,
 		Utils::Request_Generator_Type generator_type, sim_time_type Average_inter_arrival_time_nano_sec, unsigned int average_number_of_enqueued_requests,
 		bool generate_aligned_addresses, unsigned int alignment_value,
@@ -22,7 +22,7 @@ namespace Host_Components
 		bool enabled_logging, sim_time_type logging_period, std::string logging_file_path) :
 		IO_Flow_Base(name, flow_id, start_lsa_on_device, LHA_type(start_lsa_on_device + (end_lsa_on_device - start_lsa_on_device) * working_set_ratio), io_queue_id, nvme_submission_queue_size, nvme_completion_queue_size, priority_class, stop_time, initial_occupancy_ratio, total_req_count, SSD_device_type, pcie_root_complex, sata_hba, enabled_logging, logging_period, logging_file_path),
 		read_ratio(read_ratio), address_distribution(address_distribution),
-		working_set_ratio(working_set_ratio), hot_region_ratio(hot_region_ratio),
+		working_set_ratio(working_set_ratio), hot_region_ratio(hot_region_ratio), zipf_generator(NULL), histogram_table(NULL), latest_item(0),
 		request_size_distribution(request_size_distribution), average_request_size(average_request_size), variance_request_size(variance_request_size),
 		generator_type(generator_type), Average_inter_arrival_time_nano_sec(Average_inter_arrival_time_nano_sec), average_number_of_enqueued_requests(average_number_of_enqueued_requests),
 		seed(seed), generate_aligned_addresses(generate_aligned_addresses), alignment_value(alignment_value)
@@ -47,6 +47,39 @@ namespace Host_Components
 			hot_region_end_lsa = this->start_lsa_on_device + (LHA_type)((double)(this->end_lsa_on_device - this->start_lsa_on_device) * hot_region_ratio);
 		}
 
+		item_size = generate_aligned_addresses && alignment_value > 0 ? alignment_value : (average_request_size > 0 ? average_request_size : 1);
+		item_count = (this->end_lsa_on_device - this->start_lsa_on_device + 1) / item_size;
+		if (item_count == 0) {
+			item_count = 1;
+		}
+		switch (address_distribution) {
+			case Utils::Address_Distribution_Type::ZIPF:
+			case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+			case Utils::Address_Distribution_Type::LATEST:
+				if (zipf_theta < 0) {
+					PRINT_ERROR("The Zipf theta of workload " << name << " should not be negative")
+				}
+				zipf_generator = new Utils::Zipf_Generator(item_count, zipf_theta);
+				break;
+			case Utils::Address_Distribution_Type::EMPIRICAL:
+			{
+				double weight_sum = 0;
+				for (auto weight : address_histogram) {
+					if (weight < 0) {
+						PRINT_ERROR("Negative weight in the address histogram of workload " << name)
+					}
+					weight_sum += weight;
+				}
+				if (weight_sum <= 0) {
+					PRINT_ERROR("The EMPIRICAL address distribution of workload " << name << " needs an Address_Histogram")
+				}
+				histogram_table = new Utils::Alias_Table(address_histogram);
+				break;
+			}
+			default:
+				break;
+		}
+
 		if (request_size_distribution == Utils::Request_Size_Distribution_Type::NORMAL) {
 			random_request_size_generator_seed = seed++;
 			random_request_size_generator = new Utils::RandomGenerator(random_request_size_generator_seed);
@@ -70,6 +103,8 @@ namespace Host_Components
 		delete random_hot_address_generator;
 		delete random_request_size_generator;
 		delete random_time_interval_generator;
+		delete zipf_generator;
+		delete histogram_table;
 	}
 
 	Host_IO_Request* IO_Flow_Synthetic::Generate_next_request()
@@ -155,6 +190,15 @@ namespace Host_Components
 					request->Start_LBA = start_lsa_on_device;
 				}
 				break;
+			case Utils::Address_Distribution_Type::ZIPF:
+			case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+			case Utils::Address_Distribution_Type::LATEST:
+			case Utils::Address_Distribution_Type::EMPIRICAL:
+				request->Start_LBA = start_lsa_on_device + next_skewed_item(request->Type == Host_IO_Request_Type::WRITE) * item_size;
+				if (request->Start_LBA + request->LBA_count > end_lsa_on_device) {
+					request->Start_LBA = start_lsa_on_device;
+				}
+				break;
 			default:
 				PRINT_ERROR("Unknown address distribution type!\n")
 		}
@@ -199,6 +243,33 @@ namespace Host_Components
 		return request;
 	}
 
+	uint64_t IO_Flow_Synthetic::next_skewed_item(bool write)
+	{
+		switch (address_distribution) {
+			case Utils::Address_Distribution_Type::ZIPF:
+				return zipf_generator->Next(random_address_generator);
+			case Utils::Address_Distribution_Type::SCRAMBLED_ZIPF:
+				return Utils::Scramble_rank(zipf_generator->Next(random_address_generator), item_count);
+			case Utils::Address_Distribution_Type::LATEST:
+				//Writes insert new items in order and reads prefer the items that were inserted recently, as in YCSB workload D
+				if (write) {
+					latest_item = (latest_item + 1) % item_count;
+					return latest_item;
+				}
+				return (latest_item + item_count - zipf_generator->Next(random_address_generator)) % item_count;
+			case Utils::Address_Distribution_Type::EMPIRICAL:
+			{
+				//A slice of the working set is drawn by its weight, and an item uniformly within it
+				uint64_t slice = histogram_table->Next(random_address_generator);
+				uint64_t first_item = slice * item_count / histogram_table->Size();
+				uint64_t last_item = (slice + 1) * item_count / histogram_table->Size();
+				return last_item > first_item ? random_address_generator->Uniform_ulong(first_item, last_item - 1) : first_item;
+			}
+			default:
+				return 0;
+		}
+	}
+
 	void IO_Flow_Synthetic::NVMe_consume_io_request(Completion_Queue_Entry* io_request)
 	{
 		IO_Flow_Base::NVMe_consume_io_request(io_request);
@@ -275,6 +346,9 @@ namespace Host_Components
 		stats.Read_ratio = read_ratio;
 		stats.random_request_type_generator_seed = random_request_type_generator_seed;
 		stats.Address_distribution_type = address_distribution;
+		if (zipf_generator != NULL || histogram_table != NULL) {
+			stats.Address_distribution_type = Utils::Address_Distribution_Type::RANDOM_UNIFORM;//The preconditioning of the FTL only models the uniform, hot/cold and streaming patterns
+		}
 		stats.Ratio_of_hot_addresses_to_whole_working_set = hot_region_ratio;
 		stats.Ratio_of_traffic_accessing_hot_region = 1 - hot_region_ratio;
 		stats.random_address_generator_seed = random_address_generator_seed;
@@ -2,8 +2,10 @@
 #define IO_FLOW_SYNTHETIC_H
 
 #include <string>
+#include <vector>
 #include "IO_Flow_Base.h"
 #include "../utils/RandomGenerator.h"
+#include "../utils/Address_Distributions.h"
 #include "../utils/DistributionTypes.h"
 
 
@@ -14,7 +16,7 @@ namespace Host_Components
 	public:
 		IO_Flow_Synthetic(const sim_object_id_type& name, uint16_t flow_id, LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, double working_set_ratio, uint16_t io_queue_id,
 			uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class priority_class,
-			double read_ratio, Utils::Address_Distribution_Type address_distribution, double hot_address_ratio,
+			double read_ratio, Utils::Address_Distribution_Type address_distribution, double hot_address_ratio, double zipf_theta, const std::vector<double>& address_histogram,
 			Utils::Request_Size_Distribution_Type request_size_distribution, unsigned int average_request_size, unsigned int variance_request_size,
 			Utils::Request_Generator_Type generator_type, sim_time_type Average_inter_arrival_time_nano_sec, unsigned int average_number_of_enqueued_requests,
 			bool generate_aligned_addresses, unsigned int alignment_value,
@@ -43,6 +45,12 @@ namespace Host_Components
 		Utils::RandomGenerator* random_hot_address_generator;
 		int random_hot_address_generator_seed;
 		LHA_type hot_region_end_lsa;
+		//The skewed distributions pick one of item_count items of item_size sectors in the working set
+		Utils::Zipf_Generator* zipf_generator;
+		Utils::Alias_Table* histogram_table;
+		LHA_type item_size;
+		uint64_t item_count;
+		uint64_t latest_item;//The item of the last write, which the LATEST distribution treats as the most recent insert
 		LHA_type streaming_next_address;
 		Utils::Request_Size_Distribution_Type request_size_distribution;
 		unsigned int average_request_size;
@@ -57,6 +65,7 @@ namespace Host_Components
 		bool generate_aligned_addresses;
 		unsigned int alignment_value;
 		int seed;
+		uint64_t next_skewed_item(bool write);
 	};
 }
 
@@ -1,7 +1,9 @@
+#include <algorithm>
 #include "IO_Flow_Trace_Based.h"
 #include "../utils/StringTools.h"
 #include "ASCII_Trace_Definition.h"
 #include "../utils/DistributionTypes.h"
+#include "../cxl/Host_Interface_CXL.h"
 
 
 
@@ -16,7 +18,7 @@ namespace Host_Components
 		bool enabled_logging, sim_time_type logging_period, std::string logging_file_path, CXL_PCIe* cxl_pcie) :
 		IO_Flow_Base(name, flow_id, start_lsa_on_device, end_lsa_on_device, io_queue_id, nvme_submission_queue_size, nvme_completion_queue_size, priority_class, 0, initial_occupancy_ratio, 0, SSD_device_type, pcie_root_complex, sata_hba, enabled_logging, logging_period, logging_file_path),
 		trace_file_path(trace_file_path), time_unit(time_unit), total_replay_no(total_replay_count), percentage_to_be_simulated(percentage_to_be_simulated),
-		total_requests_in_file(0), time_offset(0), cxl_pcie(cxl_pcie)
+		total_requests_in_file(0), time_offset(0), cxl_pcie(cxl_pcie), cxl_man(NULL), trace_sampler(NULL), fast_forwarded_request_count(0), warmup_request_count(0)
 	{
 		if (percentage_to_be_simulated > 100) {
 			percentage_to_be_simulated = 100;
@@ -32,7 +34,7 @@ namespace Host_Components
 
 	Host_IO_Request* IO_Flow_Trace_Based::Generate_next_request()
 	{
-		if (current_trace_line.size() == 0 || STAT_generated_request_count >= total_requests_to_be_generated) {
+		if (current_trace_line.size() == 0 || STAT_generated_request_count + fast_forwarded_request_count >= total_requests_to_be_generated) {
 			return NULL;
 		}
 
@@ -151,6 +153,10 @@ namespace Host_Components
 				break;
 			}
 			total_requests_in_file++;
+			if (trace_sampler != NULL && total_requests_in_file > cxl_man->cxl_config_para.warmup_requests) {
+				trace_sampler->add_record(flow_id, std::strtoull(current_trace_line[ASCIITraceAddressColumn].c_str(), &pEnd, 0),
+					current_trace_line[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) == 0);
+			}
 #ifndef OLD_TRACE
 			sim_time_type prev_time = last_request_arrival_time;
 			last_request_arrival_time = std::strtoll(current_trace_line[ASCIITraceTimeColumn].c_str(), &pEnd, 10);
@@ -169,6 +175,18 @@ namespace Host_Components
 		else {
 			total_requests_to_be_generated = total_requests_in_file * total_replay_no;
 		}
+		if (cxl_man != NULL && cxl_man->cxl_config_para.warmup_requests > 0) {
+			warmup_request_count = (unsigned int)std::min<uint64_t>(cxl_man->cxl_config_para.warmup_requests, std::min(total_requests_in_file, total_requests_to_be_generated));
+			if (warmup_request_count == total_requests_to_be_generated) {
+				PRINT_ERROR("The warm-up covers all records of the trace: " << trace_file_path)
+			}
+		}
+		if (trace_sampler != NULL) {
+			if (total_replay_no != 1) {
+				PRINT_ERROR("Trace sampling does not support replaying the trace: " << trace_file_path)
+			}
+			trace_sampler->plan(flow_id, total_requests_to_be_generated - warmup_request_count);
+		}
 
 		trace_file.open(trace_file_path);
 		current_trace_line.clear();
@@ -193,22 +211,31 @@ namespace Host_Components
 		//if (Simulator->Time() >= 243230814) {
 		//	cout << "Check" << Simulator->Time() << endl;
 		//}
-		if (!cxl_pcie->device_avail()) {
-			cxl_pcie->skipped_trace_reading++;
+		if (warmup_request_count > 0) {
+			warm_up();
+			return;
+		}
+		if (!cxl_pcie->device_avail(flow_id)) {
+			cxl_pcie->skipped_trace_reading[flow_id]++;
 			//cout << "skipped feeding" << skipped_feeding << endl;
 			return;
 		}
+		if (trace_sampler != NULL && !trace_sampler->is_sampled(flow_id, STAT_generated_request_count + fast_forwarded_request_count)) {
+			fast_forward();
+			return;
+		}
 		Host_IO_Request* request = Generate_next_request();
 		if (request != NULL) {
 			//Submit_io_request(request);
-			cxl_pcie->requests_queue.push_back(request);
+			request->Source_flow_id = flow_id;
+			cxl_pcie->Enqueue_request(request);
 			sim_time_type firetime{ 0 };
 			firetime = (request->Arrival_time < Simulator->Time()) ? Simulator->Time() : request->Arrival_time;
 			Simulator->Register_sim_event(firetime, cxl_pcie, 0, 0);
 		}
 		
 
-		if (STAT_generated_request_count < total_requests_to_be_generated) {
+		if (STAT_generated_request_count + fast_forwarded_request_count < total_requests_to_be_generated) {
 			std::string trace_line;
 			if (std::getline(trace_file, trace_line)) {
 				Utils::Helper_Functions::Remove_cr(trace_line);
@@ -242,6 +269,71 @@ namespace Host_Components
 
 	}
 
+	//Replays the records up to the next sampled interval in functional mode, then waits for the arrival time of its first record
+	void IO_Flow_Trace_Based::fast_forward()
+	{
+		char* pEnd;
+		std::string trace_line;
+		while (STAT_generated_request_count + fast_forwarded_request_count < total_requests_to_be_generated
+			&& !trace_sampler->is_sampled(flow_id, STAT_generated_request_count + fast_forwarded_request_count)) {
+			trace_sampler->fast_forward(flow_id, STAT_generated_request_count + fast_forwarded_request_count,
+				std::strtoull(current_trace_line[ASCIITraceAddressColumn].c_str(), &pEnd, 0), current_trace_line[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) == 0);
+			fast_forwarded_request_count++;
+			if (!std::getline(trace_file, trace_line)) {
+				return;
+			}
+			Utils::Helper_Functions::Remove_cr(trace_line);
+			current_trace_line.clear();
+			Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, current_trace_line);
+		}
+
+		if (STAT_generated_request_count + fast_forwarded_request_count < total_requests_to_be_generated) {
+			sim_time_type arrival_time = std::strtoll(current_trace_line[ASCIITraceTimeColumn].c_str(), &pEnd, 10);
+			Simulator->Register_sim_event(time_offset + (arrival_time < Simulator->Time() ? Simulator->Time() : arrival_time), this);
+		}
+	}
+
+	//Replays the leading records of the trace in functional mode before the timed simulation starts, so the measured part of the
+	//trace finds the cache and the prefetcher warm. No events are created; the timed simulation starts with the next record.
+	void IO_Flow_Trace_Based::warm_up()
+	{
+		char* pEnd;
+		std::string trace_line;
+		unsigned int hit_count = 0;
+		unsigned int replayed = 0;
+		while (replayed < warmup_request_count && current_trace_line.size() > ASCIITraceAddressColumn) {
+			if (cxl_man->functional_access(std::strtoull(current_trace_line[ASCIITraceAddressColumn].c_str(), &pEnd, 0),
+				current_trace_line[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) != 0, flow_id)) {
+				hit_count++;
+			}
+			replayed++;
+			current_trace_line.clear();
+			if (!std::getline(trace_file, trace_line)) {
+				break;
+			}
+			Utils::Helper_Functions::Remove_cr(trace_line);
+			Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, current_trace_line);
+		}
+		if (current_trace_line.size() <= ASCIITraceAddressColumn) {
+			PRINT_ERROR("The warm-up of " << warmup_request_count << " records reaches the end of the trace after " << replayed << " records: " << trace_file_path)
+		}
+		warmup_request_count = replayed;
+
+		total_requests_to_be_generated -= warmup_request_count;
+		cxl_man->exclude_requests(warmup_request_count);
+		PRINT_MESSAGE("Warmed up with " << warmup_request_count << " records of " << trace_file_path << ", functional hit rate: " << (double)hit_count / warmup_request_count);
+		warmup_request_count = 0;
+
+		sim_time_type arrival_time = std::strtoll(current_trace_line[ASCIITraceTimeColumn].c_str(), &pEnd, 10);
+		Simulator->Register_sim_event(time_offset + (arrival_time < Simulator->Time() ? Simulator->Time() : arrival_time), this);
+	}
+
+	void IO_Flow_Trace_Based::Set_cxl_manager(SSD_Components::CXL_Manager* cxl_man)
+	{
+		this->cxl_man = cxl_man;
+		trace_sampler = cxl_man->trace_sampler;
+	}
+
 	void IO_Flow_Trace_Based::Get_statistics(Utils::Workload_Statistics& stats, LPA_type(*Convert_host_logical_address_to_device_address)(LHA_type lha),
 		page_status_type(*Find_NVM_subunit_access_bitmap)(LHA_type lha))
 	{
@@ -8,6 +8,12 @@
 #include "ASCII_Trace_Definition.h"
 #include "../cxl/CXL_PCIe.h"
 
+namespace SSD_Components
+{
+	class CXL_Manager;
+	class cxl_trace_sampler;
+}
+
 namespace Host_Components
 {
 	class IO_Flow_Trace_Based : public IO_Flow_Base
@@ -27,6 +33,7 @@ namespace Host_Components
 		void Execute_simulator_event(MQSimEngine::Sim_Event*);
 		void Get_statistics(Utils::Workload_Statistics& stats, LPA_type(*Convert_host_logical_address_to_device_address)(LHA_type lha),
 			page_status_type(*Find_NVM_subunit_access_bitmap)(LHA_type lha));
+		void Set_cxl_manager(SSD_Components::CXL_Manager* cxl_man);
 	private:
 		Trace_Time_Unit time_unit;
 		unsigned int percentage_to_be_simulated;
@@ -40,7 +47,13 @@ namespace Host_Components
 		bool need_to_divide;
 
 		CXL_PCIe* cxl_pcie;
-		
+		SSD_Components::CXL_Manager* cxl_man;//Replays the records that are not simulated in detail
+		SSD_Components::cxl_trace_sampler* trace_sampler;//Set if only the sampled intervals of the trace are simulated in detail
+		uint64_t fast_forwarded_request_count;
+		void fast_forward();
+		unsigned int warmup_request_count;//Replayed in functional mode at the first event, when the streams of the device exist
+		void warm_up();
+
 	};
 }
 
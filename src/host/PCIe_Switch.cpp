@@ -12,6 +12,11 @@ namespace Host_Components
 		host_interface->Consume_pcie_message(message);
 	}
 
+	LHA_type PCIe_Switch::Deliver_to_device(const CXL_Mem_Transaction& transaction)
+	{
+		return host_interface->Consume_cxl_mem_transaction(transaction);
+	}
+
 	void PCIe_Switch::Send_to_host(PCIe_Message* message)
 	{
 		//pcie_link->Deliver(message);
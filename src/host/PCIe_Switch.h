@@ -2,6 +2,8 @@
 #define PCIE_SWITCH_H
 
 #include "PCIe_Message.h"
+#include "../cxl/CXL_Mem_Transaction.h"
+#include "../ssd/SSD_Defs.h"
 #include "PCIe_Link.h"
 #include "../ssd/Host_Interface_Base.h"
 #include "../cxl/CXL_PCIe.h"
@@ -20,6 +22,7 @@ namespace Host_Components
 	public:
 		PCIe_Switch(PCIe_Link* pcie_link, SSD_Components::Host_Interface_Base* host_interface);//, SSD_Components::Host_Interface_Base* host_interface
 		void Deliver_to_device(PCIe_Message*);
+		LHA_type Deliver_to_device(const CXL_Mem_Transaction& transaction);
 		void Send_to_host(PCIe_Message*);
 		void Attach_ssd_device(SSD_Components::Host_Interface_Base* host_interface);
 		bool Is_ssd_connected();
@@ -117,6 +117,9 @@ std::vector<std::vector<IO_Flow_Parameter_Set*>*>* read_workload_definitions(con
 						} else if (strcmp(flow_def->name(), "IO_Flow_Parameter_Set_Trace_Based") == 0) {
 							flow = new IO_Flow_Parameter_Set_Trace_Based;
 							((IO_Flow_Parameter_Set_Trace_Based*)flow)->XML_deserialize(flow_def);
+						} else if (strcmp(flow_def->name(), "IO_Flow_Parameter_Set_CPU_Cores") == 0) {
+							flow = new IO_Flow_Parameter_Set_CPU_Cores;
+							((IO_Flow_Parameter_Set_CPU_Cores*)flow)->XML_deserialize(flow_def);
 						}
 						scenario_definition->push_back(flow);
 					}
@@ -7,6 +7,9 @@ namespace NVM
 		Block::Block(unsigned int PagesNoPerBlock, flash_block_ID_type BlockID)
 		{
 			ID = BlockID;
+			Erase_count = 0;
+			Reads_since_erase = 0;
+			Data_program_time = INVALID_TIME;
 			Pages = new Page[PagesNoPerBlock];
 		}
 
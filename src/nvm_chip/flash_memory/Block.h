@@ -16,6 +16,9 @@ namespace NVM
 			~Block();
 			Page* Pages;						//Records the status of each sub-page
 			flash_block_ID_type ID;            //Again this variable is required in list based garbage collections
+			unsigned int Erase_count;
+			unsigned long Reads_since_erase;   //Used to model read disturb
+			sim_time_type Data_program_time;   //The time that the oldest data of the block is programmed, used to model retention errors
 			//BlockMetadata Metadata;
 		};
 	}
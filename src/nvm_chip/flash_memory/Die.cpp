@@ -6,13 +6,17 @@ namespace NVM
 	{
 		Die::Die(unsigned int PlanesNoPerDie, unsigned int BlocksNoPerPlane, unsigned int PagesNoPerBlock) :
 			Plane_no(PlanesNoPerDie),
-			Status(DieStatus::IDLE), CommandFinishEvent(NULL), Expected_finish_time(INVALID_TIME), RemainingSuspendedExecTime(INVALID_TIME),
+			Status(DieStatus::IDLE), CommandFinishEvent(NULL), Expected_finish_time(INVALID_TIME), Command_execution_latency(0), RemainingSuspendedExecTime(INVALID_TIME),
 			CurrentCMD(NULL), SuspendedCMD(NULL), Suspended(false),
+			Cache_pages_ready(0), Cache_pages_loaded(0), Cache_pages_programmed(0), Cache_register_busy(false), Cache_loading(false), Cache_array_busy(false),
+			Page_register_hit(false), STAT_page_register_hits(0),
 			STAT_TotalProgramTime(0), STAT_TotalReadTime(0), STAT_TotalEraseTime(0), STAT_TotalXferTime(0)
 		{
 			Planes = new Plane*[PlanesNoPerDie];
+			Page_registers = new Page_Register[PlanesNoPerDie];
 			for (unsigned int i = 0; i < PlanesNoPerDie; i++) {
 				Planes[i] = new Plane(BlocksNoPerPlane, PagesNoPerBlock);
+				Page_registers[i].Valid = false;
 			}
 		}
 
@@ -22,6 +26,7 @@ namespace NVM
 				delete Planes[planeID];
 			}
 			delete[] Planes;
+			delete[] Page_registers;
 		}
 	}
 }
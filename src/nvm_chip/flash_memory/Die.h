@@ -10,6 +10,12 @@ namespace NVM
 	namespace FlashMemory
 	{
 		enum class DieStatus { BUSY, IDLE };
+		struct Page_Register
+		{
+			bool Valid;//The register holds a page that was sensed by a read and not overwritten since
+			flash_block_ID_type BlockID;
+			flash_page_ID_type PageID;
+		};
 		class Die
 		{
 		public:
@@ -20,10 +26,23 @@ namespace NVM
 			DieStatus Status;
 			MQSimEngine::Sim_Event* CommandFinishEvent;
 			sim_time_type Expected_finish_time;
+			sim_time_type Command_execution_latency;//The execution latency of the current command, including read-retry steps
 			sim_time_type RemainingSuspendedExecTime;//used to support suspend command
 			Flash_Command* CurrentCMD, *SuspendedCMD;
 			bool Suspended;
 
+			//State of a cache read or cache program sequence, whose pages share the page register and the cache register of one plane
+			unsigned int Cache_pages_ready;//Pages sensed (read) or received in the cache register (program) so far
+			unsigned int Cache_pages_loaded;//Pages moved between the page register and the cache register so far
+			unsigned int Cache_pages_programmed;
+			bool Cache_register_busy;//The cache register holds read data that is not transferred out yet
+			bool Cache_loading, Cache_array_busy;//tRCBSY/tCBSY or the sensing/programming of a page is in progress
+
+			Page_Register* Page_registers;//One per plane
+			bool Page_register_hit;//The current read is served from the page registers without sensing
+
+			unsigned long STAT_page_register_hits;
+
 			sim_time_type STAT_TotalProgramTime, STAT_TotalReadTime, STAT_TotalEraseTime, STAT_TotalXferTime;
 		};
 	}
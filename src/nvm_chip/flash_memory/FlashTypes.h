@@ -10,6 +10,7 @@ namespace NVM
 	namespace FlashMemory
 	{
 		enum class Command_Suspension_Mode { NONE, PROGRAM, PROGRAM_ERASE, ERASE };
+		enum class Cache_Command_Mode { NONE, READ, PROGRAM, READ_PROGRAM };//Support for the cache read (31h/3Fh) and cache program (80h-15h) sequences
 	}
 }
 
@@ -12,12 +12,15 @@ namespace NVM
 			unsigned int dieNo, unsigned int PlaneNoPerDie, unsigned int Block_no_per_plane, unsigned int Page_no_per_block,
 			sim_time_type* readLatency, sim_time_type* programLatency, sim_time_type eraseLatency,
 			sim_time_type suspendProgramLatency, sim_time_type suspendEraseLatency,
+			sim_time_type cacheReadBusyLatency, sim_time_type cacheProgramBusyLatency,
+			bool pageRegisterReadReuse, const Read_Retry_Parameters& readRetryParameters, int seed,
 			sim_time_type commProtocolDelayRead, sim_time_type commProtocolDelayWrite, sim_time_type commProtocolDelayErase)
 			: NVM_Chip(id), ChannelID(channelID), ChipID(localChipID), flash_technology(flash_technology),
 			status(Internal_Status::IDLE), die_no(dieNo), plane_no_in_die(PlaneNoPerDie), block_no_in_plane(Block_no_per_plane), page_no_per_block(Page_no_per_block),
-			_RBSignalDelayRead(commProtocolDelayRead), _RBSignalDelayWrite(commProtocolDelayWrite), _RBSignalDelayErase(commProtocolDelayErase),
+			pageRegisterReadReuse(pageRegisterReadReuse), _RBSignalDelayRead(commProtocolDelayRead), _RBSignalDelayWrite(commProtocolDelayWrite), _RBSignalDelayErase(commProtocolDelayErase),
 			lastTransferStart(INVALID_TIME), executionStartTime(INVALID_TIME), expectedFinishTime(INVALID_TIME),
 			STAT_readCount(0), STAT_progamCount(0), STAT_eraseCount(0),
+			STAT_retriedReadCount(0), STAT_readRetryStepCount(0), STAT_softDecodeCount(0), STAT_totalReadRetryTime(0),
 			STAT_totalSuspensionCount(0), STAT_totalResumeCount(0),
 			STAT_totalExecTime(0), STAT_totalXferTime(0), STAT_totalOverlappedXferExecTime(0)
 		{
@@ -31,11 +34,25 @@ namespace NVM
 			_eraseLatency = eraseLatency;
 			_suspendProgramLatency = suspendProgramLatency;
 			_suspendEraseLatency = suspendEraseLatency;
+			_cacheReadBusyLatency = cacheReadBusyLatency;
+			_cacheProgramBusyLatency = cacheProgramBusyLatency;
 			idleDieNo = dieNo;
 			Dies = new Die*[dieNo];
 			for (unsigned int dieID = 0; dieID < dieNo; dieID++) {
 				Dies[dieID] = new Die(PlaneNoPerDie, Block_no_per_plane, Page_no_per_block);
 			}
+
+			read_retry_model = new Read_Retry_Model(readRetryParameters, seed);
+			if (read_retry_model->Enabled()) {
+				STAT_readRetryStepHistogram.resize(read_retry_model->Max_retry_steps() + 1, 0);
+				for (unsigned int dieID = 0; dieID < dieNo; dieID++) {
+					for (unsigned int planeID = 0; planeID < PlaneNoPerDie; planeID++) {
+						for (unsigned int blockID = 0; blockID < Block_no_per_plane; blockID++) {
+							Dies[dieID]->Planes[planeID]->Blocks[blockID]->Erase_count = read_retry_model->Initial_PE_cycles();
+						}
+					}
+				}
+			}
 		}
 
 		Flash_Chip::~Flash_Chip()
@@ -46,6 +63,7 @@ namespace NVM
 			delete[] Dies;
 			delete[] _readLatency;
 			delete[] _programLatency;
+			delete read_retry_model;
 		}
 
 		void Flash_Chip::Connect_to_chip_ready_signal(ChipReadySignalHandlerType function)
@@ -93,7 +111,14 @@ namespace NVM
 
 			switch (eventType) {
 				case Chip_Sim_Event_Type::COMMAND_FINISHED:
-					finish_command_execution(command);
+					if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ || command->CommandCode == CMD_PROGRAM_PAGE_CACHE) {
+						finish_cache_array_operation(command);
+					} else {
+						finish_command_execution(command);
+					}
+					break;
+				case Chip_Sim_Event_Type::CACHE_REGISTER_LOADED:
+					finish_cache_register_load(command);
 					break;
 			}
 		}
@@ -108,6 +133,13 @@ namespace NVM
 		{
 			Die* targetDie = Dies[command->Address[0].DieID];
 
+			if (command->CommandCode == CMD_PROGRAM_PAGE_CACHE && targetDie->CurrentCMD == command) {
+				//The data of the next page of a running cache program sequence has arrived in the cache register
+				targetDie->Cache_pages_ready++;
+				advance_cache_sequence(targetDie, command);
+				return;
+			}
+
 			//If this is a simple command (not multiplane) then there should be only one address
 			if (command->Address.size() > 1
 				&& (command->CommandCode == CMD_READ_PAGE
@@ -116,7 +148,49 @@ namespace NVM
 				PRINT_ERROR("Flash chip " << ID() << ": executing a flash operation on a busy die!")
 			}
 
-			targetDie->Expected_finish_time = Simulator->Time() + Get_command_execution_latency(command->CommandCode, command->Address[0].PageID);
+			targetDie->Page_register_hit = false;
+			if (pageRegisterReadReuse) {
+				if (command->CommandCode == CMD_READ_PAGE || command->CommandCode == CMD_READ_PAGE_MULTIPLANE) {
+					targetDie->Page_register_hit = serve_from_page_registers(targetDie, command);
+				} else {
+					invalidate_page_registers(targetDie, command);
+				}
+			}
+
+			if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ || command->CommandCode == CMD_PROGRAM_PAGE_CACHE) {
+				targetDie->Cache_pages_ready = 0;
+				targetDie->Cache_pages_loaded = 0;
+				targetDie->Cache_pages_programmed = 0;
+				targetDie->Cache_register_busy = false;
+				targetDie->Cache_loading = false;
+				targetDie->Cache_array_busy = false;
+				targetDie->CurrentCMD = command;
+				targetDie->Status = DieStatus::BUSY;
+				idleDieNo--;
+				if (status == Internal_Status::IDLE) {
+					executionStartTime = Simulator->Time();
+					expectedFinishTime = INVALID_TIME;
+					status = Internal_Status::BUSY;
+				}
+
+				if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ) {
+					start_cache_array_operation(targetDie, command);
+				} else {
+					targetDie->Cache_pages_ready = 1;//The command carries the data of the first page
+					advance_cache_sequence(targetDie, command);
+				}
+				return;
+			}
+
+			if (targetDie->Page_register_hit) {
+				targetDie->Command_execution_latency = _RBSignalDelayRead;
+			} else {
+				targetDie->Command_execution_latency = Get_command_execution_latency(command->CommandCode, command->Address[0].PageID);
+			}
+			if (read_retry_model->Enabled() && !targetDie->Page_register_hit && (command->CommandCode == CMD_READ_PAGE || command->CommandCode == CMD_READ_PAGE_MULTIPLANE)) {
+				targetDie->Command_execution_latency += sample_read_retry_latency(targetDie, command, targetDie->Command_execution_latency - _RBSignalDelayRead);
+			}
+			targetDie->Expected_finish_time = Simulator->Time() + targetDie->Command_execution_latency;
 			targetDie->CommandFinishEvent = Simulator->Register_sim_event(targetDie->Expected_finish_time,
 				this, command, static_cast<int>(Chip_Sim_Event_Type::COMMAND_FINISHED));
 			targetDie->CurrentCMD = command;
@@ -132,23 +206,83 @@ namespace NVM
 			DEBUG("Command execution started on channel: " << this->ChannelID << " chip: " << this->ChipID)
 		}
 
-		void Flash_Chip::finish_command_execution(Flash_Command* command)
+		sim_time_type Flash_Chip::sample_read_retry_latency(Die* targetDie, Flash_Command* command, sim_time_type sensing_latency)
 		{
-			Die* targetDie = Dies[command->Address[0].DieID];
+			//The planes of a multiplane read are retried together, so the slowest plane determines the command latency
+			sim_time_type retry_latency = 0;
+			for (unsigned int planeCntr = 0; planeCntr < command->Address.size(); planeCntr++) {
+				sim_time_type latency = sample_plane_read_retry_latency(targetDie, command->Address[planeCntr], sensing_latency);
+				if (latency > retry_latency) {
+					retry_latency = latency;
+				}
+			}
+			STAT_totalReadRetryTime += retry_latency;
 
-			targetDie->STAT_TotalReadTime += Get_command_execution_latency(command->CommandCode, command->Address[0].PageID);
-			targetDie->Expected_finish_time = INVALID_TIME;
-			targetDie->CommandFinishEvent = NULL;
-			targetDie->CurrentCMD = NULL;
-			targetDie->Status = DieStatus::IDLE;
-			this->idleDieNo++;
-			if (idleDieNo == die_no) {
-				this->status = Internal_Status::IDLE;
-				STAT_totalExecTime += Simulator->Time() - executionStartTime;
-				if (this->lastTransferStart != INVALID_TIME) {
-					STAT_totalOverlappedXferExecTime += Simulator->Time() - lastTransferStart;
+			return retry_latency;
+		}
+
+		sim_time_type Flash_Chip::sample_plane_read_retry_latency(Die* targetDie, const Physical_Page_Address& address, sim_time_type sensing_latency)
+		{
+			Block* targetBlock = targetDie->Planes[address.PlaneID]->Blocks[address.BlockID];
+			double rber = read_retry_model->Raw_bit_error_rate(targetBlock->Erase_count,
+				read_retry_model->Retention_time(targetBlock->Data_program_time), targetBlock->Reads_since_erase);
+			bool soft_decode = false;
+			unsigned int retry_steps = read_retry_model->Sample_retry_steps(rber, soft_decode);
+
+			STAT_readRetryStepHistogram[retry_steps]++;
+			STAT_readRetryStepCount += retry_steps;
+			if (retry_steps > 0) {
+				STAT_retriedReadCount++;
+			}
+			if (soft_decode) {
+				STAT_softDecodeCount++;
+			}
+
+			return read_retry_model->Retry_latency(retry_steps, soft_decode, sensing_latency);
+		}
+
+		/*
+		* A read whose pages are all still in the page registers of their planes, since an earlier read sensed them, only needs
+		* the data transfer. Otherwise, the read senses its pages and they replace the contents of the page registers.
+		*/
+		bool Flash_Chip::serve_from_page_registers(Die* targetDie, Flash_Command* command)
+		{
+			bool hit = true;
+			for (unsigned int planeCntr = 0; planeCntr < command->Address.size(); planeCntr++) {
+				const Page_Register& page_register = targetDie->Page_registers[command->Address[planeCntr].PlaneID];
+				if (!page_register.Valid || page_register.BlockID != command->Address[planeCntr].BlockID || page_register.PageID != command->Address[planeCntr].PageID) {
+					hit = false;
+					break;
 				}
 			}
+			if (hit) {
+				targetDie->STAT_page_register_hits += command->Address.size() + command->Addresses_subpgs.size();
+				return true;
+			}
+
+			for (unsigned int planeCntr = 0; planeCntr < command->Address.size(); planeCntr++) {
+				Page_Register& page_register = targetDie->Page_registers[command->Address[planeCntr].PlaneID];
+				page_register.Valid = true;
+				page_register.BlockID = command->Address[planeCntr].BlockID;
+				page_register.PageID = command->Address[planeCntr].PageID;
+			}
+			return false;
+		}
+
+		//Programs, erases, copybacks and cache sequences overwrite the page registers of the planes that they use
+		void Flash_Chip::invalidate_page_registers(Die* targetDie, Flash_Command* command)
+		{
+			for (unsigned int planeCntr = 0; planeCntr < command->Address.size(); planeCntr++) {
+				targetDie->Page_registers[command->Address[planeCntr].PlaneID].Valid = false;
+			}
+		}
+
+		void Flash_Chip::finish_command_execution(Flash_Command* command)
+		{
+			Die* targetDie = Dies[command->Address[0].DieID];
+
+			targetDie->STAT_TotalReadTime += targetDie->Command_execution_latency;
+			finish_die_execution(targetDie);
 
 			switch (command->CommandCode)
 			{
@@ -161,6 +295,9 @@ namespace NVM
 
 						STAT_readCount++;
 						targetDie->Planes[command->Address[planeCntr].PlaneID]->Read_count++;
+						if (!targetDie->Page_register_hit) {
+							targetDie->Planes[command->Address[planeCntr].PlaneID]->Blocks[command->Address[planeCntr].BlockID]->Reads_since_erase++;
+						}
 						targetDie->Planes[command->Address[planeCntr].PlaneID]->Blocks[command->Address[planeCntr].BlockID]->Pages[command->Address[planeCntr].PageID].SubPages[command->Address[planeCntr].subPageID].Read_metadata((SubPageMetadata&)command->Meta_data[planeCntr]);
 
 					}
@@ -184,6 +321,9 @@ namespace NVM
 						//std::cout << "[debug3] command (ch,chip,die,plane,block,pg,subpg): " << command->Address[planeCntr].ChannelID << ", " << command->Address[planeCntr].ChipID << ", " << command->Address[planeCntr].DieID << ", " << command->Address[planeCntr].PlaneID << ", " << command->Address[planeCntr].BlockID << ", " << command->Address[planeCntr].PageID << ", " << command->Address[planeCntr].subPageID << std::endl;
 
 						targetDie->Planes[command->Address[planeCntr].PlaneID]->Progam_count++;
+						if (targetDie->Planes[command->Address[planeCntr].PlaneID]->Blocks[command->Address[planeCntr].BlockID]->Data_program_time == INVALID_TIME) {
+							targetDie->Planes[command->Address[planeCntr].PlaneID]->Blocks[command->Address[planeCntr].BlockID]->Data_program_time = Simulator->Time();
+						}
 						targetDie->Planes[command->Address[planeCntr].PlaneID]->Blocks[command->Address[planeCntr].BlockID]->Pages[command->Address[planeCntr].PageID].SubPages[command->Address[planeCntr].subPageID].Write_metadata((SubPageMetadata&)(command->Meta_data[planeCntr]));
 					}
 										
@@ -206,6 +346,9 @@ namespace NVM
 						STAT_eraseCount++;
 						targetDie->Planes[command->Address[planeCntr].PlaneID]->Erase_count++;
 						Block* targetBlock = targetDie->Planes[command->Address[planeCntr].PlaneID]->Blocks[command->Address[planeCntr].BlockID];
+						targetBlock->Erase_count++;
+						targetBlock->Reads_since_erase = 0;
+						targetBlock->Data_program_time = INVALID_TIME;
 						for (unsigned int i = 0; i < page_no_per_block; i++) {
 							//targetBlock->Pages[i].Metadata.SourceStreamID = NO_STREAM;
 							//targetBlock->Pages[i].Metadata.Status = FREE_PAGE;
@@ -222,6 +365,159 @@ namespace NVM
 			broadcast_ready_signal(command);
 		}
 
+		void Flash_Chip::finish_die_execution(Die* targetDie)
+		{
+			targetDie->Expected_finish_time = INVALID_TIME;
+			targetDie->CommandFinishEvent = NULL;
+			targetDie->CurrentCMD = NULL;
+			targetDie->Status = DieStatus::IDLE;
+			this->idleDieNo++;
+			if (idleDieNo == die_no) {
+				this->status = Internal_Status::IDLE;
+				STAT_totalExecTime += Simulator->Time() - executionStartTime;
+				if (this->lastTransferStart != INVALID_TIME) {
+					STAT_totalOverlappedXferExecTime += Simulator->Time() - lastTransferStart;
+				}
+			}
+		}
+
+		/*
+		* Cache read and cache program sequences run on the pages of one block. In a cache read, the page register senses the next page
+		* while the controller transfers the previous page out of the cache register; a sensed page moves to the cache register (tRCBSY)
+		* once the controller has released it. In a cache program, the controller transfers the data of the next page into the cache
+		* register while the page register programs the previous page; the data moves to the page register (tCBSY) once the program
+		* of the previous page is finished.
+		*/
+		void Flash_Chip::start_cache_array_operation(Die* targetDie, Flash_Command* command)
+		{
+			if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ) {
+				const Physical_Page_Address& address = command->Address[targetDie->Cache_pages_ready];
+				targetDie->Command_execution_latency = Get_command_execution_latency(CMD_READ_PAGE, address.PageID);
+				if (read_retry_model->Enabled()) {
+					sim_time_type retry_latency = sample_plane_read_retry_latency(targetDie, address, targetDie->Command_execution_latency - _RBSignalDelayRead);
+					STAT_totalReadRetryTime += retry_latency;
+					targetDie->Command_execution_latency += retry_latency;
+				}
+			} else {
+				targetDie->Command_execution_latency = Get_command_execution_latency(CMD_PROGRAM_PAGE, command->Address[targetDie->Cache_pages_programmed].PageID);
+			}
+			targetDie->Cache_array_busy = true;
+			targetDie->Expected_finish_time = Simulator->Time() + targetDie->Command_execution_latency;
+			targetDie->CommandFinishEvent = Simulator->Register_sim_event(targetDie->Expected_finish_time,
+				this, command, static_cast<int>(Chip_Sim_Event_Type::COMMAND_FINISHED));
+			if (expectedFinishTime == INVALID_TIME || targetDie->Expected_finish_time > expectedFinishTime) {
+				expectedFinishTime = targetDie->Expected_finish_time;
+			}
+		}
+
+		void Flash_Chip::finish_cache_array_operation(Flash_Command* command)
+		{
+			Die* targetDie = Dies[command->Address[0].DieID];
+			targetDie->Cache_array_busy = false;
+			targetDie->CommandFinishEvent = NULL;
+			targetDie->Expected_finish_time = INVALID_TIME;
+
+			if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ) {
+				DEBUG("Channel " << this->ChannelID << " Chip " << this->ChipID << "- Finished sensing a page of a cache read sequence")
+				targetDie->STAT_TotalReadTime += targetDie->Command_execution_latency;
+				const Physical_Page_Address& address = command->Address[targetDie->Cache_pages_ready];
+				Plane* targetPlane = targetDie->Planes[address.PlaneID];
+				STAT_readCount++;
+				targetPlane->Read_count++;
+				targetPlane->Blocks[address.BlockID]->Reads_since_erase++;
+				targetPlane->Blocks[address.BlockID]->Pages[address.PageID].SubPages[address.subPageID].Read_metadata((SubPageMetadata&)command->Meta_data[targetDie->Cache_pages_ready]);
+				for (unsigned int Cntr = 0; Cntr < command->Addresses_subpgs.size(); Cntr++) {
+					const Physical_Page_Address& subpg_address = command->Addresses_subpgs[Cntr];
+					if (subpg_address.PlaneID == address.PlaneID && subpg_address.BlockID == address.BlockID && subpg_address.PageID == address.PageID) {
+						STAT_readCount++;
+						targetPlane->Read_count++;
+						targetPlane->Blocks[address.BlockID]->Pages[address.PageID].SubPages[subpg_address.subPageID].Read_metadata(command->Meta_datas_subpgs[Cntr]);
+					}
+				}
+				targetDie->Cache_pages_ready++;
+			} else {
+				DEBUG("Channel " << this->ChannelID << " Chip " << this->ChipID << "- Finished programming a page of a cache program sequence")
+				targetDie->STAT_TotalProgramTime += targetDie->Command_execution_latency;
+				const Physical_Page_Address& address = command->Address[targetDie->Cache_pages_programmed];
+				Plane* targetPlane = targetDie->Planes[address.PlaneID];
+				STAT_progamCount++;
+				targetPlane->Progam_count++;
+				if (targetPlane->Blocks[address.BlockID]->Data_program_time == INVALID_TIME) {
+					targetPlane->Blocks[address.BlockID]->Data_program_time = Simulator->Time();
+				}
+				targetPlane->Blocks[address.BlockID]->Pages[address.PageID].SubPages[address.subPageID].Write_metadata((SubPageMetadata&)(command->Meta_data[targetDie->Cache_pages_programmed]));
+				for (unsigned int Cntr = 0; Cntr < command->Addresses_subpgs.size(); Cntr++) {
+					const Physical_Page_Address& subpg_address = command->Addresses_subpgs[Cntr];
+					if (subpg_address.PlaneID == address.PlaneID && subpg_address.BlockID == address.BlockID && subpg_address.PageID == address.PageID) {
+						STAT_progamCount++;
+						targetPlane->Progam_count++;
+						targetPlane->Blocks[address.BlockID]->Pages[address.PageID].SubPages[subpg_address.subPageID].Write_metadata(command->Meta_datas_subpgs[Cntr]);
+					}
+				}
+				targetDie->Cache_pages_programmed++;
+				if (targetDie->Cache_pages_programmed == command->Address.size()) {
+					finish_die_execution(targetDie);
+					broadcast_ready_signal(command);
+					return;
+				}
+			}
+
+			advance_cache_sequence(targetDie, command);
+		}
+
+		void Flash_Chip::advance_cache_sequence(Die* targetDie, Flash_Command* command)
+		{
+			if (targetDie->Cache_loading || targetDie->Cache_pages_ready == targetDie->Cache_pages_loaded) {
+				return;
+			}
+
+			sim_time_type busy_time;
+			if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ) {
+				if (targetDie->Cache_register_busy) {
+					return;
+				}
+				busy_time = _cacheReadBusyLatency;
+			} else {
+				if (targetDie->Cache_array_busy) {
+					return;
+				}
+				busy_time = _cacheProgramBusyLatency;
+			}
+			targetDie->Cache_loading = true;
+			Simulator->Register_sim_event(Simulator->Time() + busy_time, this, command, static_cast<int>(Chip_Sim_Event_Type::CACHE_REGISTER_LOADED));
+		}
+
+		void Flash_Chip::finish_cache_register_load(Flash_Command* command)
+		{
+			Die* targetDie = Dies[command->Address[0].DieID];
+			targetDie->Cache_loading = false;
+			targetDie->Cache_pages_loaded++;
+
+			if (command->CommandCode == CMD_READ_PAGE_CACHE_SEQ) {
+				targetDie->Cache_register_busy = true;
+				if (targetDie->Cache_pages_ready < command->Address.size()) {
+					start_cache_array_operation(targetDie, command);
+				} else {
+					finish_die_execution(targetDie);
+				}
+				broadcast_ready_signal(command);
+			} else {
+				start_cache_array_operation(targetDie, command);
+				if (targetDie->Cache_pages_loaded < command->Address.size()) {
+					broadcast_ready_signal(command);//The cache register is ready for the data of the next page
+				}
+			}
+		}
+
+		void Flash_Chip::Release_cache_register(flash_die_ID_type dieID)
+		{
+			Die* targetDie = Dies[dieID];
+			targetDie->Cache_register_busy = false;
+			if (targetDie->CurrentCMD != NULL) {
+				advance_cache_sequence(targetDie, targetDie->CurrentCMD);
+			}
+		}
+
 		void Flash_Chip::broadcast_ready_signal(Flash_Command* command)
 		{
 			for (std::vector<ChipReadySignalHandlerType>::iterator it = connectedReadyHandlers.begin();
@@ -271,6 +567,9 @@ namespace NVM
 			targetDie->CurrentCMD = targetDie->SuspendedCMD;
 			targetDie->SuspendedCMD = NULL;
 			targetDie->Suspended = false;
+			if (pageRegisterReadReuse) {
+				invalidate_page_registers(targetDie, targetDie->CurrentCMD);//The reads served during the suspension refilled the page registers
+			}
 			STAT_totalResumeCount++;
 
 			targetDie->Expected_finish_time = Simulator->Time() + targetDie->RemainingSuspendedExecTime;
@@ -320,6 +619,50 @@ namespace NVM
 			attr = "Fraction_of_Time_Idle";
 			val = std::to_string((Simulator->Time() - STAT_totalOverlappedXferExecTime - STAT_totalXferTime) / double(Simulator->Time()));
 			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			if (pageRegisterReadReuse) {
+				unsigned long hits = 0;
+				val = "";
+				for (unsigned int dieID = 0; dieID < die_no; dieID++) {
+					hits += Dies[dieID]->STAT_page_register_hits;
+					val += (dieID == 0 ? "" : " ") + std::to_string(Dies[dieID]->STAT_page_register_hits);
+				}
+				attr = "Page_Register_Hits_Per_Die";
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Page_Register_Hit_Ratio";
+				val = std::to_string(STAT_readCount == 0 ? 0 : (double)hits / STAT_readCount);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+			}
+
+			if (read_retry_model->Enabled()) {
+				attr = "Reads_With_Retry";
+				val = std::to_string(STAT_retriedReadCount);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Read_Retry_Steps";
+				val = std::to_string(STAT_readRetryStepCount);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Average_Read_Retry_Steps";
+				val = std::to_string(STAT_readCount == 0 ? 0 : (double)STAT_readRetryStepCount / STAT_readCount);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Soft_Decode_Count";
+				val = std::to_string(STAT_softDecodeCount);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Total_Read_Retry_Time";
+				val = std::to_string(STAT_totalReadRetryTime);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Read_Retry_Step_Histogram";//Number of plane reads that needed 0, 1, ..., Max_Read_Retry_Steps retries
+				val = "";
+				for (unsigned int i = 0; i < STAT_readRetryStepHistogram.size(); i++) {
+					val += (i == 0 ? "" : " ") + std::to_string(STAT_readRetryStepHistogram[i]);
+				}
+				xmlwriter.Write_attribute_string_inline(attr, val);
+			}
 		
 			xmlwriter.Write_end_element_tag();
 		}
@@ -9,6 +9,7 @@
 #include "FlashTypes.h"
 #include "Die.h"
 #include "Flash_Command.h"
+#include "Read_Retry_Model.h"
 #include <vector>
 #include <stdexcept>
 
@@ -19,13 +20,15 @@ namespace NVM
 		class Flash_Chip : public NVM_Chip
 		{
 			enum class Internal_Status { IDLE, BUSY };
-			enum class Chip_Sim_Event_Type { COMMAND_FINISHED };
+			enum class Chip_Sim_Event_Type { COMMAND_FINISHED, CACHE_REGISTER_LOADED };
 		public:
 			Flash_Chip(const sim_object_id_type&, flash_channel_ID_type channelID, flash_chip_ID_type localChipID,
 				Flash_Technology_Type flash_technology, 
 				unsigned int dieNo, unsigned int PlaneNoPerDie, unsigned int Block_no_per_plane, unsigned int Page_no_per_block,
 				sim_time_type *readLatency, sim_time_type *programLatency, sim_time_type eraseLatency,
 				sim_time_type suspendProgramLatency, sim_time_type suspendEraseLatency,
+				sim_time_type cacheReadBusyLatency, sim_time_type cacheProgramBusyLatency,
+				bool pageRegisterReadReuse, const Read_Retry_Parameters& readRetryParameters, int seed,
 				sim_time_type commProtocolDelayRead = 20, sim_time_type commProtocolDelayWrite = 0, sim_time_type commProtocolDelayErase = 0);
 			~Flash_Chip();
 			flash_channel_ID_type ChannelID;
@@ -99,11 +102,15 @@ namespace NVM
 					case CMD_READ_PAGE_COPYBACK:
 					case CMD_READ_PAGE_COPYBACK_MULTIPLANE:
 						return _readLatency[latencyType] + _RBSignalDelayRead;
+					case CMD_READ_PAGE_CACHE_SEQ://Per page of the sequence
+						return _readLatency[latencyType] + _RBSignalDelayRead + _cacheReadBusyLatency;
 					case CMD_PROGRAM_PAGE:
 					case CMD_PROGRAM_PAGE_MULTIPLANE:
 					case CMD_PROGRAM_PAGE_COPYBACK:
 					case CMD_PROGRAM_PAGE_COPYBACK_MULTIPLANE:
 						return _programLatency[latencyType] + _RBSignalDelayWrite;
+					case CMD_PROGRAM_PAGE_CACHE://Per page of the sequence
+						return _programLatency[latencyType] + _RBSignalDelayWrite + _cacheProgramBusyLatency;
 					case CMD_ERASE_BLOCK:
 					case CMD_ERASE_BLOCK_MULTIPLANE:
 						return _eraseLatency + _RBSignalDelayErase;
@@ -112,6 +119,7 @@ namespace NVM
 				}
 			}
 
+			void Release_cache_register(flash_die_ID_type dieID);//The controller has transferred out the page in the cache register during a cache read sequence
 			void Suspend(flash_die_ID_type dieID);
 			void Resume(flash_die_ID_type dieID);
 			sim_time_type GetSuspendProgramTime();
@@ -129,16 +137,32 @@ namespace NVM
 			unsigned int page_no_per_block;                 //indicate how many pages in a block
 			sim_time_type *_readLatency, *_programLatency, _eraseLatency;
 			sim_time_type _suspendProgramLatency, _suspendEraseLatency;
+			sim_time_type _cacheReadBusyLatency, _cacheProgramBusyLatency;
+			bool pageRegisterReadReuse;
 			sim_time_type _RBSignalDelayRead, _RBSignalDelayWrite, _RBSignalDelayErase;
 			sim_time_type lastTransferStart;
 			sim_time_type executionStartTime, expectedFinishTime;
 
+			Read_Retry_Model* read_retry_model;
+
 			unsigned long STAT_readCount, STAT_progamCount, STAT_eraseCount;
+			unsigned long STAT_retriedReadCount, STAT_readRetryStepCount, STAT_softDecodeCount;
+			sim_time_type STAT_totalReadRetryTime;
+			std::vector<unsigned long> STAT_readRetryStepHistogram;
 			unsigned long STAT_totalSuspensionCount, STAT_totalResumeCount;
 			sim_time_type STAT_totalExecTime, STAT_totalXferTime, STAT_totalOverlappedXferExecTime;
 
 			void start_command_execution(Flash_Command* command);
+			sim_time_type sample_read_retry_latency(Die* targetDie, Flash_Command* command, sim_time_type sensing_latency);
+			sim_time_type sample_plane_read_retry_latency(Die* targetDie, const Physical_Page_Address& address, sim_time_type sensing_latency);
+			bool serve_from_page_registers(Die* targetDie, Flash_Command* command);
+			void invalidate_page_registers(Die* targetDie, Flash_Command* command);
 			void finish_command_execution(Flash_Command* command);
+			void finish_die_execution(Die* targetDie);
+			void start_cache_array_operation(Die* targetDie, Flash_Command* command);
+			void finish_cache_array_operation(Flash_Command* command);
+			void advance_cache_sequence(Die* targetDie, Flash_Command* command);
+			void finish_cache_register_load(Flash_Command* command);
 			void broadcast_ready_signal(Flash_Command* command);
 			std::vector<ChipReadySignalHandlerType> connectedReadyHandlers;
 		};
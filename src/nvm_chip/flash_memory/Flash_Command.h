@@ -10,7 +10,7 @@
 
 #define CMD_READ 0x0030
 #define CMD_READ_PAGE 0x0030
-#define CMD_READ_PAGE_CACHE_SEQ 0x31
+#define CMD_READ_PAGE_CACHE_SEQ 0x0031F //A sequence of 31h commands closed by 3Fh; its code is changed since 0x31 is also the code of cache random read
 #define CMD_READ_PAGE_CACHE_RANDOM 0x0031
 #define CMD_READ_PAGE_MULTIPLANE 0x0032
 #define CMD_READ_PAGE_COPYBACK 0x0035
@@ -18,6 +18,7 @@
 #define CMD_PROGRAM 0x8000
 #define CMD_PROGRAM_PAGE 0x8010
 #define CMD_PROGRAM_PAGE_MULTIPLANE 0x8011
+#define CMD_PROGRAM_PAGE_CACHE 0x8015
 #define CMD_PROGRAM_PAGE_COPYBACK 0x8510
 #define CMD_PROGRAM_PAGE_COPYBACK_MULTIPLANE 0x85111 //since the codes of multiplane copyback (i.e., 0x8511) and multiplane program (i.e., 0x8511) are identical, we change the code of multiplane copyback 0x8511 to 0x85111 so that we can differentiate copyback multiplane from normal multiplane
 //#define CMD_SUSPEND_PROGRAM 0x86
@@ -0,0 +1,88 @@
+#include <cmath>
+#include "../../sim/Engine.h"
+#include "Read_Retry_Model.h"
+
+namespace NVM
+{
+	namespace FlashMemory
+	{
+		//The shape of the decode failure curve: the failure probability is ~63% when the RBER equals the ECC capability
+		#define DECODE_FAILURE_SHAPE 4.0
+		#define NANO_SECONDS_PER_HOUR 3600000000000.0
+
+		Read_Retry_Model::Read_Retry_Model(const Read_Retry_Parameters& parameters, int seed)
+			: parameters(parameters), random_generator(NULL)
+		{
+			if (parameters.Enabled) {
+				if (parameters.Rated_PE_cycles == 0) {
+					PRINT_ERROR("Read-retry model: the rated P/E cycle count of the flash blocks should be greater than zero!")
+				}
+				if (parameters.ECC_correctable_RBER <= 0) {
+					PRINT_ERROR("Read-retry model: the ECC correctable RBER should be greater than zero!")
+				}
+				if (parameters.Retry_step_RBER_reduction <= 0 || parameters.Retry_step_RBER_reduction > 1) {
+					PRINT_ERROR("Read-retry model: the RBER reduction of a retry step should be in (0, 1]!")
+				}
+				random_generator = new Utils::RandomGenerator(seed);
+			}
+		}
+
+		Read_Retry_Model::~Read_Retry_Model()
+		{
+			delete random_generator;
+		}
+
+		double Read_Retry_Model::Raw_bit_error_rate(unsigned int pe_cycles, sim_time_type retention_time, unsigned long reads_since_erase) const
+		{
+			double wear = (double)pe_cycles / parameters.Rated_PE_cycles;
+			double retention_hours = retention_time / NANO_SECONDS_PER_HOUR;
+
+			//Retention loss is faster on worn cells, since the tunnel oxide of an aged cell leaks charge more easily
+			double rber = parameters.Base_RBER * (1.0 + parameters.Wear_RBER_factor * wear * wear)
+				* (1.0 + parameters.Retention_RBER_factor * (1.0 + wear) * std::log10(1.0 + retention_hours));
+			rber += parameters.Read_disturb_RBER_per_read * reads_since_erase * (1.0 + wear);
+
+			return rber;
+		}
+
+		sim_time_type Read_Retry_Model::Retention_time(sim_time_type data_program_time) const
+		{
+			if (data_program_time == INVALID_TIME) {//The data is written during preconditioning
+				return (sim_time_type)(parameters.Initial_retention_hours * NANO_SECONDS_PER_HOUR) + Simulator->Time();
+			}
+
+			return Simulator->Time() - data_program_time;
+		}
+
+		double Read_Retry_Model::decode_failure_probability(double rber) const
+		{
+			return 1.0 - std::exp(-std::pow(rber / parameters.ECC_correctable_RBER, DECODE_FAILURE_SHAPE));
+		}
+
+		unsigned int Read_Retry_Model::Sample_retry_steps(double rber, bool& soft_decode)
+		{
+			unsigned int retry_steps = 0;
+			soft_decode = false;
+			while (random_generator->FloatRandom() < decode_failure_probability(rber)) {
+				if (retry_steps == parameters.Max_retry_steps) {
+					soft_decode = true;
+					break;
+				}
+				retry_steps++;
+				rber *= parameters.Retry_step_RBER_reduction;
+			}
+
+			return retry_steps;
+		}
+
+		sim_time_type Read_Retry_Model::Retry_latency(unsigned int retry_steps, bool soft_decode, sim_time_type sensing_latency) const
+		{
+			sim_time_type latency = retry_steps * (sensing_latency + parameters.Retry_step_overhead);
+			if (soft_decode) {
+				latency += parameters.Soft_decode_latency;
+			}
+
+			return latency;
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef READ_RETRY_MODEL_H
+#define READ_RETRY_MODEL_H
+
+#include "../../sim/Sim_Defs.h"
+#include "../../utils/RandomGenerator.h"
+
+namespace NVM
+{
+	namespace FlashMemory
+	{
+		struct Read_Retry_Parameters
+		{
+			bool Enabled;
+			unsigned int Rated_PE_cycles;//The P/E cycle count that the block is rated for (Block_PE_Cycles_Limit)
+			unsigned int Initial_PE_cycles;//The wear of the blocks at the start of the simulation
+			double Initial_retention_hours;//The age of the data that is written to the flash during preconditioning
+			double Base_RBER;//Raw bit error rate of a fresh block right after programming
+			double Wear_RBER_factor;
+			double Retention_RBER_factor;
+			double Read_disturb_RBER_per_read;
+			double ECC_correctable_RBER;//The raw bit error rate at which the hard-decision ECC decoder starts failing
+			unsigned int Max_retry_steps;
+			double Retry_step_RBER_reduction;//The fraction of the raw bit errors that remains after each read reference voltage shift
+			sim_time_type Retry_step_overhead;//The time to set the new read reference voltage (SET FEATURE) before each retry
+			sim_time_type Soft_decode_latency;//The extra sensing and soft-decision decoding time once all retry steps fail
+		};
+
+		/*
+		* An error model for the flash read path. The raw bit error rate (RBER) of a block grows with its P/E
+		* cycle count, with the age of its data (retention) and with the number of reads since its last erase
+		* (read disturb). A read fails to decode with a probability that rises sharply as the RBER approaches the
+		* correction capability of the ECC. Each failed decode triggers a read-retry step at a shifted read reference
+		* voltage, which lowers the residual RBER. If all retry steps fail, the controller falls back to soft decoding.
+		*/
+		class Read_Retry_Model
+		{
+		public:
+			Read_Retry_Model(const Read_Retry_Parameters& parameters, int seed);
+			~Read_Retry_Model();
+			bool Enabled() const { return parameters.Enabled; }
+			unsigned int Initial_PE_cycles() const { return parameters.Initial_PE_cycles; }
+			unsigned int Max_retry_steps() const { return parameters.Max_retry_steps; }
+			double Raw_bit_error_rate(unsigned int pe_cycles, sim_time_type retention_time, unsigned long reads_since_erase) const;
+			sim_time_type Retention_time(sim_time_type data_program_time) const;
+			unsigned int Sample_retry_steps(double rber, bool& soft_decode);
+			sim_time_type Retry_latency(unsigned int retry_steps, bool soft_decode, sim_time_type sensing_latency) const;
+		private:
+			Read_Retry_Parameters parameters;
+			Utils::RandomGenerator* random_generator;
+			double decode_failure_probability(double rber) const;
+		};
+	}
+}
+
+#endif // !READ_RETRY_MODEL_H
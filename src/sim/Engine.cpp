@@ -54,6 +54,21 @@ namespace MQSimEngine
 
 	/// This is the main method of simulator which starts simulation process.
 	void Engine::Start_simulation()
+	{
+		Prepare_simulation();
+
+		while (true) {
+			if (_EventList->Count == 0 || stop) {
+				//std::cout << " check" << std::endl;
+				break;
+			}
+			execute_earliest_events();
+		}
+	}
+
+	/// Sets up the triggers, validates and starts all registered objects without processing any event.
+	/// Embedding programs call it once and then step the simulation with Run_until.
+	void Engine::Prepare_simulation()
 	{
 		started = true;
 
@@ -76,29 +91,56 @@ namespace MQSimEngine
 			++obj) {
 			obj->second->Start_simulation();
 		}
-		
-		Sim_Event* ev = NULL;
-		while (true) {
-			if (_EventList->Count == 0 || stop) {
-				//std::cout << " check" << std::endl;
-				break;
-			}
+	}
 
-			EventTreeNode* minNode = _EventList->Get_min_node();
-			ev = minNode->FirstSimEvent;
+	/// Executes all the events whose fire time is not later than the given time and then advances the
+	/// simulation clock to that time. Events that are registered for the same time while stepping are
+	/// executed in the same call, so stepping to a time is equivalent to an uninterrupted run up to it.
+	void Engine::Run_until(sim_time_type time)
+	{
+		if (!started) {
+			Prepare_simulation();
+		}
+
+		while (_EventList->Count > 0 && !stop && _EventList->Get_min_key() <= time) {
+			execute_earliest_events();
+		}
+
+		if (!stop && time != MAXIMUM_TIME && _sim_time < time) {
+			_sim_time = time;
+		}
+	}
+
+	bool Engine::Has_pending_events()
+	{
+		return _EventList->Count > 0;
+	}
+
+	sim_time_type Engine::Next_event_time()
+	{
+		if (_EventList->Count == 0) {
+			return MAXIMUM_TIME;
+		}
+
+		return _EventList->Get_min_key();
+	}
+
+	void Engine::execute_earliest_events()
+	{
+		EventTreeNode* minNode = _EventList->Get_min_node();
+		Sim_Event* ev = minNode->FirstSimEvent;
 
-			_sim_time = ev->Fire_time;
+		_sim_time = ev->Fire_time;
 
-			while (ev != NULL) {
-				if(!ev->Ignore) {
-					ev->Target_sim_object->Execute_simulator_event(ev);
-				}
-				Sim_Event* consumed_event = ev;
-				ev = ev->Next_event;
-				delete consumed_event;
+		while (ev != NULL) {
+			if(!ev->Ignore) {
+				ev->Target_sim_object->Execute_simulator_event(ev);
 			}
-			_EventList->Remove(minNode);
+			Sim_Event* consumed_event = ev;
+			ev = ev->Next_event;
+			delete consumed_event;
 		}
+		_EventList->Remove(minNode);
 	}
 
 	void Engine::Stop_simulation()
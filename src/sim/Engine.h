@@ -33,6 +33,10 @@ namespace MQSimEngine {
 		Sim_Object* GetObject(sim_object_id_type object_id);
 		void RemoveObject(Sim_Object* obj);
 		void Start_simulation();
+		void Prepare_simulation();
+		void Run_until(sim_time_type time);
+		bool Has_pending_events();
+		sim_time_type Next_event_time();
 		void Stop_simulation();
 		bool Has_started();
 		bool Is_integrated_execution_mode();
@@ -45,6 +49,7 @@ namespace MQSimEngine {
 		bool stop;
 		bool started;
 		static Engine* _instance;
+		void execute_earliest_events();
 	};
 }
 
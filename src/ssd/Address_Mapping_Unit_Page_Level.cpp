@@ -16,31 +16,101 @@ int subpgs_host_w_debug = 0;
 
 namespace SSD_Components
 {
-	Cached_Mapping_Table::Cached_Mapping_Table(unsigned int capacity) : capacity(capacity)
+	const unsigned int Cached_Mapping_Table::NO_SLOT;
+
+	Cached_Mapping_Table::Cached_Mapping_Table(unsigned int capacity) : index_bits(4), clock_hand(0), occupied_slots(0), capacity(capacity)
 	{
+		//The slot array and the index grow up to the CMT capacity and are never shrunk, so steady state operation is allocation free
+		unsigned int initial_slots = capacity < 4096 ? capacity : 4096;
+		while ((1U << index_bits) < 2 * initial_slots) {
+			index_bits++;
+		}
+		index_mask = (1U << index_bits) - 1;
+		index.assign(index_mask + 1, NO_SLOT);
+		slots.reserve(initial_slots);
+		slot_keys.reserve(initial_slots);
 	}
 
 	Cached_Mapping_Table::~Cached_Mapping_Table()
 	{
-		std::unordered_map<LPA_type, CMTSlotType*> addressMap;
-		std::list<std::pair<LPA_type, CMTSlotType*>> lruList;
+	}
+
+	inline unsigned int Cached_Mapping_Table::home_bucket(const LPA_type key) const
+	{
+		return (unsigned int)((key * 0x9E3779B97F4A7C15ULL) >> (64 - index_bits));
+	}
+
+	inline unsigned int Cached_Mapping_Table::find_slot(const LPA_type key) const
+	{
+		unsigned int bucket = home_bucket(key);
+		while (index[bucket] != NO_SLOT) {
+			if (slot_keys[index[bucket]] == key) {
+				return index[bucket];
+			}
+			bucket = (bucket + 1) & index_mask;
+		}
+
+		return NO_SLOT;
+	}
+
+	void Cached_Mapping_Table::insert_into_index(const LPA_type key, const unsigned int slot_id)
+	{
+		if (2 * (occupied_slots + 1) > index_mask + 1) {
+			grow_index();
+		}
+		unsigned int bucket = home_bucket(key);
+		while (index[bucket] != NO_SLOT) {
+			bucket = (bucket + 1) & index_mask;
+		}
+		index[bucket] = slot_id;
+	}
+
+	void Cached_Mapping_Table::remove_from_index(const LPA_type key)
+	{
+		unsigned int hole = home_bucket(key);
+		while (slot_keys[index[hole]] != key) {
+			hole = (hole + 1) & index_mask;
+		}
+
+		//Backward-shift deletion: pull forward every entry of the probe run that may legally occupy the hole
+		unsigned int next = (hole + 1) & index_mask;
+		while (index[next] != NO_SLOT) {
+			unsigned int home = home_bucket(slot_keys[index[next]]);
+			if (((next - home) & index_mask) >= ((next - hole) & index_mask)) {
+				index[hole] = index[next];
+				hole = next;
+			}
+			next = (next + 1) & index_mask;
+		}
+		index[hole] = NO_SLOT;
+	}
 
-		auto entry = addressMap.begin();
-		while (entry != addressMap.end()) {
-			delete (*entry).second;
-			addressMap.erase(entry++);
+	void Cached_Mapping_Table::grow_index()
+	{
+		index_bits++;
+		index_mask = (1U << index_bits) - 1;
+		index.assign(index_mask + 1, NO_SLOT);
+		for (unsigned int slot_id = 0; slot_id < slots.size(); slot_id++) {
+			if (slots[slot_id].Status == CMTEntryStatus::FREE) {
+				continue;
+			}
+			unsigned int bucket = home_bucket(slot_keys[slot_id]);
+			while (index[bucket] != NO_SLOT) {
+				bucket = (bucket + 1) & index_mask;
+			}
+			index[bucket] = slot_id;
 		}
 	}
 
 	inline bool Cached_Mapping_Table::Exists(const stream_id_type streamID, const LPA_type lpa)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-		auto it = addressMap.find(key);
-		if (it == addressMap.end()) {
+		unsigned int slot_id = find_slot(key);
+		if (slot_id == NO_SLOT) {
 			DEBUG("Address mapping table query - Stream ID:" << streamID << ", LPA:" << lpa << ", MISS")
-				return false;
+			return false;
 		}
-		if (it->second->Status != CMTEntryStatus::VALID) {
+		if (slots[slot_id].Status != CMTEntryStatus::VALID) {
 			DEBUG("Address mapping table query - Stream ID:" << streamID << ", LPA:" << lpa << ", MISS")
 			return false;
 		}
@@ -52,58 +122,68 @@ namespace SSD_Components
 	PPA_type Cached_Mapping_Table::Retrieve_ppa(const stream_id_type streamID, const LPA_type lpn)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-		auto it = addressMap.find(key);
-		assert(it != addressMap.end());
-		assert(it->second->Status == CMTEntryStatus::VALID);
-		lruList.splice(lruList.begin(), lruList, it->second->listPtr);
+		unsigned int slot_id = find_slot(key);
+		assert(slot_id != NO_SLOT);
+		assert(slots[slot_id].Status == CMTEntryStatus::VALID);
+		slots[slot_id].Referenced = true;
 		
-		return it->second->PPA;
+		return slots[slot_id].PPA;
+	}
+
+	PPA_type Cached_Mapping_Table::Peek_ppa(const stream_id_type streamID, const LPA_type lpn) const
+	{
+		unsigned int slot_id = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpn));
+		if (slot_id == NO_SLOT || slots[slot_id].Status != CMTEntryStatus::VALID) {
+			return NO_PPA;
+		}
+
+		return slots[slot_id].PPA;
 	}
 
 	page_status_type Cached_Mapping_Table::Get_bitmap_vector_of_written_sectors(const stream_id_type streamID, const LPA_type lpn)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-		auto it = addressMap.find(key);
-		assert(it != addressMap.end());
-		assert(it->second->Status == CMTEntryStatus::VALID);
+		unsigned int slot_id = find_slot(key);
+		assert(slot_id != NO_SLOT);
+		assert(slots[slot_id].Status == CMTEntryStatus::VALID);
 
-		return it->second->WrittenStateBitmap;
+		return slots[slot_id].WrittenStateBitmap;
 	}
 
 	void Cached_Mapping_Table::Update_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const page_status_type pageWriteState)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-		auto it = addressMap.find(key);
-		assert(it != addressMap.end());
-		assert(it->second->Status == CMTEntryStatus::VALID);
-		it->second->PPA = ppa;
-		it->second->WrittenStateBitmap = pageWriteState;
-		it->second->Dirty = true;
-		it->second->Stream_id = streamID;
+		unsigned int slot_id = find_slot(key);
+		assert(slot_id != NO_SLOT);
+		assert(slots[slot_id].Status == CMTEntryStatus::VALID);
+		slots[slot_id].PPA = ppa;
+		slots[slot_id].WrittenStateBitmap = pageWriteState;
+		slots[slot_id].Dirty = true;
+		slots[slot_id].Stream_id = streamID;
 		DEBUG("Address mapping table update entry - Stream ID:" << streamID << ", LPA:" << lpa << ", PPA:" << ppa)
 	}
 
 	void Cached_Mapping_Table::Insert_new_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const unsigned long long pageWriteState)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-		auto it = addressMap.find(key);
-		if (it == addressMap.end()) {
+		unsigned int slot_id = find_slot(key);
+		if (slot_id == NO_SLOT) {
 			throw std::logic_error("No slot is reserved!");
 		}
 
-		it->second->Status = CMTEntryStatus::VALID;
-		it->second->PPA = ppa;
-		it->second->WrittenStateBitmap = pageWriteState;
-		it->second->Dirty = false;
-		it->second->Stream_id = streamID;
+		slots[slot_id].Status = CMTEntryStatus::VALID;
+		slots[slot_id].PPA = ppa;
+		slots[slot_id].WrittenStateBitmap = pageWriteState;
+		slots[slot_id].Dirty = false;
+		slots[slot_id].Stream_id = streamID;
 		DEBUG("Address mapping table insert entry - Stream ID:" << streamID << ", LPA:" << lpa << ", PPA:" << ppa)
 	}
 	bool Cached_Mapping_Table::Is_slot_reserved_for_lpn_and_waiting(const stream_id_type streamID, const LPA_type lpn)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-		auto it = addressMap.find(key);
-		if (it != addressMap.end()) {
-			if (it->second->Status == CMTEntryStatus::WAITING) {
+		unsigned int slot_id = find_slot(key);
+		if (slot_id != NO_SLOT) {
+			if (slots[slot_id].Status == CMTEntryStatus::WAITING) {
 				return true;
 			}
 		}
@@ -113,37 +193,78 @@ namespace SSD_Components
 
 	inline bool Cached_Mapping_Table::Check_free_slot_availability()
 	{
-		return addressMap.size() < capacity;
+		return occupied_slots < capacity;
 	}
 	
 	void Cached_Mapping_Table::Reserve_slot_for_lpn(const stream_id_type streamID, const LPA_type lpn)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
 
-		if (addressMap.find(key) != addressMap.end()) {
+		if (find_slot(key) != NO_SLOT) {
 			throw std::logic_error("Duplicate lpa insertion into CMT!");
 		}
-		if (addressMap.size() >= capacity) {
+		if (occupied_slots >= capacity) {
 			throw std::logic_error("CMT overfull!");
 		}
 
-		CMTSlotType* cmtEnt = new CMTSlotType();
-		cmtEnt->Dirty = false;
-		cmtEnt->Stream_id = streamID;
-		lruList.push_front(std::pair<LPA_type, CMTSlotType*>(key, cmtEnt));
-		cmtEnt->Status = CMTEntryStatus::WAITING;
-		cmtEnt->listPtr = lruList.begin();
-		addressMap[key] = cmtEnt;
+		unsigned int slot_id;
+		if (free_slots.size() > 0) {
+			slot_id = free_slots.back();
+			free_slots.pop_back();
+		} else {
+			slot_id = (unsigned int)slots.size();
+			slots.push_back(CMTSlotType());
+			slot_keys.push_back(key);
+		}
+		insert_into_index(key, slot_id);
+		occupied_slots++;
+
+		CMTSlotType& cmtEnt = slots[slot_id];
+		slot_keys[slot_id] = key;
+		cmtEnt.PPA = NO_PPA;
+		cmtEnt.WrittenStateBitmap = 0;
+		cmtEnt.Dirty = false;
+		cmtEnt.Stream_id = streamID;
+		cmtEnt.Status = CMTEntryStatus::WAITING;
+		cmtEnt.Referenced = true;
 	}
 
 	CMTSlotType Cached_Mapping_Table::Evict_one_slot(LPA_type& lpa)
 	{
-		assert(addressMap.size() > 0);
-		addressMap.erase(lruList.back().first);
-		lpa = UNIQUE_KEY_TO_LPN(lruList.back().second->Stream_id,lruList.back().first);
-		CMTSlotType evictedItem = *lruList.back().second;
-		delete lruList.back().second;
-		lruList.pop_back();
+		assert(occupied_slots > 0);
+
+		/*CLOCK replacement: referenced entries get a second chance. Entries that are still waiting for
+		* their mapping data to arrive from flash are skipped, unless nothing else is resident.*/
+		unsigned int victim = NO_SLOT;
+		unsigned int waiting_victim = NO_SLOT;
+		for (size_t step = 0; step <= 2 * slots.size() && victim == NO_SLOT; step++) {
+			if (clock_hand >= slots.size()) {
+				clock_hand = 0;
+			}
+			CMTSlotType& slot = slots[clock_hand];
+			if (slot.Status == CMTEntryStatus::WAITING) {
+				if (waiting_victim == NO_SLOT) {
+					waiting_victim = clock_hand;
+				}
+			} else if (slot.Status == CMTEntryStatus::VALID) {
+				if (slot.Referenced) {
+					slot.Referenced = false;
+				} else {
+					victim = clock_hand;
+				}
+			}
+			clock_hand++;
+		}
+		if (victim == NO_SLOT) {
+			victim = waiting_victim;
+		}
+
+		lpa = UNIQUE_KEY_TO_LPN(slots[victim].Stream_id, slot_keys[victim]);
+		CMTSlotType evictedItem = slots[victim];
+		remove_from_index(slot_keys[victim]);
+		slots[victim].Status = CMTEntryStatus::FREE;
+		free_slots.push_back(victim);
+		occupied_slots--;
 	
 		return evictedItem;
 	}
@@ -151,24 +272,24 @@ namespace SSD_Components
 	bool Cached_Mapping_Table::Is_dirty(const stream_id_type streamID, const LPA_type lpa)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-		auto it = addressMap.find(key);
-		if (it == addressMap.end())
+		unsigned int slot_id = find_slot(key);
+		if (slot_id == NO_SLOT)
 		{
 			throw std::logic_error("The requested slot does not exist!");
 		}
 
-		return it->second->Dirty;
+		return slots[slot_id].Dirty;
 	}
 
 	void Cached_Mapping_Table::Make_clean(const stream_id_type streamID, const LPA_type lpn)
 	{
 		LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-		auto it = addressMap.find(key);
-		if (it == addressMap.end()) {
+		unsigned int slot_id = find_slot(key);
+		if (slot_id == NO_SLOT) {
 			throw std::logic_error("The requested slot does not exist!");
 		}
 
-		it->second->Dirty = false;
+		slots[slot_id].Dirty = false;
 	}
 
 
@@ -179,7 +300,7 @@ namespace SSD_Components
 		flash_die_ID_type* die_ids, unsigned int die_no, flash_plane_ID_type* plane_ids, unsigned int plane_no,
 		PPA_type total_physical_sectors_no, LHA_type total_logical_sectors_no, unsigned int sectors_no_per_page) :
 		CMT_entry_size(cmt_entry_size), Translation_entries_per_page(no_of_translation_entries_per_page), No_of_inserted_entries_in_preconditioning(0),
-		PlaneAllocationScheme(PlaneAllocationScheme), Channel_no(channel_no), Chip_no(chip_no), Die_no(die_no), Plane_no(plane_no)
+		PlaneAllocationScheme(PlaneAllocationScheme), Striped_by_lpa(false), Channel_no(channel_no), Chip_no(chip_no), Die_no(die_no), Plane_no(plane_no)
 	{
 		Total_physical_pages_no = total_physical_sectors_no / sectors_no_per_page;
 		max_logical_sector_address = total_logical_sectors_no;
@@ -316,7 +437,8 @@ namespace SSD_Components
 		double Overprovisioning_ratio, CMT_Sharing_Mode sharing_mode, bool fold_large_addresses)
 		: Address_Mapping_Unit_Base(id, ftl, flash_controller, block_manager, ideal_mapping_table,
 			concurrent_stream_no, channel_count, chip_no_per_channel, die_no_per_chip, plane_no_per_die,
-			Block_no_per_plane, Page_no_per_block, SectorsPerPage, PageSizeInByte, Overprovisioning_ratio, sharing_mode, fold_large_addresses)
+			Block_no_per_plane, Page_no_per_block, SectorsPerPage, PageSizeInByte, Overprovisioning_ratio, sharing_mode, fold_large_addresses),
+		unwritten_reads_on_static_pages(false)
 	{
 		_my_instance = this;
 		domains = new AddressMappingDomain*[no_of_input_streams];
@@ -542,6 +664,15 @@ namespace SSD_Components
 			}
 #endif			
 		}
+#ifdef EXECUTION_CONTROL
+		else if (is_write == true) {
+			//Writes shorter than a flush unit, e.g., the 4KB write-backs of the CXL DRAM cache
+			if (ftl->GC_and_WL_Unit->Consume_token((int)transactionList.size()) != true)
+			{
+				try_query = false;
+			}
+		}
+#endif
 
 
 		//query until flush_unit_count 
@@ -1183,7 +1314,9 @@ namespace SSD_Components
 	{
 		AddressMappingDomain* domain = domains[stream_id];
 		//// Dynamic Plane Allocation.
-		lpn = (user_Alloc_count[stream_id])++;
+		if (!domain->Striped_by_lpa) {
+			lpn = (user_Alloc_count[stream_id])++;
+		}
 
 		switch (domain->PlaneAllocationScheme) {
 			case Flash_Plane_Allocation_Scheme_Type::CWDP:
@@ -1349,7 +1482,11 @@ namespace SSD_Components
 		lpn = transaction->LPA;
 //// Dynamic Plane Allocation.
 #else
-		if (is_for_gc == false)
+		if (domain->Striped_by_lpa && transaction->Source != Transaction_Source_Type::MAPPING && transaction->LPA != NO_LPA)
+		{
+			lpn = transaction->LPA;
+		}
+		else if (is_for_gc == false)
 		{
 			lpn = user_Alloc_count[transaction->Stream_id];
 	//		lpn = (user_Alloc_count[0])++;
@@ -1602,7 +1739,7 @@ namespace SSD_Components
 		if (is_for_gc) {
 			block_manager->Allocate_block_and_page_in_plane_for_gc_write(transaction->Stream_id, transaction->Address);
 		} else {
-			block_manager->Allocate_block_and_page_in_plane_for_user_write(transaction->Stream_id, transaction->Address);
+			block_manager->Allocate_block_and_page_in_plane_for_user_write(transaction->Stream_id, transaction->Address, transaction->Placement_id);
 		}
 		transaction->PPA = Convert_address_to_ppa(transaction->Address);
 
@@ -1834,6 +1971,14 @@ namespace SSD_Components
 			default:
 				PRINT_ERROR("Unknown plane allocation scheme type!")
 		}
+		if (unwritten_reads_on_static_pages) {
+			//The LPAs that map to a plane fill its subpages, pages and blocks in order
+			LPA_type row = lpa / (domain->Channel_no * domain->Chip_no * domain->Die_no * domain->Plane_no);
+			read_address.subPageID = (flash_page_ID_type)(row % ALIGN_UNIT_SIZE);
+			row /= ALIGN_UNIT_SIZE;
+			read_address.PageID = (flash_page_ID_type)(row % pages_no_per_block);
+			read_address.BlockID = (flash_block_ID_type)((row / pages_no_per_block) % block_no_per_plane);
+		}
 
 		//block_manager->Allocate_block_and_page_in_plane_for_user_write(stream_id, read_address);
 		PPA_type ppa = Convert_address_to_ppa(read_address);
@@ -2458,4 +2603,43 @@ namespace SSD_Components
 		}
 		return overfull;
 	}	
+
+	//The user pages of every stream, including the ones that GC moves, are placed on the planes in the given order of their LPAs
+	void Address_Mapping_Unit_Page_Level::Stripe_by_lpa(Flash_Plane_Allocation_Scheme_Type scheme)
+	{
+		if (_my_instance == NULL) {
+			PRINT_ERROR("Stream_striping requires page-level mapping")
+		}
+		for (unsigned int domainID = 0; domainID < _my_instance->no_of_input_streams; domainID++) {
+			_my_instance->domains[domainID]->PlaneAllocationScheme = scheme;
+			_my_instance->domains[domainID]->Striped_by_lpa = true;
+		}
+	}
+
+	//Finds the plane that the reads of an LPA go to, which is the static location of online_create_entry_for_reads if it is not written
+	bool Address_Mapping_Unit_Page_Level::Get_plane_of_lpa(const stream_id_type stream_id, const LPA_type lpa, NVM::FlashMemory::Physical_Page_Address& address)
+	{
+		if (_my_instance == NULL || lpa >= _my_instance->domains[stream_id]->Total_logical_pages_no) {
+			return false;
+		}
+
+		AddressMappingDomain* domain = _my_instance->domains[stream_id];
+		PPA_type ppa = _my_instance->ideal_mapping_table ? NO_PPA : domain->CMT->Peek_ppa(stream_id, lpa);
+		if (ppa == NO_PPA) {
+			ppa = domain->GlobalMappingTable[lpa].PPA;
+		}
+		if (ppa == NO_PPA) {
+			_my_instance->online_create_entry_for_reads(lpa, stream_id, address, 0);
+		} else {
+			_my_instance->Convert_ppa_to_address(ppa, address);
+		}
+
+		return true;
+	}
+
+	//Used by the page register model of the flash chips, which would otherwise serve the unwritten reads of a plane from its first page
+	void Address_Mapping_Unit_Page_Level::Place_unwritten_reads_on_static_pages()
+	{
+		unwritten_reads_on_static_pages = true;
+	}
 }
@@ -2,6 +2,8 @@
 #define ADDRESS_MAPPING_UNIT_PAGE_LEVEL
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <map>
 #include <queue>
 #include <set>
@@ -30,7 +32,7 @@ namespace SSD_Components
 		unsigned long long WrittenStateBitmap;
 		bool Dirty;
 		CMTEntryStatus Status;
-		std::list<std::pair<LPA_type, CMTSlotType*>>::iterator listPtr;//used for fast implementation of LRU
+		bool Referenced;//CLOCK reference bit, used instead of a linked LRU list
 		stream_id_type Stream_id;
 	};
 
@@ -48,6 +50,7 @@ namespace SSD_Components
 		~Cached_Mapping_Table();
 		bool Exists(const stream_id_type streamID, const LPA_type lpa);
 		PPA_type Retrieve_ppa(const stream_id_type streamID, const LPA_type lpa);
+		PPA_type Peek_ppa(const stream_id_type streamID, const LPA_type lpa) const;//Unlike Retrieve_ppa, it does not mark the entry as referenced
 		void Update_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const page_status_type pageWriteState);
 		void Insert_new_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const unsigned long long pageWriteState);
 		page_status_type Get_bitmap_vector_of_written_sectors(const stream_id_type streamID, const LPA_type lpa);
@@ -60,8 +63,23 @@ namespace SSD_Components
 		bool Is_dirty(const stream_id_type streamID, const LPA_type lpa);
 		void Make_clean(const stream_id_type streamID, const LPA_type lpa);
 	private:
-		std::unordered_map<LPA_type, CMTSlotType*> addressMap;
-		std::list<std::pair<LPA_type, CMTSlotType*>> lruList;
+		/*The CMT is an open-addressing hash table (linear probing, backward-shift deletion) that indexes
+		* a flat array of slots. Slots are recycled through a free list and replacement uses the CLOCK
+		* algorithm, so a lookup or an LRU touch never allocates memory or chases list pointers.*/
+		static const unsigned int NO_SLOT = 0xffffffff;
+		unsigned int find_slot(const LPA_type key) const;
+		unsigned int home_bucket(const LPA_type key) const;
+		void insert_into_index(const LPA_type key, const unsigned int slot_id);
+		void remove_from_index(const LPA_type key);
+		void grow_index();
+		std::vector<unsigned int> index;//bucket -> slot id, NO_SLOT means the bucket is empty
+		unsigned int index_mask;
+		unsigned int index_bits;
+		std::vector<CMTSlotType> slots;
+		std::vector<LPA_type> slot_keys;
+		std::vector<unsigned int> free_slots;
+		unsigned int clock_hand;
+		unsigned int occupied_slots;
 		unsigned int capacity;
 	};
 
@@ -104,15 +122,16 @@ namespace SSD_Components
 		std::multimap<LPA_type, NVM_Transaction_Flash*> Waiting_unmapped_read_transactions;
 		std::multimap<LPA_type, NVM_Transaction_Flash*> Waiting_unmapped_program_transactions;
 		std::multimap<MVPN_type, LPA_type> ArrivingMappingEntries;
-		std::set<MVPN_type> DepartingMappingEntries;
-		std::set<LPA_type> Locked_LPAs;//Used to manage race conditions, i.e. a user request accesses and LPA while GC is moving that LPA 
-		std::set<MVPN_type> Locked_MVPNs;//Used to manage race conditions
+		std::unordered_set<MVPN_type> DepartingMappingEntries;
+		std::unordered_set<LPA_type> Locked_LPAs;//Used to manage race conditions, i.e. a user request accesses and LPA while GC is moving that LPA 
+		std::unordered_set<MVPN_type> Locked_MVPNs;//Used to manage race conditions
 		std::multimap<LPA_type, NVM_Transaction_Flash*> Read_transactions_behind_LPA_barrier;
 		std::multimap<LPA_type, NVM_Transaction_Flash*> Write_transactions_behind_LPA_barrier;
-		std::set<MVPN_type> MVPN_read_transactions_waiting_behind_barrier;
-		std::set<MVPN_type> MVPN_write_transaction_waiting_behind_barrier;
+		std::unordered_set<MVPN_type> MVPN_read_transactions_waiting_behind_barrier;
+		std::unordered_set<MVPN_type> MVPN_write_transaction_waiting_behind_barrier;
 
 		Flash_Plane_Allocation_Scheme_Type PlaneAllocationScheme;
+		bool Striped_by_lpa;//The planes of user pages follow their LPAs rather than the order in which they are written
 		flash_channel_ID_type* Channel_ids;
 		unsigned int Channel_no;
 		flash_chip_ID_type* Chip_ids;
@@ -169,8 +188,13 @@ namespace SSD_Components
 		void Remove_barrier_for_accessing_mvpn(stream_id_type stream_id, MVPN_type mpvn);
 		void Start_servicing_writes_for_overfull_plane(const NVM::FlashMemory::Physical_Page_Address plane_address);
 		int Start_servicing_writes_for_overfull();
+
+		static void Stripe_by_lpa(Flash_Plane_Allocation_Scheme_Type scheme);
+		static bool Get_plane_of_lpa(const stream_id_type stream_id, const LPA_type lpa, NVM::FlashMemory::Physical_Page_Address& address);
+		void Place_unwritten_reads_on_static_pages();
 	private:
 		static Address_Mapping_Unit_Page_Level* _my_instance;
+		bool unwritten_reads_on_static_pages;//Otherwise, the reads of the LPAs that are not written go to the first page of their planes
 		unsigned int cmt_capacity;
 		AddressMappingDomain** domains;
 		unsigned int CMT_entry_size, GTD_entry_size;//In CMT MQSim stores (lpn, ppn, page status bits) but in GTD it only stores (ppn, page status bits)
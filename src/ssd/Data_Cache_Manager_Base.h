@@ -8,6 +8,7 @@
 #include "NVM_Firmware.h"
 #include "NVM_PHY_ONFI.h"
 #include "../utils/Workload_Statistics.h"
+#include "../utils/XMLWriter.h"
 
 namespace SSD_Components
 {
@@ -38,6 +39,7 @@ namespace SSD_Components
 		void Set_host_interface(Host_Interface_Base* host_interface);
 		void Set_cxl_host_interface(Host_Interface_Base* host_interface);
 		virtual void Do_warmup(std::vector<Utils::Workload_Statistics*> workload_stats) = 0;
+		virtual void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter) {}
 	protected:
 		static Data_Cache_Manager_Base* _my_instance;
 		Host_Interface_Base* host_interface;
@@ -16,11 +16,12 @@ namespace SSD_Components
 		unsigned int total_capacity_in_bytes,
 		unsigned int dram_row_size, unsigned int dram_data_rate, unsigned int dram_busrt_size, sim_time_type dram_tRCD, sim_time_type dram_tCL, sim_time_type dram_tRP,
 		Caching_Mode* caching_mode_per_input_stream, Cache_Sharing_Mode sharing_mode,unsigned int stream_count,
-		unsigned int sector_no_per_page, unsigned int back_pressure_buffer_max_depth, unsigned int flush_unit_count)
+		unsigned int sector_no_per_page, unsigned int back_pressure_buffer_max_depth, unsigned int flush_unit_count,
+		unsigned int bloom_filter_capacity, double bloom_filter_false_positive_rate, sim_time_type bloom_filter_reset_step)
 		: Data_Cache_Manager_Base(id, host_interface, firmware, dram_row_size, dram_data_rate, dram_busrt_size, dram_tRCD, dram_tCL, dram_tRP, caching_mode_per_input_stream, sharing_mode, stream_count),
 		flash_controller(flash_controller), capacity_in_bytes(total_capacity_in_bytes), sector_no_per_page(sector_no_per_page),	memory_channel_is_busy(false),
 		dram_execution_list_turn(0), back_pressure_buffer_max_depth(back_pressure_buffer_max_depth*3/2),
-		flush_unit_count(flush_unit_count)		
+		bloom_filter_reset_step(bloom_filter_reset_step), flush_unit_count(flush_unit_count)		
 	{
 		capacity_in_pages = capacity_in_bytes / (SECTOR_SIZE_IN_BYTE * sector_no_per_page);
 		switch (sharing_mode)
@@ -58,7 +59,9 @@ namespace SSD_Components
 
 		waiting_writeback_transactions = new std::list<NVM_Transaction*>[stream_count];
 
-		bloom_filter = new std::set<LPA_type>[stream_count];
+		for (unsigned int i = 0; i < stream_count; i++) {
+			bloom_filter.push_back(new Utils::Bloom_Filter(bloom_filter_capacity, bloom_filter_false_positive_rate));
+		}
 	}
 	
 	Data_Cache_Manager_Flash_Advanced::~Data_Cache_Manager_Flash_Advanced()
@@ -96,7 +99,9 @@ namespace SSD_Components
 		delete per_stream_cache;
 		delete[] dram_execution_queue;
 		delete[] waiting_user_requests_queue_for_dram_free_slot;
-		delete[] bloom_filter;
+		for (auto filter : bloom_filter) {
+			delete filter;
+		}
 
 		for (unsigned int i = 0; i < stream_count; i++) {
 			while (waiting_writeback_transactions[i].size())
@@ -334,10 +339,10 @@ namespace SSD_Components
 			dram_write_size_in_sectors += count_sector_no_from_status_bitmap(tr->write_sectors_bitmap);
 
 
-			if (bloom_filter[tr->Stream_id].find(tr->LPA) == bloom_filter[tr->Stream_id].end()) {
+			if (!bloom_filter[tr->Stream_id]->Contains(tr->LPA)) {
 				per_stream_cache[tr->Stream_id]->Change_slot_status_to_writeback(tr->Stream_id, tr->LPA); //Eagerly write back cold data
 				flash_written_back_write_size_in_sectors += count_sector_no_from_status_bitmap(tr->write_sectors_bitmap);
-				bloom_filter[user_request->Stream_id].insert(tr->LPA);
+				bloom_filter[user_request->Stream_id]->Insert(tr->LPA);
 #ifndef WRITE_BUFFERING				
 				writeback_transactions.push_back(tr);
 #else
@@ -418,7 +423,7 @@ namespace SSD_Components
 		
 		//Reset control data structures used for hot/cold separation 
 		if (Simulator->Time() > next_bloom_filter_reset_milestone) {
-			bloom_filter[user_request->Stream_id].clear();
+			bloom_filter[user_request->Stream_id]->Clear();
 			next_bloom_filter_reset_milestone = Simulator->Time() + bloom_filter_reset_step;
 		}
 	}
@@ -691,4 +696,56 @@ namespace SSD_Components
 			}
 		}
 	}
+
+	void Data_Cache_Manager_Flash_Advanced::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
+	{
+		for (unsigned int stream_id = 0; stream_id < stream_count; stream_id++) {
+			Utils::Bloom_Filter* filter = bloom_filter[stream_id];
+			std::string tmp = name_prefix + ".DataCache.Hot_Data_Filter";
+			xmlwriter.Write_start_element_tag(tmp);
+
+			std::string attr = "Stream_ID";
+			std::string val = std::to_string(stream_id);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Memory_Size_In_Bytes";
+			val = std::to_string(filter->Memory_size_in_bytes());
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Hash_Functions";
+			val = std::to_string(filter->Hash_count());
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			//Each lookup reads one 64-byte block of the filter
+			attr = "Lookups";
+			val = std::to_string(filter->STAT_lookup_count);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Lookup_Bytes";
+			val = std::to_string(filter->STAT_lookup_count * 64);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Hot_Lookups";
+			val = std::to_string(filter->STAT_positive_count);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Inserts";
+			val = std::to_string(filter->STAT_insert_count);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Resets";
+			val = std::to_string(filter->STAT_reset_count);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Max_LPAs_Per_Period";
+			val = std::to_string(filter->STAT_max_keys_per_epoch);
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			attr = "Estimated_False_Positive_Rate";
+			val = std::to_string(filter->Estimated_false_positive_rate());
+			xmlwriter.Write_attribute_string_inline(attr, val);
+
+			xmlwriter.Write_end_element_tag();
+		}
+	}
 }
@@ -5,6 +5,7 @@
 #include <queue>
 #include <unordered_map>
 #include "../nvm_chip/flash_memory/FlashTypes.h"
+#include "../utils/Bloom_Filter.h"
 #include "SSD_Defs.h"
 #include "Data_Cache_Manager_Base.h"
 #include "Data_Cache_Flash.h"
@@ -33,11 +34,13 @@ namespace SSD_Components
 			unsigned int total_capacity_in_bytes,
 			unsigned int dram_row_size, unsigned int dram_data_rate, unsigned int dram_busrt_size, sim_time_type dram_tRCD, sim_time_type dram_tCL, sim_time_type dram_tRP,
 			Caching_Mode* caching_mode_per_input_stream, Cache_Sharing_Mode sharing_mode, 
-			unsigned int stream_count, unsigned int sector_no_per_page, unsigned int back_pressure_buffer_max_depth, unsigned int flush_unit_count);
+			unsigned int stream_count, unsigned int sector_no_per_page, unsigned int back_pressure_buffer_max_depth, unsigned int flush_unit_count,
+			unsigned int bloom_filter_capacity, double bloom_filter_false_positive_rate, sim_time_type bloom_filter_reset_step);
 		~Data_Cache_Manager_Flash_Advanced();
 		void Execute_simulator_event(MQSimEngine::Sim_Event* ev);
 		void Setup_triggers();
 		void Do_warmup(std::vector<Utils::Workload_Statistics*> workload_stats);
+		void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
 		unsigned int* back_pressure_buffer_depth;
 	private:
 		NVM_PHY_ONFI * flash_controller;
@@ -56,8 +59,8 @@ namespace SSD_Components
 		int dram_execution_list_turn;
 		unsigned int back_pressure_buffer_max_depth;
 		//unsigned int *back_pressure_buffer_depth;
-		std::set<LPA_type>* bloom_filter;
-		sim_time_type bloom_filter_reset_step = 1000000000;
+		std::vector<Utils::Bloom_Filter*> bloom_filter;//LPAs written by each stream since the last reset, the other LPAs are cold
+		sim_time_type bloom_filter_reset_step;
 		sim_time_type next_bloom_filter_reset_milestone = 0;
 		unsigned int flush_unit_count;
 		static void handle_transaction_serviced_signal_from_PHY(NVM_Transaction_Flash* transaction);
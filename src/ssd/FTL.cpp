@@ -10,6 +10,9 @@
 #include "../utils/Helper_Functions.h"
 #include "FTL.h"
 #include "Stats.h"
+#include "NVM_Transaction_Flash_RD.h"
+#include "NVM_Transaction_Flash_WR.h"
+#include "NVM_Transaction_Flash_ER.h"
 
 namespace SSD_Components
 {
@@ -25,6 +28,9 @@ namespace SSD_Components
 		over_provisioning_ratio(over_provisioning_ratio), max_allowed_block_erase_count(max_allowed_block_erase_count)
 	{
 		Stats::Init_stats(channel_no, chip_no_per_channel, die_no_per_chip, plane_no_per_die, block_no_per_plane, page_no_per_block, max_allowed_block_erase_count, info);
+		NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_RD>::Reset_statistics();
+		NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_WR>::Reset_statistics();
+		NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_ER>::Reset_statistics();
 	}
 
 	FTL::~FTL()
@@ -890,6 +896,22 @@ namespace SSD_Components
 		val = std::to_string(Stats::IssuedSuspendEraseCMD);
 		xmlwriter.Write_attribute_string_inline(attr, val);
 
+		attr = "Issued_Flash_Cache_Read_CMD";
+		val = std::to_string(Stats::IssuedCacheReadCMD);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Pages_Read_With_Cache_Read_CMD";
+		val = std::to_string(Stats::CacheReadPages);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Issued_Flash_Cache_Program_CMD";
+		val = std::to_string(Stats::IssuedCacheProgramCMD);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Pages_Programmed_With_Cache_Program_CMD";
+		val = std::to_string(Stats::CacheProgramPages);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
 		attr = "Issued_Flash_Read_CMD_For_Mapping";
 		val = std::to_string(Stats::Total_flash_reads_for_mapping);
 		xmlwriter.Write_attribute_string_inline(attr, val);
@@ -1049,6 +1071,42 @@ namespace SSD_Components
 		val = std::to_string(Stats::Erase_count);
 		xmlwriter.Write_attribute_string_inline(attr, val);
 
+		attr = "Read_Transaction_Pool_Peak_Live";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_RD>::Peak_live());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Read_Transaction_Pool_Allocations";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_RD>::Allocations());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Read_Transaction_Pool_Capacity";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_RD>::Capacity());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Write_Transaction_Pool_Peak_Live";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_WR>::Peak_live());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Write_Transaction_Pool_Allocations";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_WR>::Allocations());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Write_Transaction_Pool_Capacity";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_WR>::Capacity());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Erase_Transaction_Pool_Peak_Live";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_ER>::Peak_live());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Erase_Transaction_Pool_Allocations";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_ER>::Allocations());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Erase_Transaction_Pool_Capacity";
+		val = std::to_string(NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_ER>::Capacity());
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
 		xmlwriter.Write_end_element_tag();
 	}
 
@@ -11,9 +11,9 @@ namespace SSD_Components
 {
 	Flash_Block_Manager::Flash_Block_Manager(GC_and_WL_Unit_Base* gc_and_wl_unit, unsigned int max_allowed_block_erase_count, unsigned int total_concurrent_streams_no,
 		unsigned int channel_count, unsigned int chip_no_per_channel, unsigned int die_no_per_chip, unsigned int plane_no_per_die,
-		unsigned int block_no_per_plane, unsigned int page_no_per_block)
+		unsigned int block_no_per_plane, unsigned int page_no_per_block, unsigned int placement_handle_no)
 		: Flash_Block_Manager_Base(gc_and_wl_unit, max_allowed_block_erase_count, total_concurrent_streams_no, channel_count, chip_no_per_channel, die_no_per_chip,
-			plane_no_per_die, block_no_per_plane, page_no_per_block)
+			plane_no_per_die, block_no_per_plane, page_no_per_block, placement_handle_no)
 	{
 	}
 
@@ -22,36 +22,37 @@ namespace SSD_Components
 	}
 	
 	//assign PageID & subPageID
-	void Flash_Block_Manager::Allocate_block_and_page_in_plane_for_user_write(const stream_id_type stream_id, NVM::FlashMemory::Physical_Page_Address& page_address)
+	void Flash_Block_Manager::Allocate_block_and_page_in_plane_for_user_write(const stream_id_type stream_id, NVM::FlashMemory::Physical_Page_Address& page_address, placement_id_type placement_id)
 	{
 
 
 		
 		PlaneBookKeepingType* plane_record = &plane_manager[page_address.ChannelID][page_address.ChipID][page_address.DieID][page_address.PlaneID];
-		page_address.BlockID = plane_record->Data_wf[stream_id]->BlockID;
-		//std::cout << "Current_subpage_write_index: " << plane_record->Data_wf[stream_id]->Current_subpage_write_index<< std::endl;
-		page_address.subPageID = plane_record->Data_wf[stream_id]->Current_subpage_write_index++;
-		page_address.PageID = plane_record->Data_wf[stream_id]->Current_page_write_index;
+		Block_Pool_Slot_Type*& write_frontier = user_write_frontier(plane_record, stream_id, placement_id);
+		page_address.BlockID = write_frontier->BlockID;
+		//std::cout << "Current_subpage_write_index: " << write_frontier->Current_subpage_write_index<< std::endl;
+		page_address.subPageID = write_frontier->Current_subpage_write_index++;
+		page_address.PageID = write_frontier->Current_page_write_index;
 		//std::cout << "page_address.subPageID: " << page_address.subPageID << std::endl;
 		plane_record->Valid_subpages_count++;
 		plane_record->Free_subpages_count--;
 
-		if (plane_record->Data_wf[stream_id]->Current_subpage_write_index == ALIGN_UNIT_SIZE) {
-			plane_record->Data_wf[stream_id]->Current_subpage_write_index = 0;
-			plane_record->Data_wf[stream_id]->Current_page_write_index++;
+		if (write_frontier->Current_subpage_write_index == ALIGN_UNIT_SIZE) {
+			write_frontier->Current_subpage_write_index = 0;
+			write_frontier->Current_page_write_index++;
 			plane_record->Valid_pages_count++;
 			plane_record->Free_pages_count--;
 		}
 		else {
-			page_address.PageID = plane_record->Data_wf[stream_id]->Current_page_write_index;
-			//page_address.subPageID = plane_record->Data_wf[stream_id]->Current_subpage_write_index++;
+			page_address.PageID = write_frontier->Current_page_write_index;
+			//page_address.subPageID = write_frontier->Current_subpage_write_index++;
 		}
 		
 
 		program_transaction_issued(page_address);
 
 		//The current write frontier block is written to the end
-		if(plane_record->Data_wf[stream_id]->Current_page_write_index == pages_no_per_block) {
+		if(write_frontier->Current_page_write_index == pages_no_per_block) {
 			bool bRelief = false;
 #ifdef RELIEF_HOST_ACTIVE_BLOCK		
 //			if (Stats::Relief_page_count < Stats::Relief_proportion*Stats::Physical_write_count){
@@ -61,15 +62,15 @@ namespace SSD_Components
 #endif
 			//Assign a new write frontier block
 			if (bRelief == true){
-				plane_record->Data_wf[stream_id] = plane_record->Get_a_free_block(stream_id, false);
+				write_frontier = plane_record->Get_a_free_block(stream_id, false);
 			}
 			else{
-				plane_record->Data_wf[stream_id] = plane_record->Get_a_free_block_b(stream_id, false);
+				write_frontier = plane_record->Get_a_free_block_b(stream_id, false);
 			}
 
 			// need to check quotal.
 			NVM::FlashMemory::Physical_Page_Address new_page_address(page_address);
-			new_page_address.BlockID = plane_record->Data_wf[stream_id]->BlockID;
+			new_page_address.BlockID = write_frontier->BlockID;
 			Set_relief_status(new_page_address, bRelief);
 
 			//gc_and_wl_unit->Check_gc_required(plane_record->Get_free_block_pool_size(), page_address);
@@ -78,7 +79,7 @@ namespace SSD_Components
 			{
 				if ((Stats::Host_alloc % 1000) == 0)
 				{
-					PRINT_MESSAGE("  New Host active : " << plane_record->Data_wf[stream_id]->BlockID << " -- " << Stats::Host_alloc << " stream	  " << stream_id << " max gc write info : " << Stats::Max_consecutive_gc_write << " u: " << Stats::Utilization << " R: " << Stats::Cur_relief_page_count);
+					PRINT_MESSAGE("  New Host active : " << write_frontier->BlockID << " -- " << Stats::Host_alloc << " stream	  " << stream_id << " max gc write info : " << Stats::Max_consecutive_gc_write << " u: " << Stats::Utilization << " R: " << Stats::Cur_relief_page_count);
 				}
 				Stats::Host_alloc++;
 			}
@@ -376,6 +377,8 @@ namespace SSD_Components
 
 		Stats::Block_erase_histogram[block_address.ChannelID][block_address.ChipID][block_address.DieID][block_address.PlaneID][block->Erase_count]--;
 		block->Erase();
+		plane_record->Erase_count_index.Remove(block);
+		plane_record->Erase_count_index.Insert(block, block->Erase_count);
 		Stats::Block_erase_histogram[block_address.ChannelID][block_address.ChipID][block_address.DieID][block_address.PlaneID][block->Erase_count]++;
 		plane_record->Add_to_free_block_pool(block, gc_and_wl_unit->Use_dynamic_wearleveling());
 		//std::cout << "add_to_free_block_pool: " << block_address.ChannelID<<", "<< block_address.ChipID << ", " << block_address.DieID << ", " << block_address.PlaneID << ", " << block_address.BlockID << std::endl;
@@ -1,4 +1,7 @@
 #include "Flash_Block_Manager.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 
 namespace SSD_Components
@@ -7,12 +10,159 @@ namespace SSD_Components
 
 	unsigned int Block_Pool_Slot_Type::SubPage_vector_size = 0;
 
+	const unsigned int Bucketed_Block_Pool::NO_BLOCK;
+
+	static inline unsigned int lowest_set_bit(uint64_t word)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return (unsigned int)index;
+#else
+		return (unsigned int)__builtin_ctzll(word);
+#endif
+	}
+
+	static inline unsigned int highest_set_bit(uint64_t word)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, word);
+		return (unsigned int)index;
+#else
+		return 63 - (unsigned int)__builtin_clzll(word);
+#endif
+	}
+
+	Bucketed_Block_Pool::Bucketed_Block_Pool() : blocks(NULL), bucket_no(0), count(0)
+	{
+	}
+
+	void Bucketed_Block_Pool::Initialize(Block_Pool_Slot_Type* blocks, unsigned int block_no, unsigned int bucket_no)
+	{
+		if (bucket_no == 0) {
+			bucket_no = 1;
+		}
+		this->blocks = blocks;
+		this->bucket_no = bucket_no;
+		count = 0;
+		next.assign(block_no, NO_BLOCK);
+		prev.assign(block_no, NO_BLOCK);
+		bucket_of.assign(block_no, NO_BLOCK);
+		head.assign(bucket_no, NO_BLOCK);
+		tail.assign(bucket_no, NO_BLOCK);
+		bucket_bitmap.assign((bucket_no + 63) / 64, 0);
+		summary_bitmap.assign((bucket_bitmap.size() + 63) / 64, 0);
+	}
+
+	void Bucketed_Block_Pool::Insert(Block_Pool_Slot_Type* block, unsigned int key)
+	{
+		unsigned int id = (unsigned int)(block - blocks);
+		if (bucket_of[id] != NO_BLOCK) {
+			PRINT_ERROR("Inserting block " << block->BlockID << " into a block pool that already contains it!")
+		}
+		unsigned int bucket = key < bucket_no ? key : bucket_no - 1;
+		bucket_of[id] = bucket;
+		next[id] = NO_BLOCK;
+		prev[id] = tail[bucket];
+		if (tail[bucket] == NO_BLOCK) {
+			head[bucket] = id;
+			bucket_bitmap[bucket / 64] |= ((uint64_t)0x1) << (bucket % 64);
+			summary_bitmap[bucket / 4096] |= ((uint64_t)0x1) << ((bucket / 64) % 64);
+		} else {
+			next[tail[bucket]] = id;
+		}
+		tail[bucket] = id;
+		count++;
+	}
+
+	void Bucketed_Block_Pool::Remove(Block_Pool_Slot_Type* block)
+	{
+		unsigned int id = (unsigned int)(block - blocks);
+		unsigned int bucket = bucket_of[id];
+		if (bucket == NO_BLOCK) {
+			PRINT_ERROR("Removing block " << block->BlockID << " from a block pool that does not contain it!")
+		}
+		if (prev[id] == NO_BLOCK) {
+			head[bucket] = next[id];
+		} else {
+			next[prev[id]] = next[id];
+		}
+		if (next[id] == NO_BLOCK) {
+			tail[bucket] = prev[id];
+		} else {
+			prev[next[id]] = prev[id];
+		}
+		if (head[bucket] == NO_BLOCK) {
+			bucket_bitmap[bucket / 64] &= ~(((uint64_t)0x1) << (bucket % 64));
+			if (bucket_bitmap[bucket / 64] == 0) {
+				summary_bitmap[bucket / 4096] &= ~(((uint64_t)0x1) << ((bucket / 64) % 64));
+			}
+		}
+		bucket_of[id] = NO_BLOCK;
+		next[id] = prev[id] = NO_BLOCK;
+		count--;
+	}
+
+	bool Bucketed_Block_Pool::Contains(const Block_Pool_Slot_Type* block) const
+	{
+		return bucket_of[(unsigned int)(block - blocks)] != NO_BLOCK;
+	}
+
+	unsigned int Bucketed_Block_Pool::min_bucket() const
+	{
+		for (unsigned int i = 0; i < summary_bitmap.size(); i++) {
+			if (summary_bitmap[i] != 0) {
+				unsigned int word = i * 64 + lowest_set_bit(summary_bitmap[i]);
+				return word * 64 + lowest_set_bit(bucket_bitmap[word]);
+			}
+		}
+		return NO_BLOCK;
+	}
+
+	unsigned int Bucketed_Block_Pool::max_bucket() const
+	{
+		for (unsigned int i = (unsigned int)summary_bitmap.size(); i > 0; i--) {
+			if (summary_bitmap[i - 1] != 0) {
+				unsigned int word = (i - 1) * 64 + highest_set_bit(summary_bitmap[i - 1]);
+				return word * 64 + highest_set_bit(bucket_bitmap[word]);
+			}
+		}
+		return NO_BLOCK;
+	}
+
+	Block_Pool_Slot_Type* Bucketed_Block_Pool::Front_of_min_bucket() const
+	{
+		if (count == 0) {
+			return NULL;
+		}
+		return &blocks[head[min_bucket()]];
+	}
+
+	Block_Pool_Slot_Type* Bucketed_Block_Pool::Back_of_max_bucket() const
+	{
+		if (count == 0) {
+			return NULL;
+		}
+		return &blocks[tail[max_bucket()]];
+	}
+
+	unsigned int Bucketed_Block_Pool::Min_key() const
+	{
+		return count == 0 ? 0 : min_bucket();
+	}
+
+	unsigned int Bucketed_Block_Pool::Max_key() const
+	{
+		return count == 0 ? 0 : max_bucket();
+	}
+
 	Flash_Block_Manager_Base::Flash_Block_Manager_Base(GC_and_WL_Unit_Base* gc_and_wl_unit, unsigned int max_allowed_block_erase_count, unsigned int total_concurrent_streams_no,
 		unsigned int channel_count, unsigned int chip_no_per_channel, unsigned int die_no_per_chip, unsigned int plane_no_per_die,
-		unsigned int block_no_per_plane, unsigned int page_no_per_block)
+		unsigned int block_no_per_plane, unsigned int page_no_per_block, unsigned int placement_handle_no)
 		: gc_and_wl_unit(gc_and_wl_unit), max_allowed_block_erase_count(max_allowed_block_erase_count), total_concurrent_streams_no(total_concurrent_streams_no),
 		channel_count(channel_count), chip_no_per_channel(chip_no_per_channel), die_no_per_chip(die_no_per_chip), plane_no_per_die(plane_no_per_die),
-		block_no_per_plane(block_no_per_plane), pages_no_per_block(page_no_per_block)
+		block_no_per_plane(block_no_per_plane), pages_no_per_block(page_no_per_block), placement_handle_no(placement_handle_no)
 	{
 		plane_manager = new PlaneBookKeepingType***[channel_count];
 		for (unsigned int channelID = 0; channelID < channel_count; channelID++) {
@@ -35,6 +185,8 @@ namespace SSD_Components
 						plane_manager[channelID][chipID][dieID][planeID].Invalid_subpages_count = 0;
 						plane_manager[channelID][chipID][dieID][planeID].Ongoing_erase_operations.clear();
 						plane_manager[channelID][chipID][dieID][planeID].Blocks = new Block_Pool_Slot_Type[block_no_per_plane];
+						plane_manager[channelID][chipID][dieID][planeID].Free_block_pool.Initialize(plane_manager[channelID][chipID][dieID][planeID].Blocks, block_no_per_plane, max_allowed_block_erase_count);
+						plane_manager[channelID][chipID][dieID][planeID].Erase_count_index.Initialize(plane_manager[channelID][chipID][dieID][planeID].Blocks, block_no_per_plane, max_allowed_block_erase_count);
 						
 						//Initialize block pool for plane
 						for (unsigned int blockID = 0; blockID < block_no_per_plane; blockID++) {
@@ -75,6 +227,7 @@ namespace SSD_Components
 							plane_manager[channelID][chipID][dieID][planeID].Blocks[blockID].Relief_count = 0;
 							plane_manager[channelID][chipID][dieID][planeID].Blocks[blockID].Relief_page_count = 0;							
 							plane_manager[channelID][chipID][dieID][planeID].Add_to_free_block_pool(&plane_manager[channelID][chipID][dieID][planeID].Blocks[blockID], false);
+							plane_manager[channelID][chipID][dieID][planeID].Erase_count_index.Insert(&plane_manager[channelID][chipID][dieID][planeID].Blocks[blockID], 0);
 						}
 						plane_manager[channelID][chipID][dieID][planeID].Data_wf = new Block_Pool_Slot_Type*[total_concurrent_streams_no];
 						plane_manager[channelID][chipID][dieID][planeID].Translation_wf = new Block_Pool_Slot_Type*[total_concurrent_streams_no];
@@ -84,6 +237,12 @@ namespace SSD_Components
 							plane_manager[channelID][chipID][dieID][planeID].Translation_wf[stream_cntr] = plane_manager[channelID][chipID][dieID][planeID].Get_a_free_block(stream_cntr, true);
 							plane_manager[channelID][chipID][dieID][planeID].GC_wf[stream_cntr] = plane_manager[channelID][chipID][dieID][planeID].Get_a_free_block(stream_cntr, false);
 						}
+						plane_manager[channelID][chipID][dieID][planeID].Placement_wf = new Block_Pool_Slot_Type*[(placement_handle_no - 1) * total_concurrent_streams_no + 1];
+						for (unsigned int placement_cntr = 1; placement_cntr < placement_handle_no; placement_cntr++) {
+							for (unsigned int stream_cntr = 0; stream_cntr < total_concurrent_streams_no; stream_cntr++) {
+								plane_manager[channelID][chipID][dieID][planeID].Placement_wf[(placement_cntr - 1) * total_concurrent_streams_no + stream_cntr] = plane_manager[channelID][chipID][dieID][planeID].Get_a_free_block(stream_cntr, false);
+							}
+						}
 					}
 				}
 			}
@@ -108,6 +267,7 @@ namespace SSD_Components
 						delete[] plane_manager[channel_id][chip_id][die_id][plane_id].GC_wf;
 						delete[] plane_manager[channel_id][chip_id][die_id][plane_id].Data_wf;
 						delete[] plane_manager[channel_id][chip_id][die_id][plane_id].Translation_wf;
+						delete[] plane_manager[channel_id][chip_id][die_id][plane_id].Placement_wf;
 					}
 					delete[] plane_manager[channel_id][chip_id][die_id];
 				}
@@ -161,11 +321,11 @@ namespace SSD_Components
 	Block_Pool_Slot_Type* PlaneBookKeepingType::Get_a_free_block(stream_id_type stream_id, bool for_mapping_data)
 	{
 		Block_Pool_Slot_Type* new_block = NULL;
-		new_block = (*Free_block_pool.begin()).second;//Assign a new write frontier block
 		if (Free_block_pool.size() == 0) {
 			PRINT_ERROR("Requesting a free block from an empty pool!")
 		}
-		Free_block_pool.erase(Free_block_pool.begin());
+		new_block = Free_block_pool.Front_of_min_bucket();//Assign a new write frontier block
+		Free_block_pool.Remove(new_block);
 		new_block->Stream_id = stream_id;
 		new_block->Holds_mapping_data = for_mapping_data;
 		Block_usage_history.push(new_block->BlockID);
@@ -176,11 +336,11 @@ namespace SSD_Components
 	Block_Pool_Slot_Type* PlaneBookKeepingType::Get_a_free_block_b(stream_id_type stream_id, bool for_mapping_data)
 	{
 		Block_Pool_Slot_Type* new_block = NULL;
-		new_block = (*Free_block_pool.rbegin()).second;//Assign a new write frontier block
 		if (Free_block_pool.size() == 0) {
 			PRINT_ERROR("Requesting a free block from an empty pool!")
 		}
-		Free_block_pool.erase(std::next(Free_block_pool.rbegin()).base());
+		new_block = Free_block_pool.Back_of_max_bucket();//Assign a new write frontier block
+		Free_block_pool.Remove(new_block);
 		new_block->Stream_id = stream_id;
 		new_block->Holds_mapping_data = for_mapping_data;
 		Block_usage_history.push(new_block->BlockID);
@@ -203,52 +363,31 @@ namespace SSD_Components
 
 	unsigned int PlaneBookKeepingType::Get_free_block_pool_size()
 	{
-		return (unsigned int)Free_block_pool.size();
+		return Free_block_pool.size();
 	}
 
 	void PlaneBookKeepingType::Add_to_free_block_pool(Block_Pool_Slot_Type* block, bool consider_dynamic_wl)
 	{
 		if (consider_dynamic_wl) {
-			//std::pair<unsigned int, Block_Pool_Slot_Type*> entry(block->Erase_count, block);
-			std::pair<unsigned int, Block_Pool_Slot_Type*> entry(block->Relief_count, block);
-			Free_block_pool.insert(entry);
+			//Free_block_pool.Insert(block, block->Erase_count);
+			Free_block_pool.Insert(block, block->Relief_count);
 		} else {
-			std::pair<unsigned int, Block_Pool_Slot_Type*> entry(0, block);
-			Free_block_pool.insert(entry);
+			Free_block_pool.Insert(block, 0);
 		}
 	}
 
 	unsigned int Flash_Block_Manager_Base::Get_min_max_erase_difference(const NVM::FlashMemory::Physical_Page_Address& plane_address)
 	{
-		unsigned int min_erased_block = 0;
-		unsigned int max_erased_block = 0;
 		PlaneBookKeepingType *plane_record = &plane_manager[plane_address.ChannelID][plane_address.ChipID][plane_address.DieID][plane_address.PlaneID];
 
-		for (unsigned int i = 1; i < block_no_per_plane; i++) {
-			if (plane_record->Blocks[i].Erase_count > plane_record->Blocks[max_erased_block].Erase_count) {
-				max_erased_block = i;
-			}
-			if (plane_record->Blocks[i].Erase_count < plane_record->Blocks[min_erased_block].Erase_count) {
-				min_erased_block = i;
-			}
-		}
-
-		//return max_erased_block - min_erased_block;
-		return plane_record->Blocks[max_erased_block].Erase_count - plane_record->Blocks[min_erased_block].Erase_count;
+		return plane_record->Erase_count_index.Max_key() - plane_record->Erase_count_index.Min_key();
 	}
 
 	flash_block_ID_type Flash_Block_Manager_Base::Get_coldest_block_id(const NVM::FlashMemory::Physical_Page_Address& plane_address)
 	{
-		unsigned int min_erased_block = 0;
 		PlaneBookKeepingType *plane_record = &plane_manager[plane_address.ChannelID][plane_address.ChipID][plane_address.DieID][plane_address.PlaneID];
 
-		for (unsigned int i = 1; i < block_no_per_plane; i++) {
-			if (plane_record->Blocks[i].Erase_count < plane_record->Blocks[min_erased_block].Erase_count) {
-				min_erased_block = i;
-			}
-		}
-		
-		return min_erased_block;
+		return plane_record->Erase_count_index.Front_of_min_bucket()->BlockID;
 	}
 
 	PlaneBookKeepingType* Flash_Block_Manager_Base::Get_plane_bookkeeping_entry(const NVM::FlashMemory::Physical_Page_Address& plane_address)
@@ -360,4 +499,32 @@ namespace SSD_Components
 			Stats::Relief_count++;
 		}
 	}
+
+	//Placement ID 0 writes to the default frontier of the stream, and the IDs beyond the last handle share the last one
+	Block_Pool_Slot_Type*& Flash_Block_Manager_Base::user_write_frontier(PlaneBookKeepingType* plane_record, const stream_id_type stream_id, placement_id_type placement_id)
+	{
+		if (placement_id == 0 || placement_handle_no == 1) {
+			return plane_record->Data_wf[stream_id];
+		}
+		if (placement_id >= placement_handle_no) {
+			placement_id = placement_handle_no - 1;
+		}
+		return plane_record->Placement_wf[(placement_id - 1) * total_concurrent_streams_no + stream_id];
+	}
+
+	bool Flash_Block_Manager_Base::Is_write_frontier(const PlaneBookKeepingType* plane_record, const Block_Pool_Slot_Type* block)
+	{
+		for (unsigned int stream_id = 0; stream_id < total_concurrent_streams_no; stream_id++) {
+			if (block == plane_record->Data_wf[stream_id] || block == plane_record->Translation_wf[stream_id] || block == plane_record->GC_wf[stream_id]) {
+				return true;
+			}
+		}
+		for (unsigned int i = 0; i < (placement_handle_no - 1) * total_concurrent_streams_no; i++) {
+			if (block == plane_record->Placement_wf[i]) {
+				return true;
+			}
+		}
+
+		return false;
+	}
 }
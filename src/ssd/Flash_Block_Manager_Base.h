@@ -5,8 +5,10 @@
 #include <cstdint>
 #include <queue>
 #include <set>
+#include <vector>
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "../nvm_chip/flash_memory/Physical_Page_Address.h"
+#include "SSD_Defs.h"
 #include "GC_and_WL_Unit_Base.h"
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 
@@ -60,6 +62,38 @@ namespace SSD_Components
 		void Erase();
 	};
 
+	/*
+	* A pool of the blocks of one plane, bucketed by a small integer key (erase count or relief count).
+	* Each bucket is an intrusive FIFO list threaded through per-block next/prev indexes, and a two-level
+	* bitmap records the non-empty buckets. Insert, remove and min/max key queries are O(1) and never
+	* allocate after Initialize. Keys beyond the last bucket are clamped into it.
+	*/
+	class Bucketed_Block_Pool
+	{
+	public:
+		Bucketed_Block_Pool();
+		void Initialize(Block_Pool_Slot_Type* blocks, unsigned int block_no, unsigned int bucket_no);
+		void Insert(Block_Pool_Slot_Type* block, unsigned int key);//Appends the block to the tail of its bucket
+		void Remove(Block_Pool_Slot_Type* block);
+		bool Contains(const Block_Pool_Slot_Type* block) const;
+		Block_Pool_Slot_Type* Front_of_min_bucket() const;//The oldest block with the smallest key
+		Block_Pool_Slot_Type* Back_of_max_bucket() const;//The youngest block with the largest key
+		unsigned int Min_key() const;
+		unsigned int Max_key() const;
+		unsigned int size() const { return count; }
+	private:
+		static const unsigned int NO_BLOCK = 0xffffffff;
+		Block_Pool_Slot_Type* blocks;
+		std::vector<unsigned int> next, prev, bucket_of;
+		std::vector<unsigned int> head, tail;
+		std::vector<uint64_t> bucket_bitmap;//bit i is set if bucket i is not empty
+		std::vector<uint64_t> summary_bitmap;//bit i is set if bucket_bitmap[i] is not zero
+		unsigned int bucket_no;
+		unsigned int count;
+		unsigned int min_bucket() const;
+		unsigned int max_bucket() const;
+	};
+
 	class PlaneBookKeepingType
 	{
 	public:
@@ -72,9 +106,11 @@ namespace SSD_Components
 		unsigned int Invalid_pages_count;
 		unsigned int Invalid_subpages_count;
 		Block_Pool_Slot_Type* Blocks;
-		std::multimap<unsigned int, Block_Pool_Slot_Type*> Free_block_pool;
+		Bucketed_Block_Pool Free_block_pool;
+		Bucketed_Block_Pool Erase_count_index;//All blocks of the plane bucketed by erase count, used for wear-leveling decisions
 		Block_Pool_Slot_Type** Data_wf, ** GC_wf; //The write frontier blocks for data and GC pages. MQSim adopts Double Write Frontier approach for user and GC writes which is shown very advantages in: B. Van Houdt, "On the necessity of hot and cold data identification to reduce the write amplification in flash - based SSDs", Perf. Eval., 2014
 		Block_Pool_Slot_Type** Translation_wf; //The write frontier blocks for translation GC pages
+		Block_Pool_Slot_Type** Placement_wf; //The write frontier blocks of the placement IDs other than 0 (whose frontiers are Data_wf), indexed by (placement ID - 1) * stream count + stream ID
 		std::queue<flash_block_ID_type> Block_usage_history;//A fifo queue that keeps track of flash blocks based on their usage history
 		std::set<flash_block_ID_type> Ongoing_erase_operations;
 		Block_Pool_Slot_Type* Get_a_free_block(stream_id_type stream_id, bool for_mapping_data);
@@ -92,9 +128,9 @@ namespace SSD_Components
 	public:
 		Flash_Block_Manager_Base(GC_and_WL_Unit_Base* gc_and_wl_unit, unsigned int max_allowed_block_erase_count, unsigned int total_concurrent_streams_no,
 			unsigned int channel_count, unsigned int chip_no_per_channel, unsigned int die_no_per_chip, unsigned int plane_no_per_die,
-			unsigned int block_no_per_plane, unsigned int page_no_per_block);
+			unsigned int block_no_per_plane, unsigned int page_no_per_block, unsigned int placement_handle_no = 1);
 		virtual ~Flash_Block_Manager_Base();
-		virtual void Allocate_block_and_page_in_plane_for_user_write(const stream_id_type streamID, NVM::FlashMemory::Physical_Page_Address& address) = 0;
+		virtual void Allocate_block_and_page_in_plane_for_user_write(const stream_id_type streamID, NVM::FlashMemory::Physical_Page_Address& address, placement_id_type placement_id = 0) = 0;
 		virtual void Allocate_block_and_page_in_plane_for_gc_write(const stream_id_type streamID, NVM::FlashMemory::Physical_Page_Address& address) = 0;
 		virtual void Allocate_block_and_page_in_plane_for_translation_write(const stream_id_type streamID, NVM::FlashMemory::Physical_Page_Address& address, bool is_for_gc) = 0;
 		virtual void Allocate_Pages_in_block_and_invalidate_remaining_for_preconditioning(const stream_id_type stream_id, const NVM::FlashMemory::Physical_Page_Address& plane_address, std::vector<NVM::FlashMemory::Physical_Page_Address>& page_addresses) = 0;
@@ -120,6 +156,8 @@ namespace SSD_Components
 		bool Is_Subpage_valid(Block_Pool_Slot_Type* block, flash_page_ID_type page_id, flash_page_ID_type subpage_id);
 		bool Is_page_bypass(const NVM::FlashMemory::Physical_Page_Address& block_address);
 		void Set_relief_status(const NVM::FlashMemory::Physical_Page_Address& block_address, bool status);
+		bool Is_write_frontier(const PlaneBookKeepingType* plane_record, const Block_Pool_Slot_Type* block);
+		unsigned int Get_placement_handle_count() { return placement_handle_no; }
 
 	protected:
 		PlaneBookKeepingType ****plane_manager;//Keeps track of plane block usage information
@@ -132,6 +170,8 @@ namespace SSD_Components
 		unsigned int plane_no_per_die;
 		unsigned int block_no_per_plane;
 		unsigned int pages_no_per_block;
+		unsigned int placement_handle_no;
+		Block_Pool_Slot_Type*& user_write_frontier(PlaneBookKeepingType* plane_record, const stream_id_type stream_id, placement_id_type placement_id);
 		void program_transaction_issued(const NVM::FlashMemory::Physical_Page_Address& page_address);//Updates the block bookkeeping record
 	};
 }
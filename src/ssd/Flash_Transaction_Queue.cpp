@@ -2,10 +2,16 @@
 
 namespace SSD_Components
 {
-	Flash_Transaction_Queue::Flash_Transaction_Queue() {}
+	Flash_Transaction_Queue::Flash_Transaction_Queue() : free_head(0), count(0)
+	{
+		Queue_Node sentinel = { NULL, 0, 0 };
+		nodes.push_back(sentinel);
+	}
 
-	Flash_Transaction_Queue::Flash_Transaction_Queue(std::string id) : id(id)
+	Flash_Transaction_Queue::Flash_Transaction_Queue(std::string id) : id(id), free_head(0), count(0)
 	{
+		Queue_Node sentinel = { NULL, 0, 0 };
+		nodes.push_back(sentinel);
 	}
 
 	void Flash_Transaction_Queue::Set_id(std::string id)
@@ -13,40 +19,85 @@ namespace SSD_Components
 		this->id = id;
 	}
 
+	unsigned int Flash_Transaction_Queue::allocate_node(NVM_Transaction_Flash* transaction)
+	{
+		unsigned int node = free_head;
+		if (node != 0) {
+			free_head = nodes[node].Next;
+		} else {
+			node = (unsigned int)nodes.size();
+			Queue_Node new_node = { NULL, 0, 0 };
+			nodes.push_back(new_node);
+		}
+		nodes[node].Transaction = transaction;
+
+		return node;
+	}
+
+	inline void Flash_Transaction_Queue::link_before(unsigned int node, unsigned int position)
+	{
+		unsigned int prev = nodes[position].Prev;
+		nodes[node].Prev = prev;
+		nodes[node].Next = position;
+		nodes[prev].Next = node;
+		nodes[position].Prev = node;
+		count++;
+	}
+
+	inline void Flash_Transaction_Queue::unlink_and_release(unsigned int node)
+	{
+		nodes[nodes[node].Prev].Next = nodes[node].Next;
+		nodes[nodes[node].Next].Prev = nodes[node].Prev;
+		nodes[node].Transaction = NULL;
+		nodes[node].Next = free_head;
+		free_head = node;
+		count--;
+	}
+
 	void Flash_Transaction_Queue::push_back(NVM_Transaction_Flash* const& transaction)
 	{
 		RequestQueueProbe.EnqueueRequest(transaction);
-		return list<NVM_Transaction_Flash*>::push_back(transaction);
+		link_before(allocate_node(transaction), 0);
 	}
 
 	void Flash_Transaction_Queue::push_front(NVM_Transaction_Flash* const& transaction)
 	{
 		RequestQueueProbe.EnqueueRequest(transaction);
-		return list<NVM_Transaction_Flash*>::push_front(transaction);
+		link_before(allocate_node(transaction), nodes[0].Next);
 	}
 
-	std::list<NVM_Transaction_Flash*>::iterator Flash_Transaction_Queue::insert(list<NVM_Transaction_Flash*>::iterator position, NVM_Transaction_Flash* const& transaction)
+	Flash_Transaction_Queue::iterator Flash_Transaction_Queue::insert(iterator position, NVM_Transaction_Flash* const& transaction)
 	{
 		RequestQueueProbe.EnqueueRequest(transaction);
-		return list<NVM_Transaction_Flash*>::insert(position, transaction);
+		unsigned int node = allocate_node(transaction);
+		link_before(node, position.node);
+
+		return iterator(this, node);
 	}
 
 	void Flash_Transaction_Queue::remove(NVM_Transaction_Flash* const& transaction)
 	{
 		RequestQueueProbe.DequeueRequest(transaction);
-		return list<NVM_Transaction_Flash*>::remove(transaction);
+		NVM_Transaction_Flash* target = transaction;//transaction may alias a node that is released below
+		for (unsigned int node = nodes[0].Next; node != 0;) {
+			unsigned int next = nodes[node].Next;
+			if (nodes[node].Transaction == target) {
+				unlink_and_release(node);
+			}
+			node = next;
+		}
 	}
 
-	void Flash_Transaction_Queue::remove(std::list<NVM_Transaction_Flash*>::iterator const& itr_pos)
+	void Flash_Transaction_Queue::remove(iterator const& itr_pos)
 	{
-		RequestQueueProbe.DequeueRequest(*itr_pos);
-		list<NVM_Transaction_Flash*>::erase(itr_pos);
+		RequestQueueProbe.DequeueRequest(nodes[itr_pos.node].Transaction);
+		unlink_and_release(itr_pos.node);
 	}
 
 	void Flash_Transaction_Queue::pop_front()
 	{
 		RequestQueueProbe.DequeueRequest(this->front());
-		list<NVM_Transaction_Flash*>::pop_front();
+		unlink_and_release(nodes[0].Next);
 	}
 
 	void Flash_Transaction_Queue::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
@@ -2,29 +2,84 @@
 #define FLASH_TRANSACTION_QUEUE_H
 
 #include <list>
+#include <vector>
 #include <string>
+#include <iterator>
+#include <cstddef>
 #include "NVM_Transaction_Flash.h"
 #include "Queue_Probe.h"
 #include "../sim/Sim_Reporter.h"
 
 namespace SSD_Components
 {
-	class Flash_Transaction_Queue : public std::list<NVM_Transaction_Flash*>, public MQSimEngine::Sim_Reporter
+	/*
+	* A doubly-linked transaction queue whose nodes live in one contiguous, growable slab and are linked
+	* by index instead of by pointer. Released nodes are recycled through a free list, so a queue that has
+	* reached its working depth never allocates again, and scans walk a compact array instead of scattered
+	* list nodes. Iterators are (queue, node index) handles: like std::list iterators, they stay valid
+	* across insertions and removals of other transactions, which FLIN's in-place reordering relies on.
+	* Node 0 is a sentinel, so end() is stable and --begin() == end(), as with std::list.
+	*/
+	class Flash_Transaction_Queue : public MQSimEngine::Sim_Reporter
 	{
+	private:
+		struct Queue_Node
+		{
+			NVM_Transaction_Flash* Transaction;
+			unsigned int Prev;
+			unsigned int Next;
+		};
 	public:
+		class iterator
+		{
+		public:
+			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef NVM_Transaction_Flash* value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef NVM_Transaction_Flash** pointer;
+			typedef NVM_Transaction_Flash*& reference;
+
+			iterator() : queue(NULL), node(0) {}
+			iterator(Flash_Transaction_Queue* queue, unsigned int node) : queue(queue), node(node) {}
+			reference operator*() const { return queue->nodes[node].Transaction; }
+			pointer operator->() const { return &queue->nodes[node].Transaction; }
+			iterator& operator++() { node = queue->nodes[node].Next; return *this; }
+			iterator operator++(int) { iterator tmp(*this); node = queue->nodes[node].Next; return tmp; }
+			iterator& operator--() { node = queue->nodes[node].Prev; return *this; }
+			iterator operator--(int) { iterator tmp(*this); node = queue->nodes[node].Prev; return tmp; }
+			bool operator==(const iterator& other) const { return node == other.node && queue == other.queue; }
+			bool operator!=(const iterator& other) const { return !(*this == other); }
+		private:
+			Flash_Transaction_Queue* queue;
+			unsigned int node;
+			friend class Flash_Transaction_Queue;
+		};
+
 		Flash_Transaction_Queue();
 		Flash_Transaction_Queue(std::string id);
 		void Set_id(std::string id);
 		void push_back(NVM_Transaction_Flash* const&);
 		void push_front(NVM_Transaction_Flash* const&);
-		std::list<NVM_Transaction_Flash*>::iterator insert(list<NVM_Transaction_Flash*>::iterator position, NVM_Transaction_Flash* const& transaction);
+		iterator insert(iterator position, NVM_Transaction_Flash* const& transaction);
 		void remove(NVM_Transaction_Flash* const& transaction);
-		void remove(std::list<NVM_Transaction_Flash*>::iterator const& itr_pos);
+		void remove(iterator const& itr_pos);
 		void pop_front();
+		iterator begin() { return iterator(this, nodes[0].Next); }
+		iterator end() { return iterator(this, 0); }
+		NVM_Transaction_Flash* front() const { return nodes[nodes[0].Next].Transaction; }
+		NVM_Transaction_Flash* back() const { return nodes[nodes[0].Prev].Transaction; }
+		std::size_t size() const { return count; }
+		bool empty() const { return count == 0; }
 		void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
 	private:
 		std::string id;
 		Queue_Probe RequestQueueProbe;
+		std::vector<Queue_Node> nodes;
+		unsigned int free_head;//Head of the free node list, 0 if there is no free node
+		std::size_t count;
+		unsigned int allocate_node(NVM_Transaction_Flash* transaction);
+		void link_before(unsigned int node, unsigned int position);
+		void unlink_and_release(unsigned int node);
 	};
 }
 
@@ -153,7 +153,7 @@ namespace SSD_Components
 				/** break through **/
 				
 			case GCStatus::READ_STATE:
-				if (gc_pending_write_count >= gc_unit_count / 2) {
+				if (gc_pending_write_count >= (gc_unit_count + 1) / 2) {
 					break;
 				}
 
@@ -451,9 +451,7 @@ namespace SSD_Components
 		for (std::list<NVM_Transaction*>::const_iterator itr = waiting_submit_transaction.begin(); itr != waiting_submit_transaction.end(); itr++) {
 			tsu->Submit_transaction(((NVM_Transaction_Flash*)(*itr)));
 		}
-		for (std::list<NVM_Transaction*>::const_iterator itr = waiting_submit_transaction.begin(); itr != waiting_submit_transaction.end(); itr++) {
-			waiting_submit_transaction.pop_front();
-		}
+		waiting_submit_transaction.clear();
 
 		tsu->Schedule();
 
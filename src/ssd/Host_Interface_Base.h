@@ -6,6 +6,7 @@
 #include "../sim/Sim_Reporter.h"
 #include "../host/PCIe_Switch.h"
 #include "../host/PCIe_Message.h"
+#include "../cxl/CXL_Mem_Transaction.h"
 #include "User_Request.h"
 #include "Data_Cache_Manager_Base.h"
 #include "../cxl/DRAM_Model.h"
@@ -126,6 +127,8 @@ namespace SSD_Components
 			}
 			delete message;
 		}
+		//Returns the device cache line (lba) that the transaction maps to
+		virtual LHA_type Consume_cxl_mem_transaction(const Host_Components::CXL_Mem_Transaction& transaction) { return 0; }
 
 		virtual void Update_CXL_DRAM_state(bool rw, uint64_t lba, bool& falsehit){
 		}
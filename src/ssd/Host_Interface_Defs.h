@@ -9,6 +9,8 @@ enum class HostInterface_Types { SATA, NVME };
 #define NVME_FLUSH_OPCODE 0x0000
 #define NVME_WRITE_OPCODE 0x0001
 #define NVME_READ_OPCODE 0x0002
+#define NVME_DTYPE_DATA_PLACEMENT 0x2//Directive type of Flexible Data Placement in bits 23:20 of CDW12, the placement handle is in bits 31:16 of CDW13
+#define NVME_DSM_LATENCY_IDLE 0x1//Access latency hint of the dataset management field in bits 5:4 of CDW13: longer latency is acceptable
 
 #define SATA_WRITE_OPCODE 0x0001
 #define SATA_READ_OPCODE 0x0002
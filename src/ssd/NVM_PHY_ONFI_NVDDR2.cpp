@@ -1,3 +1,4 @@
+#include <iterator>
 #include <stdexcept>
 #include "../sim/Engine.h"
 #include "NVM_PHY_ONFI_NVDDR2.h"
@@ -15,6 +16,7 @@ namespace SSD_Components {
 		WaitingGCRead_TX = new Flash_Transaction_Queue[channel_count];
 		WaitingMappingRead_TX = new Flash_Transaction_Queue[channel_count];
 		WaitingCopybackWrites = new std::list<DieBookKeepingEntry*>[channel_count];
+		WaitingCacheProgramData = new std::list<DieBookKeepingEntry*>[channel_count];
 		bookKeepingTable = new ChipBookKeepingEntry*[channel_count];
 		for (unsigned int channelID = 0; channelID < channel_count; channelID++) {
 			bookKeepingTable[channelID] = new ChipBookKeepingEntry[chip_no_per_channel];
@@ -36,6 +38,8 @@ namespace SSD_Components {
 					bookKeepingTable[channelID][chipID].Die_book_keeping_records[dieID].DieInterleavedTime = INVALID_TIME;
 					bookKeepingTable[channelID][chipID].Die_book_keeping_records[dieID].Expected_finish_time = INVALID_TIME;
 					bookKeepingTable[channelID][chipID].Die_book_keeping_records[dieID].RemainingExecTime = INVALID_TIME;
+					bookKeepingTable[channelID][chipID].Die_book_keeping_records[dieID].Cache_pages_sent = 0;
+					bookKeepingTable[channelID][chipID].Die_book_keeping_records[dieID].Suspension_count = 0;
 				}
 			}
 		}
@@ -101,6 +105,11 @@ namespace SSD_Components {
 		return NVDDR2DataInTransferTime(transaction->Data_and_metadata_size_in_byte, channels[transaction->Address.ChannelID]);
 	}
 
+	const DieBookKeepingEntry* NVM_PHY_ONFI_NVDDR2::Get_die_book_keeping_entry(NVM::FlashMemory::Flash_Chip* chip, flash_die_ID_type die_id)
+	{
+		return &bookKeepingTable[chip->ChannelID][chip->ChipID].Die_book_keeping_records[die_id];
+	}
+
 	NVM_Transaction_Flash* NVM_PHY_ONFI_NVDDR2::Is_chip_busy_with_stream(NVM_Transaction_Flash* transaction)
 	{
 		ChipBookKeepingEntry* chipBKE = &bookKeepingTable[transaction->Address.ChannelID][transaction->Address.ChipID];
@@ -159,9 +168,7 @@ namespace SSD_Components {
 				}
 				targetChip->Suspend(transaction_list.front()->Address.DieID);
 				dieBKE->PrepareSuspend();
-				if (chipBKE->OngoingDieCMDTransfers.size()) {
-					chipBKE->PrepareSuspend();
-				}
+				chipBKE->PrepareSuspend();
 			} else {
 				PRINT_ERROR("Read suspension is not supported!")
 			}
@@ -220,9 +227,17 @@ namespace SSD_Components {
 
 		}
 
+		//The TSU sends the pages of a cache sequence to one plane, and the pages of a multiplane command to different planes
+		bool cache_sequence = transaction_list.size() > 1 && transaction_list.front()->Address.PlaneID == transaction_list.back()->Address.PlaneID;
+		unsigned int command_planes = cache_sequence ? 1 : (unsigned int)transaction_list.size();
 		switch (transaction_list.front()->Type) {
 			case Transaction_Type::READ:
-				if (transaction_list.size() == 1) {
+				if (cache_sequence) {
+					Stats::IssuedCacheReadCMD++;
+					Stats::CacheReadPages += transaction_list.size();
+					dieBKE->ActiveCommand->CommandCode = CMD_READ_PAGE_CACHE_SEQ;
+					DEBUG("Chip " << targetChip->ChannelID << ", " << targetChip->ChipID << ", " << transaction_list.front()->Address.DieID << ": Sending cache read command to chip for LPA: " << transaction_list.front()->LPA)
+				} else if (transaction_list.size() == 1) {
 					Stats::IssuedReadCMD++;
 					dieBKE->ActiveCommand->CommandCode = CMD_READ_PAGE;
 					DEBUG("Chip " << targetChip->ChannelID << ", " << targetChip->ChipID << ", " << transaction_list.front()->Address.DieID << ": Sending read command to chip for LPA: " << transaction_list.front()->LPA)
@@ -234,28 +249,38 @@ namespace SSD_Components {
 
 				for (std::list<NVM_Transaction_Flash*>::iterator it = transaction_list.begin();
 					it != transaction_list.end(); it++) {
-					(*it)->STAT_transfer_time += target_channel->ReadCommandTime[transaction_list.size()];
+					(*it)->STAT_transfer_time += target_channel->ReadCommandTime[command_planes];
 				}
 				if (chipBKE->OngoingDieCMDTransfers.size() == 0) {
 					targetChip->StartCMDXfer();
 					chipBKE->Status = ChipStatus::CMD_IN;
-					chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
-					Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()], this,
+					chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ReadCommandTime[command_planes];
+					Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ReadCommandTime[command_planes], this,
 						dieBKE, (int)NVDDR2_SimEventType::READ_CMD_ADDR_TRANSFERRED);
 				} else {
-					dieBKE->DieInterleavedTime = suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
-					chipBKE->Last_transfer_finish_time += suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
+					dieBKE->DieInterleavedTime = suspendTime + target_channel->ReadCommandTime[command_planes];
+					chipBKE->Last_transfer_finish_time += suspendTime + target_channel->ReadCommandTime[command_planes];
 				}
 				chipBKE->OngoingDieCMDTransfers.push(dieBKE);
 
 				dieBKE->Expected_finish_time = chipBKE->Last_transfer_finish_time + targetChip->Get_command_execution_latency(dieBKE->ActiveCommand->CommandCode, dieBKE->ActiveCommand->Address[0].PageID);
+				if (cache_sequence) {
+					for (unsigned int i = 1; i < dieBKE->ActiveCommand->Address.size(); i++) {
+						dieBKE->Expected_finish_time += targetChip->Get_command_execution_latency(dieBKE->ActiveCommand->CommandCode, dieBKE->ActiveCommand->Address[i].PageID);
+					}
+				}
 				if (chipBKE->Expected_command_exec_finish_time < dieBKE->Expected_finish_time) {
 					chipBKE->Expected_command_exec_finish_time = dieBKE->Expected_finish_time;
 				}
 				break;
 			case Transaction_Type::WRITE:
 				if (((NVM_Transaction_Flash_WR*)transaction_list.front())->ExecutionMode == WriteExecutionModeType::SIMPLE) {
-					if (transaction_list.size() == 1) {
+					if (cache_sequence) {
+						Stats::IssuedCacheProgramCMD++;
+						Stats::CacheProgramPages += transaction_list.size();
+						dieBKE->ActiveCommand->CommandCode = CMD_PROGRAM_PAGE_CACHE;
+						DEBUG("Chip " << targetChip->ChannelID << ", " << targetChip->ChipID << ", " << transaction_list.front()->Address.DieID << ": Sending cache program command to chip for LPA: " << transaction_list.front()->LPA)
+					} else if (transaction_list.size() == 1) {
 						Stats::IssuedProgramCMD++;
 						dieBKE->ActiveCommand->CommandCode = CMD_PROGRAM_PAGE;
 						DEBUG("Chip " << targetChip->ChannelID << ", " << targetChip->ChipID << ", " << transaction_list.front()->Address.DieID << ": Sending program command to chip for LPA: " << transaction_list.front()->LPA)
@@ -269,29 +294,39 @@ namespace SSD_Components {
 
 					for (std::list<NVM_Transaction_Flash*>::iterator it = transaction_list.begin();
 						it != transaction_list.end(); it++) {
-						(*it)->STAT_transfer_time += target_channel->ProgramCommandTime[transaction_list.size()] + NVDDR2DataInTransferTime((*it)->Data_and_metadata_size_in_byte, target_channel);
+						(*it)->STAT_transfer_time += target_channel->ProgramCommandTime[command_planes] + NVDDR2DataInTransferTime((*it)->Data_and_metadata_size_in_byte, target_channel);
 						data_transfer_time += NVDDR2DataInTransferTime((*it)->Data_and_metadata_size_in_byte, target_channel);
+						target_channel->Record_data_transfer((*it)->Data_and_metadata_size_in_byte, NVDDR2DataInTransferTime((*it)->Data_and_metadata_size_in_byte, target_channel), true);
+						if (cache_sequence) {
+							break;//The data of the next pages is transferred while the chip programs the previous ones
+						}
 					}
+					dieBKE->Cache_pages_sent = 1;
 					if (chipBKE->OngoingDieCMDTransfers.size() == 0) {
 
 
 						targetChip->StartCMDDataInXfer();
 						chipBKE->Status = ChipStatus::CMD_DATA_IN;
-						chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time;
+						chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[command_planes] + data_transfer_time;
 
 						if (transaction_list.front()->Source == Transaction_Source_Type::GC_WL) {
 							//std::cout << "[DEBUG GC-Send_command_to_chip()] register GC write " << std::endl;
 						}
 
-						Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time,
+						Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[command_planes] + data_transfer_time,
 							this, dieBKE, (int)NVDDR2_SimEventType::PROGRAM_CMD_ADDR_DATA_TRANSFERRED);
 					} else {
-						dieBKE->DieInterleavedTime = suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time;
-						chipBKE->Last_transfer_finish_time += suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time;
+						dieBKE->DieInterleavedTime = suspendTime + target_channel->ProgramCommandTime[command_planes] + data_transfer_time;
+						chipBKE->Last_transfer_finish_time += suspendTime + target_channel->ProgramCommandTime[command_planes] + data_transfer_time;
 					}
 					chipBKE->OngoingDieCMDTransfers.push(dieBKE);
 
 					dieBKE->Expected_finish_time = chipBKE->Last_transfer_finish_time + targetChip->Get_command_execution_latency(dieBKE->ActiveCommand->CommandCode, dieBKE->ActiveCommand->Address[0].PageID);
+					if (cache_sequence) {
+						for (unsigned int i = 1; i < dieBKE->ActiveCommand->Address.size(); i++) {
+							dieBKE->Expected_finish_time += targetChip->Get_command_execution_latency(dieBKE->ActiveCommand->CommandCode, dieBKE->ActiveCommand->Address[i].PageID);
+						}
+					}
 					if (chipBKE->Expected_command_exec_finish_time < dieBKE->Expected_finish_time) {
 						chipBKE->Expected_command_exec_finish_time = dieBKE->Expected_finish_time;
 					}
@@ -377,7 +412,7 @@ namespace SSD_Components {
 		int idx = 0;
 
 		for (auto& address : command->Address) {
-			if ((address.PlaneID == read_transaction->Address.PlaneID) && (address.subPageID == read_transaction->Address.subPageID)) {
+			if ((address.PlaneID == read_transaction->Address.PlaneID) && (address.BlockID == read_transaction->Address.BlockID) && (address.PageID == read_transaction->Address.PageID) && (address.subPageID == read_transaction->Address.subPageID)) {
 				read_transaction->LPA = command->Meta_data[i].LPA;
 			}
 			i++;
@@ -485,6 +520,8 @@ namespace SSD_Components {
 				dieBKE->ActiveTransfer = NULL;
 				if (dieBKE->ActiveTransactions.size() == 0) {
 					dieBKE->ClearCommand();
+				} else if (dieBKE->ActiveCommand->CommandCode == CMD_READ_PAGE_CACHE_SEQ) {
+					targetChip->Release_cache_register(dieBKE->ActiveCommand->Address[0].DieID);
 				}
 
 				chipBKE->WaitingReadTXCount--;
@@ -495,13 +532,17 @@ namespace SSD_Components {
 						chipBKE->Status = ChipStatus::WAIT_FOR_DATA_OUT;
 					}
 				}
-				if (chipBKE->Status == ChipStatus::IDLE) {
-					if (dieBKE->Suspended) {
-						send_resume_command_to_chip(targetChip, chipBKE);
-					}
+				//The suspended die resumes as soon as the reads that it served are out, while the other dies may still be busy
+				if (dieBKE->Suspended && dieBKE->Free && chipBKE->WaitingReadTXCount == 0) {
+					send_resume_command_to_chip(targetChip, chipBKE);
 				}
 				targetChannel->SetStatus(BusChannelStatus::IDLE, targetChip);
 				break;
+			case NVDDR2_SimEventType::CACHE_PROGRAM_DATA_TRANSFERRED:
+				targetChip->EndCMDDataInXfer(dieBKE->ActiveCommand);
+				chipBKE->Status = ChipStatus::WRITING;
+				targetChannel->SetStatus(BusChannelStatus::IDLE, targetChip);
+				break;
 			default:
 				PRINT_ERROR("Unknown simulation event specified for NVM_PHY_ONFI_NVDDR2!")
 		}
@@ -534,6 +575,13 @@ namespace SSD_Components {
 			WaitingCopybackWrites[channel_id].pop_front();
 			channels[channel_id]->SetStatus(BusChannelStatus::BUSY, targetChip);
 
+			return;
+		} else if (WaitingCacheProgramData[channel_id].size() > 0) {
+			DieBookKeepingEntry* waitingBKE = WaitingCacheProgramData[channel_id].front();
+			WaitingCacheProgramData[channel_id].pop_front();
+			targetChip = channels[channel_id]->Chips[waitingBKE->ActiveTransactions.front()->Address.ChipID];
+			transfer_cache_program_data(targetChip, &bookKeepingTable[channel_id][targetChip->ChipID], waitingBKE);
+
 			return;
 		} else if (WaitingMappingRead_TX[channel_id].size() > 0) {
 			NVM_Transaction_Flash_RD* waitingTR = (NVM_Transaction_Flash_RD*)WaitingMappingRead_TX[channel_id].front();
@@ -605,6 +653,36 @@ namespace SSD_Components {
 				}
 			}
 			break;
+		case CMD_READ_PAGE_CACHE_SEQ:
+		{
+			//The chip announces each page of a cache read sequence once it is in the cache register, and the die stays active until the last one
+			DEBUG("Chip " << chip->ChannelID << ", " << chip->ChipID << ": a page of a cache read command is ready")
+			if (dieBKE->ActiveTransactions.size() == 1) {
+				chipBKE->No_of_active_dies--;
+				if (chipBKE->No_of_active_dies == 0)
+					chipBKE->Status = ChipStatus::WAIT_FOR_DATA_OUT;
+			}
+			NVM_Transaction_Flash* tr = dieBKE->ActiveTransactions.front();
+			chipBKE->WaitingReadTXCount++;
+			if (_my_instance->channels[chip->ChannelID]->GetStatus() == BusChannelStatus::IDLE) {
+				_my_instance->transfer_read_data_from_chip(chipBKE, dieBKE, tr);
+			} else {
+				switch (tr->Source)
+				{
+				case Transaction_Source_Type::CACHE:
+				case Transaction_Source_Type::USERIO:
+					_my_instance->WaitingReadTX[chip->ChannelID].push_back(tr);
+					break;
+				case Transaction_Source_Type::GC_WL:
+					_my_instance->WaitingGCRead_TX[chip->ChannelID].push_back(tr);
+					break;
+				case Transaction_Source_Type::MAPPING:
+					_my_instance->WaitingMappingRead_TX[chip->ChannelID].push_back(tr);
+					break;
+				}
+			}
+			break;
+		}
 		case CMD_READ_PAGE_COPYBACK:
 		case CMD_READ_PAGE_COPYBACK_MULTIPLANE:
 			chipBKE->No_of_active_dies--;
@@ -648,6 +726,17 @@ namespace SSD_Components {
 			}
 			else _my_instance->WaitingCopybackWrites->push_back(dieBKE);
 			break;
+		case CMD_PROGRAM_PAGE_CACHE:
+			//Until the last page is programmed, the ready signal means that the cache register can take the data of the next page
+			if (dieBKE->Cache_pages_sent < dieBKE->ActiveTransactions.size()) {
+				if (_my_instance->channels[chip->ChannelID]->GetStatus() == BusChannelStatus::IDLE) {
+					_my_instance->transfer_cache_program_data(chip, chipBKE, dieBKE);
+				} else {
+					_my_instance->WaitingCacheProgramData[chip->ChannelID].push_back(dieBKE);
+				}
+				break;
+			}
+			//fall through
 		case CMD_PROGRAM_PAGE:
 		case CMD_PROGRAM_PAGE_MULTIPLANE:
 		case CMD_PROGRAM_PAGE_COPYBACK:
@@ -711,9 +800,26 @@ namespace SSD_Components {
 			this, dieBKE, (int)NVDDR2_SimEventType::READ_DATA_TRANSFERRED);
 
 		tr->STAT_transfer_time += NVDDR2DataOutTransferTime(tr->Data_and_metadata_size_in_byte, channels[tr->Address.ChannelID]);
+		channels[tr->Address.ChannelID]->Record_data_transfer(tr->Data_and_metadata_size_in_byte, NVDDR2DataOutTransferTime(tr->Data_and_metadata_size_in_byte, channels[tr->Address.ChannelID]), false);
 		channels[tr->Address.ChannelID]->SetStatus(BusChannelStatus::BUSY, channels[tr->Address.ChannelID]->Chips[tr->Address.ChipID]);
 	}
 
+	void NVM_PHY_ONFI_NVDDR2::transfer_cache_program_data(NVM::FlashMemory::Flash_Chip* chip, ChipBookKeepingEntry* chipBKE, DieBookKeepingEntry* dieBKE)
+	{
+		std::list<NVM_Transaction_Flash*>::iterator it = dieBKE->ActiveTransactions.begin();
+		std::advance(it, dieBKE->Cache_pages_sent);
+		ONFI_Channel_NVDDR2* target_channel = channels[chip->ChannelID];
+		sim_time_type transfer_time = target_channel->ProgramCommandTime[1] + NVDDR2DataInTransferTime((*it)->Data_and_metadata_size_in_byte, target_channel);
+		(*it)->STAT_transfer_time += transfer_time;
+		target_channel->Record_data_transfer((*it)->Data_and_metadata_size_in_byte, transfer_time - target_channel->ProgramCommandTime[1], true);
+		dieBKE->Cache_pages_sent++;
+
+		chip->StartCMDDataInXfer();
+		chipBKE->Status = ChipStatus::CMD_DATA_IN;
+		Simulator->Register_sim_event(Simulator->Time() + transfer_time, this, dieBKE, (int)NVDDR2_SimEventType::CACHE_PROGRAM_DATA_TRANSFERRED);
+		target_channel->SetStatus(BusChannelStatus::BUSY, chip);
+	}
+
 	void NVM_PHY_ONFI_NVDDR2::perform_interleaved_cmd_data_transfer(NVM::FlashMemory::Flash_Chip* chip, DieBookKeepingEntry* bookKeepingEntry)
 	{
 		ONFI_Channel_NVDDR2* target_channel = channels[bookKeepingEntry->ActiveTransactions.front()->Address.ChannelID];
@@ -758,9 +864,16 @@ namespace SSD_Components {
 		//DEBUG2("Chip " << chip->ChannelID << ", " << chip->ChipID << ": resume command " )
 		for (unsigned int i = 0; i < die_no_per_chip; i++) {
 			DieBookKeepingEntry *dieBKE = &chipBKE->Die_book_keeping_records[i];
+			if (!dieBKE->Suspended) {
+				continue;
+			}
 			//Since the time required to send the resume command is very small, MQSim ignores it to simplify the simulation
 			dieBKE->PrepareResume();
 			chipBKE->PrepareResume();
+			chipBKE->No_of_active_dies++;
+			if (chipBKE->Expected_command_exec_finish_time < dieBKE->Expected_finish_time) {
+				chipBKE->Expected_command_exec_finish_time = dieBKE->Expected_finish_time;
+			}
 			chip->Resume(dieBKE->ActiveCommand->Address[0].DieID);
 			switch (dieBKE->ActiveCommand->CommandCode) {
 				case CMD_READ_PAGE:
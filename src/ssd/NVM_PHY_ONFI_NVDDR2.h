@@ -17,7 +17,8 @@ namespace SSD_Components
 		READ_DATA_TRANSFERRED, READ_CMD_ADDR_TRANSFERRED,
 		PROGRAM_CMD_ADDR_DATA_TRANSFERRED, 
 		PROGRAM_COPYBACK_CMD_ADDR_TRANSFERRED, 
-		ERASE_SETUP_COMPLETED
+		ERASE_SETUP_COMPLETED,
+		CACHE_PROGRAM_DATA_TRANSFERRED
 	};
 
 	class DieBookKeepingEntry
@@ -37,6 +38,8 @@ namespace SSD_Components
 		sim_time_type Expected_finish_time;
 		sim_time_type RemainingExecTime;
 		sim_time_type DieInterleavedTime;//If the command transfer is done in die-interleaved mode, the transfer time is recorded in this temporary variable
+		unsigned int Cache_pages_sent;//The pages of a cache program sequence whose data is transferred to the chip so far
+		unsigned int Suspension_count;//The number of times that the program or erase of the die has been suspended so far
 
 		void PrepareSuspend()
 		{
@@ -44,6 +47,7 @@ namespace SSD_Components
 			RemainingExecTime = Expected_finish_time - Simulator->Time();
 			SuspendedTransactions.insert(SuspendedTransactions.begin(), ActiveTransactions.begin(), ActiveTransactions.end());
 			Suspended = true;
+			Suspension_count++;
 			ActiveCommand = NULL;
 			ActiveTransactions.clear();
 			Free = true;
@@ -66,6 +70,9 @@ namespace SSD_Components
 			ActiveCommand = NULL;
 			ActiveTransactions.clear();
 			Free = true;
+			if (!Suspended) {
+				Suspension_count = 0;
+			}
 		}
 	};
 
@@ -81,7 +88,7 @@ namespace SSD_Components
 		unsigned int WaitingReadTXCount;
 		unsigned int No_of_active_dies;
 
-		void PrepareSuspend() { HasSuspend = true; No_of_active_dies = 0; }
+		void PrepareSuspend() { HasSuspend = true; No_of_active_dies--; }
 		void PrepareResume() { HasSuspend = false; }
 	};
 
@@ -105,6 +112,7 @@ namespace SSD_Components
 		sim_time_type Expected_finish_time(NVM::FlashMemory::Flash_Chip* chip);
 		sim_time_type Expected_finish_time(NVM_Transaction_Flash* transaction);
 		sim_time_type Expected_transfer_time(NVM_Transaction_Flash* transaction);
+		const DieBookKeepingEntry* Get_die_book_keeping_entry(NVM::FlashMemory::Flash_Chip* chip, flash_die_ID_type die_id);
 		NVM_Transaction_Flash* Is_chip_busy_with_stream(NVM_Transaction_Flash* transaction);
 		bool Is_chip_busy(NVM_Transaction_Flash* transaction);
 		void Change_memory_status_preconditioning(const NVM::NVM_Memory_Address* address, const void* status_info);
@@ -112,6 +120,7 @@ namespace SSD_Components
 		void transfer_read_data_from_chip(ChipBookKeepingEntry* chipBKE, DieBookKeepingEntry* dieBKE, NVM_Transaction_Flash* tr);
 		void perform_interleaved_cmd_data_transfer(NVM::FlashMemory::Flash_Chip* chip, DieBookKeepingEntry* bookKeepingEntry);
 		void send_resume_command_to_chip(NVM::FlashMemory::Flash_Chip* chip, ChipBookKeepingEntry* chipBKE);
+		void transfer_cache_program_data(NVM::FlashMemory::Flash_Chip* chip, ChipBookKeepingEntry* chipBKE, DieBookKeepingEntry* dieBKE);
 		static void handle_ready_signal_from_chip(NVM::FlashMemory::Flash_Chip* chip, NVM::FlashMemory::Flash_Command* command);
 
 		static NVM_PHY_ONFI_NVDDR2* _my_instance;
@@ -119,6 +128,7 @@ namespace SSD_Components
 		ChipBookKeepingEntry** bookKeepingTable;
 		Flash_Transaction_Queue *WaitingReadTX, *WaitingGCRead_TX, *WaitingMappingRead_TX;
 		std::list<DieBookKeepingEntry*> *WaitingCopybackWrites;
+		std::list<DieBookKeepingEntry*> *WaitingCacheProgramData;
 	};
 }
 
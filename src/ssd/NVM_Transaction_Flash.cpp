@@ -6,13 +6,30 @@ namespace SSD_Components
 	NVM_Transaction_Flash::NVM_Transaction_Flash(Transaction_Source_Type source, Transaction_Type type, stream_id_type stream_id,
 		unsigned int data_size_in_byte, LPA_type lpa, PPA_type ppa, User_Request* user_request) :
 		NVM_Transaction(stream_id, source, type, user_request),
-		Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Physical_address_determined(false), FLIN_Barrier(false)
+		Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Physical_address_determined(false), FLIN_Barrier(false),
+		Priority_class(priority_class_of(source, type, user_request))
 	{
 	}
 	
 	NVM_Transaction_Flash::NVM_Transaction_Flash(Transaction_Source_Type source, Transaction_Type type, stream_id_type stream_id,
 		unsigned int data_size_in_byte, LPA_type lpa, PPA_type ppa, const NVM::FlashMemory::Physical_Page_Address& address, User_Request* user_request) :
-		NVM_Transaction(stream_id, source, type, user_request), Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Address(address), Physical_address_determined(false)
+		NVM_Transaction(stream_id, source, type, user_request), Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Address(address), Physical_address_determined(false),
+		Priority_class(priority_class_of(source, type, user_request))
 	{
 	}
+
+	//Reads of the FTL mapping data are on the path of demand reads, and the writes of the FTL are write-backs of dirty data
+	Transaction_Priority_Class NVM_Transaction_Flash::priority_class_of(Transaction_Source_Type source, Transaction_Type type, User_Request* user_request)
+	{
+		if (source == Transaction_Source_Type::GC_WL || type == Transaction_Type::ERASE) {
+			return Transaction_Priority_Class::GC;
+		}
+		if (type == Transaction_Type::WRITE) {
+			return Transaction_Priority_Class::WRITE_BACK;
+		}
+		if (user_request != NULL && user_request->Latency_tolerant) {
+			return Transaction_Priority_Class::PREFETCH_READ;
+		}
+		return Transaction_Priority_Class::DEMAND_READ;
+	}
 }
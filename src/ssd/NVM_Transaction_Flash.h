@@ -17,6 +17,10 @@ namespace SSD_Components
 {
 	class User_Request;
 
+	//The service classes of the transaction scheduler, from the most urgent to the least urgent one
+	enum class Transaction_Priority_Class { DEMAND_READ = 0, PREFETCH_READ = 1, WRITE_BACK = 2, GC = 3 };
+	const unsigned int TRANSACTION_PRIORITY_CLASS_COUNT = 4;
+
 	class NVM_Transaction_Flash : public NVM_Transaction
 	{
 	public:
@@ -34,7 +38,9 @@ namespace SSD_Components
 		bool Physical_address_determined;
 		sim_time_type Estimated_alone_waiting_time;//Used in scheduling methods, such as FLIN, where fairness and QoS is considered in scheduling
 		bool FLIN_Barrier;//Especially used in queue reordering inf FLIN scheduler
+		Transaction_Priority_Class Priority_class;
 	private:
+		static Transaction_Priority_Class priority_class_of(Transaction_Source_Type source, Transaction_Type type, User_Request* user_request);
 
 	};
 }
@@ -4,6 +4,7 @@
 #include <list>
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "NVM_Transaction_Flash.h"
+#include "NVM_Transaction_Flash_Pool.h"
 #include "NVM_Transaction_Flash_WR.h"
 
 namespace SSD_Components
@@ -12,6 +13,8 @@ namespace SSD_Components
 	{
 	public:
 		NVM_Transaction_Flash_ER(Transaction_Source_Type source, stream_id_type streamID, const NVM::FlashMemory::Physical_Page_Address& address);
+		static void* operator new(std::size_t size) { return NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_ER>::Allocate(size); }
+		static void operator delete(void* object, std::size_t size) { NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_ER>::Release(object, size); }
 		std::list<NVM_Transaction_Flash_WR *> Page_movement_activities;
 	};
 }
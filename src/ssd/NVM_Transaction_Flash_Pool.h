@@ -0,0 +1,98 @@
+#ifndef NVM_TRANSACTION_FLASH_POOL_H
+#define NVM_TRANSACTION_FLASH_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace SSD_Components
+{
+	/*
+	* A typed free-list allocator for flash transactions. NVM_Transaction_Flash_RD/WR/ER route their
+	* class-level operator new/delete here, so every existing "new ... / delete transaction" site in the
+	* host interfaces, the FTL units and the PHY reuses pooled storage instead of going to the heap.
+	* Objects are fully reconstructed on reuse (the constructor runs on recycled storage), storage is
+	* carved from fixed-size chunks and is only given back when the process exits.
+	* The FTL resets and reports the accounting of the pools.
+	*/
+	template <typename T>
+	class NVM_Transaction_Flash_Pool
+	{
+	public:
+		static void* Allocate(std::size_t size)
+		{
+			if (size != sizeof(T)) {//A derived class without its own pool
+				return ::operator new(size);
+			}
+			if (free_list == NULL) {
+				grow();
+			}
+			Free_node* node = free_list;
+			free_list = node->Next;
+			live++;
+			allocations++;
+			if (live > peak_live) {
+				peak_live = live;
+			}
+
+			return node;
+		}
+
+		static void Release(void* object, std::size_t size)
+		{
+			if (object == NULL) {
+				return;
+			}
+			if (size != sizeof(T)) {
+				::operator delete(object);
+				return;
+			}
+			Free_node* node = static_cast<Free_node*>(object);
+			node->Next = free_list;
+			free_list = node;
+			live--;
+		}
+
+		static void Reset_statistics()
+		{
+			allocations = 0;
+			peak_live = live;
+		}
+
+		static unsigned long Live() { return live; }
+		static unsigned long Peak_live() { return peak_live; }
+		static unsigned long Allocations() { return allocations; }
+		static unsigned long Capacity() { return (unsigned long)(chunks.size() * Objects_per_chunk); }
+	private:
+		union Free_node
+		{
+			Free_node* Next;
+			alignas(T) unsigned char Storage[sizeof(T)];
+		};
+		static const std::size_t Objects_per_chunk = 256;
+		static Free_node* free_list;
+		static std::vector<Free_node*> chunks;
+		static unsigned long live;
+		static unsigned long peak_live;
+		static unsigned long allocations;
+
+		static void grow()
+		{
+			Free_node* chunk = static_cast<Free_node*>(::operator new(sizeof(Free_node) * Objects_per_chunk));
+			chunks.push_back(chunk);
+			for (std::size_t i = Objects_per_chunk; i > 0; i--) {
+				chunk[i - 1].Next = free_list;
+				free_list = &chunk[i - 1];
+			}
+		}
+	};
+
+	template <typename T> typename NVM_Transaction_Flash_Pool<T>::Free_node* NVM_Transaction_Flash_Pool<T>::free_list = NULL;
+	template <typename T> std::vector<typename NVM_Transaction_Flash_Pool<T>::Free_node*> NVM_Transaction_Flash_Pool<T>::chunks;
+	template <typename T> unsigned long NVM_Transaction_Flash_Pool<T>::live = 0;
+	template <typename T> unsigned long NVM_Transaction_Flash_Pool<T>::peak_live = 0;
+	template <typename T> unsigned long NVM_Transaction_Flash_Pool<T>::allocations = 0;
+	template <typename T> const std::size_t NVM_Transaction_Flash_Pool<T>::Objects_per_chunk;
+}
+
+#endif // !NVM_TRANSACTION_FLASH_POOL_H
@@ -3,6 +3,7 @@
 
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "NVM_Transaction_Flash.h"
+#include "NVM_Transaction_Flash_Pool.h"
 
 
 namespace SSD_Components
@@ -23,6 +24,8 @@ namespace SSD_Components
 			unsigned int data_size_in_byte, LPA_type lpa, PPA_type ppa,
 			SSD_Components::User_Request* related_user_IO_request, NVM::memory_content_type content,
 			page_status_type read_sectors_bitmap, data_timestamp_type data_timestamp);
+		static void* operator new(std::size_t size) { return NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_RD>::Allocate(size); }
+		static void operator delete(void* object, std::size_t size) { NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_RD>::Release(object, size); }
 		NVM::memory_content_type Content; //The content of this transaction
 		NVM_Transaction_Flash_WR* RelatedWrite;		//Is this read request related to another write request and provides update data (for partial page write)
 
@@ -4,6 +4,7 @@
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "../nvm_chip/NVM_Types.h"
 #include "NVM_Transaction_Flash.h"
+#include "NVM_Transaction_Flash_Pool.h"
 #include "NVM_Transaction_Flash_RD.h"
 #include "NVM_Transaction_Flash_ER.h"
 
@@ -24,6 +25,8 @@ namespace SSD_Components
 		NVM_Transaction_Flash_WR(Transaction_Source_Type source, stream_id_type stream_id,
 			unsigned int data_size_in_byte, LPA_type lpa, SSD_Components::User_Request* user_io_request, NVM::memory_content_type content,
 			page_status_type write_sectors_bitmap, data_timestamp_type data_timestamp);
+		static void* operator new(std::size_t size) { return NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_WR>::Allocate(size); }
+		static void operator delete(void* object, std::size_t size) { NVM_Transaction_Flash_Pool<NVM_Transaction_Flash_WR>::Release(object, size); }
 		NVM::memory_content_type Content; //The content of this transaction
 		NVM_Transaction_Flash_RD* RelatedRead; //If this write request must be preceded by a read (for partial page write), this variable is used to point to the corresponding read request
 		NVM_Transaction_Flash_ER* RelatedErase;
@@ -34,6 +37,7 @@ namespace SSD_Components
 		page_status_type write_sectors_bitmap;
 		data_timestamp_type DataTimeStamp;
 		WriteExecutionModeType ExecutionMode;
+		placement_id_type Placement_id = 0;//Selects the write frontier of a user write in the block manager
 	};
 }
 
@@ -4,7 +4,64 @@
 namespace SSD_Components
 {
 	ONFI_Channel_Base::ONFI_Channel_Base(flash_channel_ID_type channelID, unsigned int chipCount, NVM::FlashMemory::Flash_Chip** flashChips, ONFI_Protocol type)
-		: ChannelID(channelID), status(BusChannelStatus::IDLE), Chips(flashChips), Type(type)
+		: ChannelID(channelID), status(BusChannelStatus::IDLE), Chips(flashChips), Type(type), current_active_chip(NULL),
+		busy_start_time(0), STAT_busy_time(0), STAT_data_transfer_time(0), STAT_data_in_bytes(0), STAT_data_out_bytes(0)
 	{
 	}
+
+	void ONFI_Channel_Base::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
+	{
+		std::string tmp = name_prefix;
+		xmlwriter.Write_start_element_tag(tmp + ".FlashChannels");
+
+		std::string attr = "ID";
+		std::string val = "@" + std::to_string(ChannelID);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Protocol";
+		switch (Type) {
+			case ONFI_Protocol::NVDDR2:
+				val = "NVDDR2";
+				break;
+			case ONFI_Protocol::NVDDR3:
+				val = "NVDDR3";
+				break;
+			case ONFI_Protocol::TOGGLE:
+				val = "TOGGLE";
+				break;
+		}
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		double total_time = double(Simulator->Time());
+		attr = "Fraction_of_Time_Busy";//Command, address and data cycles
+		val = std::to_string(total_time == 0 ? 0 : STAT_busy_time / total_time);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Fraction_of_Time_in_DataXfer";
+		val = std::to_string(total_time == 0 ? 0 : STAT_data_transfer_time / total_time);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Data_In_Bytes";
+		val = std::to_string(STAT_data_in_bytes);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Data_Out_Bytes";
+		val = std::to_string(STAT_data_out_bytes);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		//Bytes per nanosecond is GB/s
+		attr = "Data_In_Bandwidth_MBps";
+		val = std::to_string(total_time == 0 ? 0 : STAT_data_in_bytes * 1000 / total_time);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Data_Out_Bandwidth_MBps";
+		val = std::to_string(total_time == 0 ? 0 : STAT_data_out_bytes * 1000 / total_time);
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		attr = "Bandwidth_while_in_DataXfer_MBps";
+		val = std::to_string(STAT_data_transfer_time == 0 ? 0 : (STAT_data_in_bytes + STAT_data_out_bytes) * 1000 / double(STAT_data_transfer_time));
+		xmlwriter.Write_attribute_string_inline(attr, val);
+
+		xmlwriter.Write_end_element_tag();
+	}
 }
@@ -2,12 +2,13 @@
 #define ONFI_CHANNEL_BASE_H
 
 #include "../nvm_chip/flash_memory/Flash_Chip.h"
+#include "../sim/Sim_Reporter.h"
 #include "NVM_Channel_Base.h"
 
 namespace SSD_Components
 {
-	enum class ONFI_Protocol {NVDDR2};
-	class ONFI_Channel_Base : public NVM_Channel_Base
+	enum class ONFI_Protocol {NVDDR2, NVDDR3, TOGGLE};
+	class ONFI_Channel_Base : public NVM_Channel_Base, public MQSimEngine::Sim_Reporter
 	{
 	public:
 		ONFI_Channel_Base(flash_channel_ID_type channelID, unsigned int chipCount, NVM::FlashMemory::Flash_Chip** flashChips, ONFI_Protocol type);
@@ -28,6 +29,11 @@ namespace SSD_Components
 				PRINT_ERROR("Bus " << ChannelID << ": illegal bus status transition!")
 			}
 
+			if (status == BusChannelStatus::IDLE && new_status == BusChannelStatus::BUSY) {
+				busy_start_time = Simulator->Time();
+			} else if (status == BusChannelStatus::BUSY && new_status == BusChannelStatus::IDLE) {
+				STAT_busy_time += Simulator->Time() - busy_start_time;
+			}
 			status = new_status;
 			if (status == BusChannelStatus::BUSY) {
 				current_active_chip = target_chip;
@@ -35,9 +41,24 @@ namespace SSD_Components
 				current_active_chip = NULL;
 			}
 		}
+
+		//Data_in is the direction from the controller to the chips
+		void Record_data_transfer(unsigned int size_in_bytes, sim_time_type transfer_time, bool data_in)
+		{
+			if (data_in) {
+				STAT_data_in_bytes += size_in_bytes;
+			} else {
+				STAT_data_out_bytes += size_in_bytes;
+			}
+			STAT_data_transfer_time += transfer_time;
+		}
+		void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
 	private:
 		BusChannelStatus status;
 		NVM::FlashMemory::Flash_Chip* current_active_chip;
+		sim_time_type busy_start_time;
+		sim_time_type STAT_busy_time, STAT_data_transfer_time;
+		uint64_t STAT_data_in_bytes, STAT_data_out_bytes;
 	};
 }
 
@@ -0,0 +1,41 @@
+#include "ONFI_Channel_HighSpeed.h"
+
+namespace SSD_Components
+{
+	ONFI_Channel_HighSpeed::ONFI_Channel_HighSpeed(flash_channel_ID_type channelID, unsigned int chipCount, NVM::FlashMemory::Flash_Chip** flashChips, unsigned int ChannelWidth,
+		unsigned int transferRate, ONFI_Protocol type)
+		: ONFI_Channel_NVDDR2(channelID, chipCount, flashChips, ChannelWidth,
+			(sim_time_type)((2000 + transferRate - 1) / transferRate), (sim_time_type)((2000 + transferRate - 1) / transferRate),
+			timing_of(type).t_DBSY, timing_of(type).t_CS, timing_of(type).t_RR,
+			timing_of(type).t_WB, timing_of(type).t_WC, timing_of(type).t_ADL, timing_of(type).t_CALS,
+			timing_of(type).t_DQSRE, timing_of(type).t_RPRE, timing_of(type).t_RHW, timing_of(type).t_CCS,
+			timing_of(type).t_WPST, timing_of(type).t_WPSTH, type),
+		transfer_rate(transferRate), t_WPRE(timing_of(type).t_WPRE), t_RPST(timing_of(type).t_RPST)
+	{
+	}
+
+	//Minimum values of the ONFI 4.2 (NV-DDR3) and Toggle DDR 4.0 data sheets, in ns
+	const ONFI_Channel_HighSpeed::Interface_timing& ONFI_Channel_HighSpeed::timing_of(ONFI_Protocol type)
+	{
+		//t_DBSY, t_CS, t_RR, t_WB, t_WC, t_ADL, t_CALS, t_DQSRE, t_RPRE, t_RHW, t_CCS, t_WPST, t_WPSTH, t_WPRE, t_RPST
+		static const Interface_timing nvddr3 = { 500, 20, 20, 100, 25, 150, 15, 15, 15, 100, 300, 6, 15, 15, 6 };
+		static const Interface_timing toggle = { 500, 20, 20, 100, 25, 300, 15, 15, 25, 100, 300, 6, 15, 25, 6 };
+		return type == ONFI_Protocol::TOGGLE ? toggle : nvddr3;
+	}
+
+	inline sim_time_type ONFI_Channel_HighSpeed::burst_time(unsigned int size_in_bytes)
+	{
+		uint64_t cycles = (size_in_bytes + ChannelWidth - 1) / ChannelWidth;
+		return (sim_time_type)((cycles * 1000000 / transfer_rate + 999) / 1000);
+	}
+
+	sim_time_type ONFI_Channel_HighSpeed::DataInTransferTime(unsigned int size_in_bytes)
+	{
+		return t_WPRE + burst_time(size_in_bytes) + t_WPST;
+	}
+
+	sim_time_type ONFI_Channel_HighSpeed::DataOutTransferTime(unsigned int size_in_bytes)
+	{
+		return t_RPRE + burst_time(size_in_bytes) + t_RPST;
+	}
+}
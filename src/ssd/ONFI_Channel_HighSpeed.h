@@ -0,0 +1,35 @@
+#ifndef ONFI_CHANNEL_HIGHSPEED_H
+#define ONFI_CHANNEL_HIGHSPEED_H
+
+#include "ONFI_Channel_NVDDR2.h"
+
+namespace SSD_Components
+{
+	/*
+	* NV-DDR3 and Toggle DDR 4.0+ channels. They keep the command and address cycles of NV-DDR2, which NVM_PHY_ONFI_NVDDR2
+	* drives unchanged, but their data cycles are shorter than a nanosecond at 1.6-2.4 GT/s. The data transfer time is
+	* therefore computed in picoseconds and rounded up once per burst, and includes the preamble and postamble of DQS,
+	* which are no longer negligible against the burst itself.
+	*/
+	class ONFI_Channel_HighSpeed : public ONFI_Channel_NVDDR2
+	{
+	public:
+		ONFI_Channel_HighSpeed(flash_channel_ID_type channelID, unsigned int chipCount, NVM::FlashMemory::Flash_Chip** flashChips, unsigned int ChannelWidth,
+			unsigned int transferRate, ONFI_Protocol type);
+		sim_time_type DataInTransferTime(unsigned int size_in_bytes);
+		sim_time_type DataOutTransferTime(unsigned int size_in_bytes);
+	private:
+		struct Interface_timing
+		{
+			sim_time_type t_DBSY, t_CS, t_RR, t_WB, t_WC, t_ADL, t_CALS, t_DQSRE, t_RPRE, t_RHW, t_CCS, t_WPST, t_WPSTH;
+			sim_time_type t_WPRE; //DQS write preamble
+			sim_time_type t_RPST; //DQS read postamble
+		};
+		static const Interface_timing& timing_of(ONFI_Protocol type);
+		unsigned int transfer_rate; //MT/s
+		sim_time_type t_WPRE, t_RPST;
+		sim_time_type burst_time(unsigned int size_in_bytes);
+	};
+}
+
+#endif // !ONFI_CHANNEL_HIGHSPEED_H
@@ -7,8 +7,8 @@ namespace SSD_Components
 		sim_time_type t_DBSY, sim_time_type t_CS, sim_time_type t_RR,
 		sim_time_type t_WB, sim_time_type t_WC, sim_time_type t_ADL, sim_time_type t_CALS,
 		sim_time_type t_DQSRE, sim_time_type t_RPRE, sim_time_type t_RHW, sim_time_type t_CCS,
-		sim_time_type t_WPST, sim_time_type t_WPSTH)
-		: ONFI_Channel_Base(channelID, chipCount, flashChips, ONFI_Protocol::NVDDR2),
+		sim_time_type t_WPST, sim_time_type t_WPSTH, ONFI_Protocol type)
+		: ONFI_Channel_Base(channelID, chipCount, flashChips, type),
 		ChannelWidth(ChannelWidth),
 		t_RC(t_RC), t_DSC(t_DSC), t_DBSY(t_DBSY), t_CS(t_CS), t_RR(t_RR), t_WB(t_WB), t_WC(t_WC), t_ADL(t_ADL),
 		t_CALS(t_CALS), t_DQSRE(t_DQSRE), t_RPRE(t_RPRE), t_RHW(t_RHW), t_CCS(t_CCS), t_WPST(t_WPST), t_WPSTH(t_WPSTH)
@@ -5,8 +5,8 @@
 #include "ONFI_Channel_Base.h"
 
 
-#define NVDDR2DataInTransferTime(X,Y) ((X / Y->ChannelWidth / 2) * Y->TwoUnitDataInTime)
-#define NVDDR2DataOutTransferTime(X,Y) ((X / Y->ChannelWidth / 2) * Y->TwoUnitDataOutTime)
+#define NVDDR2DataInTransferTime(X,Y) (Y->DataInTransferTime(X))
+#define NVDDR2DataOutTransferTime(X,Y) (Y->DataOutTransferTime(X))
 
 
 namespace SSD_Components
@@ -19,7 +19,16 @@ namespace SSD_Components
 			sim_time_type t_DBSY = 500, sim_time_type t_CS = 20, sim_time_type t_RR = 20,
 			sim_time_type t_WB = 100, sim_time_type t_WC = 25, sim_time_type t_ADL = 70, sim_time_type t_CALS = 15,
 			sim_time_type t_DQSRE = 15, sim_time_type t_RPRE = 15, sim_time_type t_RHW = 100, sim_time_type t_CCS = 300,
-			sim_time_type t_WPST = 6, sim_time_type t_WPSTH = 15);
+			sim_time_type t_WPST = 6, sim_time_type t_WPSTH = 15, ONFI_Protocol type = ONFI_Protocol::NVDDR2);
+		virtual ~ONFI_Channel_NVDDR2() {}
+		virtual sim_time_type DataInTransferTime(unsigned int size_in_bytes)
+		{
+			return (size_in_bytes / ChannelWidth / 2) * TwoUnitDataInTime;
+		}
+		virtual sim_time_type DataOutTransferTime(unsigned int size_in_bytes)
+		{
+			return (size_in_bytes / ChannelWidth / 2) * TwoUnitDataOutTime;
+		}
 
 
 		sim_time_type TwoUnitDataOutTime; //The DDR delay for two-unit device data out
@@ -34,7 +43,7 @@ namespace SSD_Components
 		sim_time_type EraseSuspendCommandTime;
 
 		unsigned int ChannelWidth; //channel width in bytes
-	private:
+	protected:
 		//Data input/ouput timing parameters related to bus frequency
 		sim_time_type t_RC; //Average RE cycle time, e.g. 6ns
 		sim_time_type t_DSC; //Average DQS cycle time, e.g. 6ns
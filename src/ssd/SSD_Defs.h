@@ -13,8 +13,10 @@ typedef uint64_t LHA_type;//Logical Host Address, the addresses unit on the host
 typedef uint64_t PDA_type;//Physical device address, could be a 1) sector, 2) subpage, or a 3) cacheline
 typedef std::string io_request_id_type;
 typedef uint64_t data_cache_content_type;
+typedef uint16_t placement_id_type;//Selects one of the user write frontiers of a stream, like the placement handles of NVMe Flexible Data Placement
 #define SECTOR_SIZE_IN_BYTE 512
 #define MAX_SUPPORT_STREAMS 256 //this value shouldn't be increased as some other parameters are set based on the maximum number of 256
+#define MAX_PLACEMENT_HANDLES 16
 
 /* Since MQSim supports shared resources, such as DataCache and CMT,
 * it needs to make the keys (i.e., LPNs) to access these resources
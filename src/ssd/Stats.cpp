@@ -20,6 +20,10 @@ namespace SSD_Components
 	unsigned long Stats::IssuedMultiplaneEraseCMD = 0;
 	unsigned long Stats::IssuedInterleaveMultiplaneEraseCMD = 0;
 	unsigned long Stats::IssuedSuspendEraseCMD = 0;
+	unsigned long Stats::IssuedCacheReadCMD = 0;
+	unsigned long Stats::IssuedCacheProgramCMD = 0;
+	unsigned long Stats::CacheReadPages = 0;
+	unsigned long Stats::CacheProgramPages = 0;
 	unsigned long Stats::Total_flash_reads_for_mapping = 0;
 	unsigned long Stats::Total_flash_writes_for_mapping = 0;
 	unsigned long Stats::Total_flash_reads_for_mapping_per_stream[MAX_SUPPORT_STREAMS] = { 0 };
@@ -106,6 +110,7 @@ namespace SSD_Components
 		IssuedProgramCMD = 0; IssuedInterleaveProgramCMD = 0; IssuedMultiplaneProgramCMD = 0; IssuedMultiplaneCopybackProgramCMD = 0; IssuedInterleaveMultiplaneProgramCMD = 0; IssuedSuspendProgramCMD = 0; IssuedCopybackProgramCMD = 0;
 		IssuedEraseCMD = 0; IssuedInterleaveEraseCMD = 0; IssuedMultiplaneEraseCMD = 0; IssuedInterleaveMultiplaneEraseCMD = 0;
 		IssuedSuspendEraseCMD = 0;
+		IssuedCacheReadCMD = 0; IssuedCacheProgramCMD = 0; CacheReadPages = 0; CacheProgramPages = 0;
 		Total_flash_reads_for_mapping = 0; Total_flash_writes_for_mapping = 0; 
 		CMT_hits = 0; readTR_CMT_hits = 0; writeTR_CMT_hits = 0;
 		CMT_miss = 0; readTR_CMT_miss = 0; writeTR_CMT_miss = 0;
@@ -17,6 +17,7 @@ namespace SSD_Components
 		static unsigned long IssuedEraseCMD, IssuedInterleaveEraseCMD, IssuedMultiplaneEraseCMD, IssuedInterleaveMultiplaneEraseCMD;
 
 		static unsigned long IssuedSuspendProgramCMD, IssuedSuspendEraseCMD;
+		static unsigned long IssuedCacheReadCMD, IssuedCacheProgramCMD, CacheReadPages, CacheProgramPages;
 
 		static unsigned long Total_flash_reads_for_mapping, Total_flash_writes_for_mapping;
 		static unsigned long Total_flash_reads_for_mapping_per_stream[MAX_SUPPORT_STREAMS], Total_flash_writes_for_mapping_per_stream[MAX_SUPPORT_STREAMS];
@@ -84,4 +84,18 @@ namespace SSD_Components
 	void TSU_Base::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
 	{
 	}
+
+	bool TSU_Base::Promote_prefetch_read(NVM_Transaction_Flash* transaction)
+	{
+		if (_my_instance != NULL && transaction->Priority_class == Transaction_Priority_Class::PREFETCH_READ) {
+			return _my_instance->promote_prefetch_read(transaction);
+		}
+		return false;
+	}
+
+	bool TSU_Base::promote_prefetch_read(NVM_Transaction_Flash* transaction)
+	{
+		transaction->Priority_class = Transaction_Priority_Class::DEMAND_READ;
+		return false;
+	}
 }
@@ -13,6 +13,7 @@
 namespace SSD_Components
 {
 	enum class Flash_Scheduling_Type {OUT_OF_ORDER, FLIN};
+	enum class Flash_Priority_Scheduling_Type {NONE, STRICT, WEIGHTED};//How the transactions of different priority classes share a chip
 	class FTL;
 	class TSU_Base : public MQSimEngine::Sim_Object
 	{
@@ -48,6 +49,10 @@ namespace SSD_Components
 		*/
 		virtual void Schedule() = 0;
 		virtual void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
+
+		/*Turns a prefetch read into a demand read, when a demand access starts waiting for the data of the prefetch.
+		* If the transaction is still queued, it is moved to the demand reads and true is returned.*/
+		static bool Promote_prefetch_read(NVM_Transaction_Flash* transaction);
 	protected:
 		FTL* ftl;
 		NVM_PHY_ONFI_NVDDR2* _NVMController;
@@ -71,6 +76,7 @@ namespace SSD_Components
 		static void handle_transaction_serviced_signal_from_PHY(NVM_Transaction_Flash* transaction);
 		static void handle_channel_idle_signal(flash_channel_ID_type);
 		static void handle_chip_idle_signal(NVM::FlashMemory::Flash_Chip* chip);
+		virtual bool promote_prefetch_read(NVM_Transaction_Flash* transaction);
 
 		int opened_scheduling_reqs;
 	};
@@ -331,9 +331,9 @@ namespace SSD_Components
 		}
 	}
 
-	void TSU_FLIN::reorder_for_fairness(Flash_Transaction_Queue* queue, std::list<NVM_Transaction_Flash*>::iterator start, std::list<NVM_Transaction_Flash*>::iterator end)
+	void TSU_FLIN::reorder_for_fairness(Flash_Transaction_Queue* queue, Flash_Transaction_Queue::iterator start, Flash_Transaction_Queue::iterator end)
 	{
-		std::list<NVM_Transaction_Flash*>::iterator itr = queue->begin();
+		Flash_Transaction_Queue::iterator itr = queue->begin();
 		sim_time_type time_to_finish = 0;
 		if(_NVMController->Is_chip_busy(*itr))
 			if (_NVMController->Expected_finish_time(*itr) > Simulator->Time())
@@ -432,7 +432,7 @@ namespace SSD_Components
 		}
 	}
 
-	void TSU_FLIN::estimate_alone_waiting_time(Flash_Transaction_Queue* queue, std::list<NVM_Transaction_Flash*>::iterator position)
+	void TSU_FLIN::estimate_alone_waiting_time(Flash_Transaction_Queue* queue, Flash_Transaction_Queue::iterator position)
 	{
 		auto itr = position;
 		itr++;
@@ -497,7 +497,7 @@ namespace SSD_Components
 		return (double)slowdown_min / slowdown_max;
 	}
 
-	void TSU_FLIN::move_forward(Flash_Transaction_Queue* queue, std::list<NVM_Transaction_Flash*>::iterator TRnew_pos, std::list<NVM_Transaction_Flash*>::iterator ultimate_posistion)
+	void TSU_FLIN::move_forward(Flash_Transaction_Queue* queue, Flash_Transaction_Queue::iterator TRnew_pos, Flash_Transaction_Queue::iterator ultimate_posistion)
 	{
 		auto Tnew_final_pos = TRnew_pos;
 		Tnew_final_pos--;
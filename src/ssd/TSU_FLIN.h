@@ -63,8 +63,8 @@ namespace SSD_Components
 		unsigned int no_of_priority_classes;
 		double F_thr;//Fairness threshold for high intensity flows, as described in Alg 1 of the FLIN paper
 		std::set<stream_id_type> ***low_intensity_class_read, *** low_intensity_class_write;//As described in Alg 1 of the FLIN paper
-		std::list<NVM_Transaction_Flash*>::iterator*** head_high_read;//Due to programming limitations, for read queues, MQSim keeps Head_high instread of Tail_low which is described in Alg 1 of the FLIN paper
-		std::list<NVM_Transaction_Flash*>::iterator*** head_high_write;//Due to programming limitations, for write queues, MQSim keeps Head_high instread of Tail_low which is described in Alg 1 of the FLIN paper
+		Flash_Transaction_Queue::iterator*** head_high_read;//Due to programming limitations, for read queues, MQSim keeps Head_high instread of Tail_low which is described in Alg 1 of the FLIN paper
+		Flash_Transaction_Queue::iterator*** head_high_write;//Due to programming limitations, for write queues, MQSim keeps Head_high instread of Tail_low which is described in Alg 1 of the FLIN paper
 		Flash_Transaction_Queue*** UserReadTRQueue;
 		NVM_Transaction_Flash_RD**** Read_slot;
 		Flash_Transaction_Queue*** UserWriteTRQueue;
@@ -75,10 +75,10 @@ namespace SSD_Components
 		Flash_Transaction_Queue** MappingReadTRQueue;
 		Flash_Transaction_Queue** MappingWriteTRQueue;
 
-		void reorder_for_fairness(Flash_Transaction_Queue* queue, std::list<NVM_Transaction_Flash*>::iterator start, std::list<NVM_Transaction_Flash*>::iterator end);
-		void estimate_alone_waiting_time(Flash_Transaction_Queue* queue, std::list<NVM_Transaction_Flash*>::iterator position);
+		void reorder_for_fairness(Flash_Transaction_Queue* queue, Flash_Transaction_Queue::iterator start, Flash_Transaction_Queue::iterator end);
+		void estimate_alone_waiting_time(Flash_Transaction_Queue* queue, Flash_Transaction_Queue::iterator position);
 		double fairness_based_on_average_slowdown(unsigned int channel_id, unsigned int chip_id, unsigned int priority_class, bool is_read, stream_id_type& flow_with_max_average_slowdown);
-		void move_forward(Flash_Transaction_Queue* queue, std::list<NVM_Transaction_Flash*>::iterator TRnew_pos, std::list<NVM_Transaction_Flash*>::iterator ultimate_posistion);
+		void move_forward(Flash_Transaction_Queue* queue, Flash_Transaction_Queue::iterator TRnew_pos, Flash_Transaction_Queue::iterator ultimate_posistion);
 		bool service_read_transaction(NVM::FlashMemory::Flash_Chip* chip);
 		bool service_write_transaction(NVM::FlashMemory::Flash_Chip* chip);
 		bool service_erase_transaction(NVM::FlashMemory::Flash_Chip* chip);
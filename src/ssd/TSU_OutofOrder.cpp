@@ -1,4 +1,5 @@
 #include "TSU_OutofOrder.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -15,15 +16,31 @@ namespace SSD_Components
 {
 
 	TSU_OutOfOrder::TSU_OutOfOrder(const sim_object_id_type& id, FTL* ftl, NVM_PHY_ONFI_NVDDR2* NVMController, unsigned int ChannelCount, unsigned int chip_no_per_channel,
-		unsigned int DieNoPerChip, unsigned int PlaneNoPerDie,
+		unsigned int DieNoPerChip, unsigned int PlaneNoPerDie, unsigned int FlashPageSize,
 		sim_time_type WriteReasonableSuspensionTimeForRead,
 		sim_time_type EraseReasonableSuspensionTimeForRead,
 		sim_time_type EraseReasonableSuspensionTimeForWrite, 
-		bool EraseSuspensionEnabled, bool ProgramSuspensionEnabled)
+		bool EraseSuspensionEnabled, bool ProgramSuspensionEnabled,
+		bool CacheReadEnabled, bool CacheProgramEnabled,
+		sim_time_type ReadLatencySLO, unsigned int MaxSuspensionsPerOperation,
+		Flash_Priority_Scheduling_Type PriorityScheduling, const unsigned int* PriorityClassWeights,
+		sim_time_type WriteBatchingWindow)
 		: TSU_Base(id, ftl, NVMController, Flash_Scheduling_Type::OUT_OF_ORDER, ChannelCount, chip_no_per_channel, DieNoPerChip, PlaneNoPerDie,
 			WriteReasonableSuspensionTimeForRead, EraseReasonableSuspensionTimeForRead, EraseReasonableSuspensionTimeForWrite,
-			EraseSuspensionEnabled, ProgramSuspensionEnabled)
+			EraseSuspensionEnabled, ProgramSuspensionEnabled),
+		cacheReadEnabled(CacheReadEnabled), cacheProgramEnabled(CacheProgramEnabled),
+		readLatencySLO(ReadLatencySLO), maxSuspensionsPerOperation(MaxSuspensionsPerOperation),
+		STAT_slo_program_suspensions(0), STAT_slo_erase_suspensions(0),
+		priorityScheduling(PriorityScheduling), STAT_promoted_prefetch_reads(0),
+		writeBatchingWindow(WriteBatchingWindow), flashPageSize(FlashPageSize), holdPlaneVectors(DieNoPerChip, 0), STAT_user_program_commands(0), STAT_user_programmed_pages(0),
+		STAT_user_write_dispatches(0), STAT_multi_die_user_write_dispatches(0), STAT_write_batching_holds(0),
+		STAT_first_user_program_time(0), STAT_last_user_program_time(0), STAT_reads_behind_writes(0), STAT_sum_of_read_behind_write_waiting_time(0)
 	{
+		for (unsigned int priority_class = 0; priority_class < TRANSACTION_PRIORITY_CLASS_COUNT; priority_class++) {
+			priorityClassStride[priority_class] = 1.0 / PriorityClassWeights[priority_class];
+			STAT_commands_per_priority_class[priority_class] = 0;
+		}
+
 		UserReadTRQueue = new Flash_Transaction_Queue*[channel_count];
 		UserWriteTRQueue = new Flash_Transaction_Queue*[channel_count];
 		GCReadTRQueue = new Flash_Transaction_Queue*[channel_count];
@@ -31,6 +48,9 @@ namespace SSD_Components
 		GCEraseTRQueue = new Flash_Transaction_Queue*[channel_count];
 		MappingReadTRQueue = new Flash_Transaction_Queue*[channel_count];
 		MappingWriteTRQueue = new Flash_Transaction_Queue*[channel_count];
+		PrefetchReadTRQueue = new Flash_Transaction_Queue*[channel_count];
+		priorityClassPass = new Priority_Class_Pass*[channel_count];
+		writeBatchReleaseTime = new sim_time_type*[channel_count];
 		for (unsigned int channelID = 0; channelID < channel_count; channelID++) {
 			UserReadTRQueue[channelID] = new Flash_Transaction_Queue[chip_no_per_channel];
 			UserWriteTRQueue[channelID] = new Flash_Transaction_Queue[chip_no_per_channel];
@@ -39,6 +59,9 @@ namespace SSD_Components
 			GCEraseTRQueue[channelID] = new Flash_Transaction_Queue[chip_no_per_channel];
 			MappingReadTRQueue[channelID] = new Flash_Transaction_Queue[chip_no_per_channel];
 			MappingWriteTRQueue[channelID] = new Flash_Transaction_Queue[chip_no_per_channel];
+			PrefetchReadTRQueue[channelID] = new Flash_Transaction_Queue[chip_no_per_channel];
+			priorityClassPass[channelID] = new Priority_Class_Pass[chip_no_per_channel];
+			writeBatchReleaseTime[channelID] = new sim_time_type[chip_no_per_channel];
 			for (unsigned int chip_cntr = 0; chip_cntr < chip_no_per_channel; chip_cntr++) {
 				UserReadTRQueue[channelID][chip_cntr].Set_id("User_Read_TR_Queue@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr));
 				UserWriteTRQueue[channelID][chip_cntr].Set_id("User_Write_TR_Queue@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr));
@@ -47,6 +70,12 @@ namespace SSD_Components
 				MappingWriteTRQueue[channelID][chip_cntr].Set_id("Mapping_Write_TR_Queue@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr));
 				GCWriteTRQueue[channelID][chip_cntr].Set_id("GC_Write_TR_Queue@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr));
 				GCEraseTRQueue[channelID][chip_cntr].Set_id("GC_Erase_TR_Queue@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr));
+				PrefetchReadTRQueue[channelID][chip_cntr].Set_id("Prefetch_Read_TR_Queue@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr));
+				for (unsigned int priority_class = 0; priority_class < TRANSACTION_PRIORITY_CLASS_COUNT; priority_class++) {
+					priorityClassPass[channelID][chip_cntr].Pass[priority_class] = 0;
+				}
+				priorityClassPass[channelID][chip_cntr].Virtual_time = 0;
+				writeBatchReleaseTime[channelID][chip_cntr] = 0;
 			}
 		}
 	}
@@ -61,6 +90,9 @@ namespace SSD_Components
 			delete[] GCEraseTRQueue[channelID];
 			delete[] MappingReadTRQueue[channelID];
 			delete[] MappingWriteTRQueue[channelID];
+			delete[] PrefetchReadTRQueue[channelID];
+			delete[] priorityClassPass[channelID];
+			delete[] writeBatchReleaseTime[channelID];
 		}
 		delete[] UserReadTRQueue;
 		delete[] UserWriteTRQueue;
@@ -69,6 +101,24 @@ namespace SSD_Components
 		delete[] GCEraseTRQueue;
 		delete[] MappingReadTRQueue;
 		delete[] MappingWriteTRQueue;
+		delete[] PrefetchReadTRQueue;
+		delete[] priorityClassPass;
+		delete[] writeBatchReleaseTime;
+	}
+
+	void TSU_OutOfOrder::Setup_triggers()
+	{
+		TSU_Base::Setup_triggers();
+		_NVMController->ConnectToTransactionServicedSignal(handle_user_program_serviced_signal_from_PHY);
+	}
+
+	//The user write bandwidth counts the time until the last user program completes
+	void TSU_OutOfOrder::handle_user_program_serviced_signal_from_PHY(NVM_Transaction_Flash* transaction)
+	{
+		if (transaction->Type == Transaction_Type::WRITE
+			&& (transaction->Source == Transaction_Source_Type::USERIO || transaction->Source == Transaction_Source_Type::CACHE)) {
+			((TSU_OutOfOrder*)_my_instance)->STAT_last_user_program_time = Simulator->Time();
+		}
 	}
 
 	void TSU_OutOfOrder::Start_simulation()
@@ -79,8 +129,14 @@ namespace SSD_Components
 	{
 	}
 
+	//The staging window of the writes of a chip has expired
 	void TSU_OutOfOrder::Execute_simulator_event(MQSimEngine::Sim_Event* event)
 	{
+		NVM::FlashMemory::Flash_Chip* chip = (NVM::FlashMemory::Flash_Chip*)event->Parameters;
+		if (writeBatchReleaseTime[chip->ChannelID][chip->ChipID] == Simulator->Time()) {
+			writeBatchReleaseTime[chip->ChannelID][chip->ChipID] = 0;
+		}
+		handle_chip_idle_signal(chip);
 	}
 
 	void TSU_OutOfOrder::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
@@ -90,12 +146,73 @@ namespace SSD_Components
 
 		TSU_Base::Report_results_in_XML(name_prefix, xmlwriter);
 
+		if (readLatencySLO > 0) {
+			std::string attr = "SLO_Program_Suspensions";
+			std::string val = std::to_string(STAT_slo_program_suspensions);
+			xmlwriter.Write_attribute_string(attr, val);
+
+			attr = "SLO_Erase_Suspensions";
+			val = std::to_string(STAT_slo_erase_suspensions);
+			xmlwriter.Write_attribute_string(attr, val);
+		}
+
+		if (priorityScheduling != Flash_Priority_Scheduling_Type::NONE) {
+			const char* class_names[TRANSACTION_PRIORITY_CLASS_COUNT] = { "Demand_Read_Commands", "Prefetch_Read_Commands", "Write_Back_Commands", "GC_Commands" };
+			for (unsigned int priority_class = 0; priority_class < TRANSACTION_PRIORITY_CLASS_COUNT; priority_class++) {
+				std::string attr = class_names[priority_class];
+				std::string val = std::to_string(STAT_commands_per_priority_class[priority_class]);
+				xmlwriter.Write_attribute_string(attr, val);
+			}
+
+			std::string attr = "Promoted_Prefetch_Reads";
+			std::string val = std::to_string(STAT_promoted_prefetch_reads);
+			xmlwriter.Write_attribute_string(attr, val);
+		}
+
+		std::string attr = "User_Program_Commands";
+		std::string val = std::to_string(STAT_user_program_commands);
+		xmlwriter.Write_attribute_string(attr, val);
+
+		attr = "Pages_Per_User_Program_Command";
+		val = std::to_string(STAT_user_program_commands == 0 ? 0 : (double)STAT_user_programmed_pages / STAT_user_program_commands);
+		xmlwriter.Write_attribute_string(attr, val);
+
+		//The bandwidth of the user programs over the time from the dispatch of the first to the completion of the last of them
+		attr = "User_Write_Bandwidth_MBps";
+		sim_time_type user_program_time = STAT_last_user_program_time - STAT_first_user_program_time;
+		val = std::to_string(user_program_time == 0 ? 0 : (double)STAT_user_programmed_pages * flashPageSize / user_program_time * SIM_TIME_TO_SECONDS_COEFF / 1000000);
+		xmlwriter.Write_attribute_string(attr, val);
+
+		attr = "Multi_Die_User_Write_Dispatch_Ratio";
+		val = std::to_string(STAT_user_write_dispatches == 0 ? 0 : (double)STAT_multi_die_user_write_dispatches / STAT_user_write_dispatches);
+		xmlwriter.Write_attribute_string(attr, val);
+
+		attr = "Write_Batching_Holds";
+		val = std::to_string(STAT_write_batching_holds);
+		xmlwriter.Write_attribute_string(attr, val);
+
+		attr = "Reads_Behind_Writes";
+		val = std::to_string(STAT_reads_behind_writes);
+		xmlwriter.Write_attribute_string(attr, val);
+
+		attr = "Avg_Read_Behind_Write_Waiting_Time";
+		val = std::to_string(STAT_reads_behind_writes == 0 ? 0 : STAT_sum_of_read_behind_write_waiting_time / STAT_reads_behind_writes);
+		xmlwriter.Write_attribute_string(attr, val);
+
 		for (unsigned int channelID = 0; channelID < channel_count; channelID++) {
 			for (unsigned int chip_cntr = 0; chip_cntr < chip_no_per_channel; chip_cntr++) {
 				UserReadTRQueue[channelID][chip_cntr].Report_results_in_XML(name_prefix + ".User_Read_TR_Queue", xmlwriter);
 			}
 		}
 
+		if (priorityScheduling != Flash_Priority_Scheduling_Type::NONE) {
+			for (unsigned int channelID = 0; channelID < channel_count; channelID++) {
+				for (unsigned int chip_cntr = 0; chip_cntr < chip_no_per_channel; chip_cntr++) {
+					PrefetchReadTRQueue[channelID][chip_cntr].Report_results_in_XML(name_prefix + ".Prefetch_Read_TR_Queue", xmlwriter);
+				}
+			}
+		}
+
 		for (unsigned int channelID = 0; channelID < channel_count; channelID++) {
 			for (unsigned int chip_cntr = 0; chip_cntr < chip_no_per_channel; chip_cntr++) {
 				UserWriteTRQueue[channelID][chip_cntr].Report_results_in_XML(name_prefix + ".User_Write_TR_Queue", xmlwriter);
@@ -184,7 +301,15 @@ namespace SSD_Components
 								useriochip = (*it)->Address.ChipID;
 								isUserRead = 1;
 							}
-							UserReadTRQueue[(*it)->Address.ChannelID][(*it)->Address.ChipID].push_back((*it));
+							if ((*it)->Priority_class == Transaction_Priority_Class::DEMAND_READ && (UserWriteTRQueue[(*it)->Address.ChannelID][(*it)->Address.ChipID].size() > 0
+								|| _NVMController->GetChipStatus(_NVMController->Get_chip((*it)->Address.ChannelID, (*it)->Address.ChipID)) == ChipStatus::WRITING)) {
+								readBehindWriteArrivalTime[*it] = Simulator->Time();
+							}
+							if (priorityScheduling != Flash_Priority_Scheduling_Type::NONE && (*it)->Priority_class == Transaction_Priority_Class::PREFETCH_READ) {
+								PrefetchReadTRQueue[(*it)->Address.ChannelID][(*it)->Address.ChipID].push_back((*it));
+							} else {
+								UserReadTRQueue[(*it)->Address.ChannelID][(*it)->Address.ChipID].push_back((*it));
+							}
 							
 							break;
 						case Transaction_Source_Type::MAPPING:
@@ -277,9 +402,32 @@ namespace SSD_Components
 				return false;
 			} else if (UserReadTRQueue[chip->ChannelID][chip->ChipID].size() > 0) {
 				sourceQueue1 = &UserReadTRQueue[chip->ChannelID][chip->ChipID];
+			} else if (PrefetchReadTRQueue[chip->ChannelID][chip->ChipID].size() > 0) {
+				sourceQueue1 = &PrefetchReadTRQueue[chip->ChannelID][chip->ChipID];
 			} else {
 				return false;
 			}
+		} else if (priorityScheduling != Flash_Priority_Scheduling_Type::NONE) {
+			Transaction_Priority_Class priority_class;
+			if (!select_priority_class(chip, priority_class)) {
+				return false;
+			}
+			switch (priority_class) {
+				case Transaction_Priority_Class::DEMAND_READ:
+					sourceQueue1 = &UserReadTRQueue[chip->ChannelID][chip->ChipID];
+					break;
+				case Transaction_Priority_Class::PREFETCH_READ:
+					sourceQueue1 = &PrefetchReadTRQueue[chip->ChannelID][chip->ChipID];
+					break;
+				case Transaction_Priority_Class::GC:
+					if (GCReadTRQueue[chip->ChannelID][chip->ChipID].size() == 0) {
+						return false;
+					}
+					sourceQueue1 = &GCReadTRQueue[chip->ChannelID][chip->ChipID];
+					break;
+				default:
+					return false;
+			}
 		} else {
 			 //If GC is currently executed in the preemptive mode, then user IO transaction queues are checked first
 			//int debug_GCW = GCWriteTRQueue[chip->ChannelID][chip->ChipID].size();
@@ -299,8 +447,18 @@ namespace SSD_Components
 		}
 		
 		bool suspensionRequired = false;
+		NVM_Transaction_Flash* leading_read = NULL;
 		ChipStatus cs = _NVMController->GetChipStatus(chip);
-		switch (cs) {
+		if (readLatencySLO > 0 && (cs == ChipStatus::WRITING || cs == ChipStatus::ERASING)) {
+			if (sourceQueue1 != &UserReadTRQueue[chip->ChannelID][chip->ChipID]) {
+				return false;
+			}
+			leading_read = read_missing_slo(chip);
+			if (leading_read == NULL) {
+				return false;
+			}
+			suspensionRequired = true;
+		} else switch (cs) {
 			case ChipStatus::IDLE:
 				break;
 			case ChipStatus::WRITING:
@@ -356,10 +514,24 @@ namespace SSD_Components
 		std::cout << "cnt_mergible_subpgs:" <<cnt_mergible_subpgs << std::endl;
 		*/
 #endif
+		//Only the die of the demand read is suspended, and the read leads the command
+		unsigned int dispatch_die_count = die_no_per_chip;
+		if (leading_read != NULL) {
+			dieID = leading_read->Address.DieID;
+			pageID = leading_read->Address.PageID;
+			dispatch_die_count = 1;
+		}
+
 		unsigned int planeVector = 0;
-		for (unsigned int i = 0; i < die_no_per_chip; i++) {
+		for (unsigned int i = 0; i < dispatch_die_count; i++) {
 			transaction_dispatch_slots.clear();
 			planeVector = 0;
+			if (leading_read != NULL) {
+				leading_read->SuspendRequired = true;
+				planeVector = 1 << leading_read->Address.PlaneID;
+				transaction_dispatch_slots.push_back(leading_read);
+				sourceQueue1->remove(leading_read);
+			}
 			for (Flash_Transaction_Queue::iterator it = sourceQueue1->begin(); it != sourceQueue1->end();) {
 				if ((*it)->Address.DieID == dieID && !(planeVector & 1 << (*it)->Address.PlaneID)) {
 
@@ -391,7 +563,19 @@ namespace SSD_Components
 				}
 			}
 
+			extend_to_cache_sequence(sourceQueue1, sourceQueue2);
 			if (transaction_dispatch_slots.size() > 0) {
+				if (readBehindWriteArrivalTime.size() > 0) {
+					for (auto tr : transaction_dispatch_slots) {
+						auto arrival = readBehindWriteArrivalTime.find(tr);
+						if (arrival != readBehindWriteArrivalTime.end()) {
+							STAT_reads_behind_writes++;
+							STAT_sum_of_read_behind_write_waiting_time += Simulator->Time() - arrival->second;
+							readBehindWriteArrivalTime.erase(arrival);
+						}
+					}
+				}
+				charge_priority_class(chip, transaction_dispatch_slots.front()->Priority_class);
 				_NVMController->Send_command_to_chip(transaction_dispatch_slots);
 			}
 			transaction_dispatch_slots.clear();
@@ -419,6 +603,24 @@ namespace SSD_Components
 			} else {
 				return false;
 			}
+		} else if (priorityScheduling != Flash_Priority_Scheduling_Type::NONE) {
+			Transaction_Priority_Class priority_class;
+			if (!select_priority_class(chip, priority_class)) {
+				return false;
+			}
+			switch (priority_class) {
+				case Transaction_Priority_Class::WRITE_BACK:
+					sourceQueue1 = &UserWriteTRQueue[chip->ChannelID][chip->ChipID];
+					break;
+				case Transaction_Priority_Class::GC:
+					if (GCWriteTRQueue[chip->ChannelID][chip->ChipID].size() == 0) {
+						return false;
+					}
+					sourceQueue1 = &GCWriteTRQueue[chip->ChannelID][chip->ChipID];
+					break;
+				default:
+					return false;
+			}
 		} else {
 			//If GC is currently executed in the preemptive mode, then user IO transaction queues are checked first
 
@@ -451,8 +653,14 @@ namespace SSD_Components
 				return false;
 		}
 
+		if (writeBatchingWindow > 0 && sourceQueue1 == &UserWriteTRQueue[chip->ChannelID][chip->ChipID] && GCWriteTRQueue[chip->ChannelID][chip->ChipID].size() == 0
+			&& hold_user_writes(chip)) {
+			return false;
+		}
+
 		flash_die_ID_type dieID = sourceQueue1->front()->Address.DieID;
 		flash_page_ID_type pageID = sourceQueue1->front()->Address.PageID;
+		unsigned int user_write_dies = 0;
 		flash_block_ID_type blockID = sourceQueue1->front()->Address.BlockID;
 		bool bypass = false;
 		unsigned int planeVector = 0;
@@ -515,12 +723,28 @@ namespace SSD_Components
 				}
 			}
 
+			extend_to_cache_sequence(sourceQueue1, sourceQueue2);
 			if (transaction_dispatch_slots.size() > 0) {
+				if (transaction_dispatch_slots.front()->Source == Transaction_Source_Type::USERIO || transaction_dispatch_slots.front()->Source == Transaction_Source_Type::CACHE) {
+					if (STAT_user_program_commands == 0) {
+						STAT_first_user_program_time = Simulator->Time();
+					}
+					STAT_user_program_commands++;
+					STAT_user_programmed_pages += transaction_dispatch_slots.size();
+					user_write_dies++;
+				}
+				charge_priority_class(chip, transaction_dispatch_slots.front()->Priority_class);
 				_NVMController->Send_command_to_chip(transaction_dispatch_slots);
 			}
 			transaction_dispatch_slots.clear();
 			dieID = (dieID + 1) % die_no_per_chip;
 		}
+		if (user_write_dies > 0) {
+			STAT_user_write_dispatches++;
+			if (user_write_dies > 1) {
+				STAT_multi_die_user_write_dispatches++;
+			}
+		}
 
 		return true;
 	}
@@ -552,6 +776,7 @@ namespace SSD_Components
 				it++;
 			}
 			if (transaction_dispatch_slots.size() > 0) {
+				charge_priority_class(chip, transaction_dispatch_slots.front()->Priority_class);
 				_NVMController->Send_command_to_chip(transaction_dispatch_slots);
 			}
 			transaction_dispatch_slots.clear();
@@ -560,4 +785,229 @@ namespace SSD_Components
 
 		return true;
 	}
+
+	/*
+	* Returns the oldest demand read of the chip if its die runs a program or erase that should be suspended for it, or NULL otherwise.
+	* The latency of the read is projected from the time that it has already waited, the rest of the program or erase, and the reads
+	* of all demand reads that are queued for the die. The operation is suspended if the projection exceeds the SLO, and the reads
+	* still meet it when they only wait for the suspend latency of the chip, so a read that is already late does not pay for a
+	* suspension that can not rescue it. Each operation is suspended at most maxSuspensionsPerOperation times.
+	*/
+	NVM_Transaction_Flash* TSU_OutOfOrder::read_missing_slo(NVM::FlashMemory::Flash_Chip* chip)
+	{
+		Flash_Transaction_Queue* queue = &UserReadTRQueue[chip->ChannelID][chip->ChipID];
+		NVM_Transaction_Flash* oldest_read = NULL;
+		for (Flash_Transaction_Queue::iterator it = queue->begin(); it != queue->end(); it++) {
+			if ((*it)->UserIORequest != NULL && !(*it)->UserIORequest->Latency_tolerant) {
+				oldest_read = *it;
+				break;
+			}
+		}
+		if (oldest_read == NULL || _NVMController->HasSuspendedCommand(chip)) {
+			return NULL;
+		}
+
+		const DieBookKeepingEntry* dieBKE = _NVMController->Get_die_book_keeping_entry(chip, oldest_read->Address.DieID);
+		if (dieBKE->Free || dieBKE->Suspended || dieBKE->ActiveCommand == NULL || dieBKE->Suspension_count >= maxSuspensionsPerOperation) {
+			return NULL;
+		}
+		bool program;
+		switch (dieBKE->ActiveCommand->CommandCode) {
+			case CMD_PROGRAM_PAGE:
+			case CMD_PROGRAM_PAGE_MULTIPLANE:
+				program = true;
+				break;
+			case CMD_ERASE_BLOCK:
+			case CMD_ERASE_BLOCK_MULTIPLANE:
+				program = false;
+				break;
+			default:
+				return NULL;
+		}
+		if (!(program ? programSuspensionEnabled : eraseSuspensionEnabled)) {
+			return NULL;
+		}
+
+		unsigned int pending_reads = 0;
+		for (Flash_Transaction_Queue::iterator it = queue->begin(); it != queue->end(); it++) {
+			if ((*it)->Address.DieID == oldest_read->Address.DieID && (*it)->UserIORequest != NULL && !(*it)->UserIORequest->Latency_tolerant) {
+				pending_reads++;
+			}
+		}
+		sim_time_type read_time = chip->Get_command_execution_latency(CMD_READ_PAGE, oldest_read->Address.PageID) + _NVMController->Expected_transfer_time(oldest_read);
+		sim_time_type waited_time = Simulator->Time() - oldest_read->UserIORequest->STAT_InitiationTime;
+		sim_time_type remaining_time = dieBKE->Expected_finish_time > Simulator->Time() ? dieBKE->Expected_finish_time - Simulator->Time() : 0;
+		sim_time_type suspend_time = program ? chip->GetSuspendProgramTime() : chip->GetSuspendEraseTime();
+		if (waited_time + remaining_time + pending_reads * read_time <= readLatencySLO || waited_time + suspend_time + pending_reads * read_time > readLatencySLO) {
+			return NULL;
+		}
+
+		if (program) {
+			STAT_slo_program_suspensions++;
+		} else {
+			STAT_slo_erase_suspensions++;
+		}
+		return oldest_read;
+	}
+
+	//Returns the class that is served next on the chip, among the classes that have transactions queued for it
+	bool TSU_OutOfOrder::select_priority_class(NVM::FlashMemory::Flash_Chip* chip, Transaction_Priority_Class& priority_class)
+	{
+		bool backlogged[TRANSACTION_PRIORITY_CLASS_COUNT];
+		backlogged[(int)Transaction_Priority_Class::DEMAND_READ] = UserReadTRQueue[chip->ChannelID][chip->ChipID].size() > 0;
+		backlogged[(int)Transaction_Priority_Class::PREFETCH_READ] = PrefetchReadTRQueue[chip->ChannelID][chip->ChipID].size() > 0;
+		backlogged[(int)Transaction_Priority_Class::WRITE_BACK] = UserWriteTRQueue[chip->ChannelID][chip->ChipID].size() > 0;
+		backlogged[(int)Transaction_Priority_Class::GC] = GCReadTRQueue[chip->ChannelID][chip->ChipID].size() > 0
+			|| GCWriteTRQueue[chip->ChannelID][chip->ChipID].size() > 0;
+
+		Priority_Class_Pass& state = priorityClassPass[chip->ChannelID][chip->ChipID];
+		bool found = false;
+		for (unsigned int cls = 0; cls < TRANSACTION_PRIORITY_CLASS_COUNT; cls++) {
+			if (!backlogged[cls]) {
+				continue;
+			}
+			if (priorityScheduling == Flash_Priority_Scheduling_Type::STRICT) {
+				priority_class = (Transaction_Priority_Class)cls;
+				return true;
+			}
+			if (state.Pass[cls] < state.Virtual_time) {
+				state.Pass[cls] = state.Virtual_time;
+			}
+			if (!found || state.Pass[cls] < state.Pass[(int)priority_class]) {
+				priority_class = (Transaction_Priority_Class)cls;
+				found = true;
+			}
+		}
+
+		return found;
+	}
+
+	void TSU_OutOfOrder::charge_priority_class(NVM::FlashMemory::Flash_Chip* chip, Transaction_Priority_Class priority_class)
+	{
+		if (priorityScheduling == Flash_Priority_Scheduling_Type::NONE) {
+			return;
+		}
+
+		Priority_Class_Pass& state = priorityClassPass[chip->ChannelID][chip->ChipID];
+		state.Virtual_time = state.Pass[(int)priority_class];
+		state.Pass[(int)priority_class] += priorityClassStride[(int)priority_class];
+		STAT_commands_per_priority_class[(int)priority_class]++;
+	}
+
+	bool TSU_OutOfOrder::promote_prefetch_read(NVM_Transaction_Flash* transaction)
+	{
+		TSU_Base::promote_prefetch_read(transaction);
+		if (priorityScheduling == Flash_Priority_Scheduling_Type::NONE) {
+			return false;
+		}
+
+		Flash_Transaction_Queue* prefetch_queue = &PrefetchReadTRQueue[transaction->Address.ChannelID][transaction->Address.ChipID];
+		for (Flash_Transaction_Queue::iterator it = prefetch_queue->begin(); it != prefetch_queue->end(); it++) {
+			if (*it == transaction) {
+				prefetch_queue->remove(it);
+				UserReadTRQueue[transaction->Address.ChannelID][transaction->Address.ChipID].push_back(transaction);
+				STAT_promoted_prefetch_reads++;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/*
+	* Returns true if the user writes of the chip should stay staged. They are released as soon as the writes that are queued for each die
+	* with writes fill the planes of a multi-plane program, as the dispatch loop of service_write_transaction forms it, so the dies that fill
+	* up within the window are programmed together, or when the oldest of them has waited for writeBatchingWindow. An event is scheduled
+	* for the latter, since no other event may come to the chip before it.
+	*/
+	bool TSU_OutOfOrder::hold_user_writes(NVM::FlashMemory::Flash_Chip* chip)
+	{
+		Flash_Transaction_Queue* queue = &UserWriteTRQueue[chip->ChannelID][chip->ChipID];
+		sim_time_type oldest_issue_time = queue->front()->Issue_time;
+		unsigned int full_plane_vector = (1 << plane_no_per_die) - 1;
+		flash_page_ID_type pageID = queue->front()->Address.PageID;
+		std::fill(holdPlaneVectors.begin(), holdPlaneVectors.end(), 0);
+		for (Flash_Transaction_Queue::iterator it = queue->begin(); it != queue->end(); it++) {
+			if ((*it)->Issue_time < oldest_issue_time) {
+				oldest_issue_time = (*it)->Issue_time;
+			}
+			if (((NVM_Transaction_Flash_WR*)*it)->RelatedRead != NULL) {
+				continue;
+			}
+			unsigned int& plane_vector = holdPlaneVectors[(*it)->Address.DieID];
+			if (plane_vector == 0 || (*it)->Address.PageID == pageID) {
+				plane_vector |= 1 << (*it)->Address.PlaneID;
+			}
+		}
+		bool batch_is_full = true;
+		for (unsigned int die_id = 0; die_id < die_no_per_chip; die_id++) {
+			if (holdPlaneVectors[die_id] != 0 && holdPlaneVectors[die_id] != full_plane_vector) {
+				batch_is_full = false;
+			}
+		}
+
+		sim_time_type release_time = oldest_issue_time + writeBatchingWindow;
+		if (batch_is_full || release_time <= Simulator->Time()) {
+			return false;
+		}
+
+		sim_time_type& pending_release_time = writeBatchReleaseTime[chip->ChannelID][chip->ChipID];
+		if (pending_release_time == 0 || pending_release_time > release_time) {
+			pending_release_time = release_time;
+			Simulator->Register_sim_event(release_time, this, chip, 0);
+		}
+		STAT_write_batching_holds++;
+
+		return true;
+	}
+
+	//Appends the transactions of the next pages of the same block to a single-page dispatch, which turns it into a cache read or cache program sequence
+	void TSU_OutOfOrder::extend_to_cache_sequence(Flash_Transaction_Queue* sourceQueue1, Flash_Transaction_Queue* sourceQueue2)
+	{
+		if (transaction_dispatch_slots.size() != 1 || transaction_dispatch_slots.front()->SuspendRequired) {
+			return;
+		}
+		NVM_Transaction_Flash* first = transaction_dispatch_slots.front();
+		if (first->Type == Transaction_Type::READ) {
+			if (!cacheReadEnabled) {
+				return;
+			}
+		} else if (first->Type == Transaction_Type::WRITE) {
+			if (!cacheProgramEnabled || ((NVM_Transaction_Flash_WR*)first)->ExecutionMode != WriteExecutionModeType::SIMPLE) {
+				return;
+			}
+		} else {
+			return;
+		}
+
+		flash_page_ID_type next_page = first->Address.PageID + 1;
+		Flash_Transaction_Queue* source_queues[2] = { sourceQueue1, sourceQueue2 };
+		bool extended = true;
+		while (extended && transaction_dispatch_slots.size() < MAX_CACHE_SEQUENCE_LENGTH) {
+			extended = false;
+			for (auto queue : source_queues) {
+				if (queue == NULL) {
+					continue;
+				}
+				for (Flash_Transaction_Queue::iterator it = queue->begin(); it != queue->end(); it++) {
+					NVM_Transaction_Flash* tr = *it;
+					if (tr->Type != first->Type || tr->Address.PageID != next_page || tr->Address.DieID != first->Address.DieID
+						|| tr->Address.PlaneID != first->Address.PlaneID || tr->Address.BlockID != first->Address.BlockID) {
+						continue;
+					}
+					if (tr->Type == Transaction_Type::WRITE && (((NVM_Transaction_Flash_WR*)tr)->RelatedRead != NULL
+						|| ((NVM_Transaction_Flash_WR*)tr)->ExecutionMode != WriteExecutionModeType::SIMPLE)) {
+						continue;
+					}
+					transaction_dispatch_slots.push_back(tr);
+					queue->remove(it);
+					next_page++;
+					extended = true;
+					break;
+				}
+				if (extended) {
+					break;
+				}
+			}
+		}
+	}
 }
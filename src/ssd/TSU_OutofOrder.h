@@ -2,6 +2,8 @@
 #define TSU_OUTOFORDER_H
 
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "TSU_Base.h"
 #include "NVM_Transaction_Flash.h"
 #include "NVM_PHY_ONFI_NVDDR2.h"
@@ -18,26 +20,43 @@ namespace SSD_Components
 	*    solid state disks, HPCA, 2014".
 	* 2. Program and erase suspension, similar to the proposal described in "G. Wu and X. He,
 	*    Reducing SSD read latency via NAND flash program and erase suspension, FAST 2012".
+	* 3. Cache read and cache program sequences over the consecutive pages of a block that
+	*    are queued for a die, if the flash chips support them.
+	* 4. A read latency SLO: a demand read suspends the program or erase of its die only if
+	*    waiting for it would exceed the SLO. Latency-tolerant reads, such as prefetches,
+	*    never suspend.
+	* 5. Priority classes for demand reads, prefetch reads, write-backs and GC, which share a
+	*    chip either in strict priority order or in proportion to their weights (stride
+	*    scheduling). GC in the urgent mode still goes first, since the free blocks run out.
+	* 6. A staging window for user writes: a write is held until the writes queued for its chip
+	*    fill a multi-plane program on each die, or until it has waited for the window. This
+	*    pairs up the single-page write-backs of a cache into multi-plane and multi-die batches.
 	*/
 	class TSU_OutOfOrder : public TSU_Base
 	{
 	public:
 		TSU_OutOfOrder(const sim_object_id_type& id, FTL* ftl, NVM_PHY_ONFI_NVDDR2* NVMController, unsigned int Channel_no, unsigned int chip_no_per_channel,
-			unsigned int DieNoPerChip, unsigned int PlaneNoPerDie,
+			unsigned int DieNoPerChip, unsigned int PlaneNoPerDie, unsigned int FlashPageSize,
 			sim_time_type WriteReasonableSuspensionTimeForRead,
 			sim_time_type EraseReasonableSuspensionTimeForRead,
 			sim_time_type EraseReasonableSuspensionTimeForWrite,
-			bool EraseSuspensionEnabled, bool ProgramSuspensionEnabled);
+			bool EraseSuspensionEnabled, bool ProgramSuspensionEnabled,
+			bool CacheReadEnabled, bool CacheProgramEnabled,
+			sim_time_type ReadLatencySLO, unsigned int MaxSuspensionsPerOperation,
+			Flash_Priority_Scheduling_Type PriorityScheduling, const unsigned int* PriorityClassWeights,
+			sim_time_type WriteBatchingWindow);
 		~TSU_OutOfOrder();
 		void Prepare_for_transaction_submit();
 		void Submit_transaction(NVM_Transaction_Flash* transaction);
 		void Schedule();
 
+		void Setup_triggers();
 		void Start_simulation();
 		void Validate_simulation_config();
 		void Execute_simulator_event(MQSimEngine::Sim_Event*);
 		void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
 	private:
+		static void handle_user_program_serviced_signal_from_PHY(NVM_Transaction_Flash* transaction);
 		Flash_Transaction_Queue** UserReadTRQueue;
 		Flash_Transaction_Queue** UserWriteTRQueue;
 		Flash_Transaction_Queue** GCReadTRQueue;
@@ -45,10 +64,46 @@ namespace SSD_Components
 		Flash_Transaction_Queue** GCEraseTRQueue;
 		Flash_Transaction_Queue** MappingReadTRQueue;
 		Flash_Transaction_Queue** MappingWriteTRQueue;
+		Flash_Transaction_Queue** PrefetchReadTRQueue;//Only used if the priority classes are scheduled
 
 		bool service_read_transaction(NVM::FlashMemory::Flash_Chip* chip);
 		bool service_write_transaction(NVM::FlashMemory::Flash_Chip* chip);
 		bool service_erase_transaction(NVM::FlashMemory::Flash_Chip* chip);
+
+		static const unsigned int MAX_CACHE_SEQUENCE_LENGTH = 16;
+		bool cacheReadEnabled, cacheProgramEnabled;
+		void extend_to_cache_sequence(Flash_Transaction_Queue* sourceQueue1, Flash_Transaction_Queue* sourceQueue2);
+
+		sim_time_type readLatencySLO;//0 if the suspension of a program or erase for a read only depends on its remaining time
+		unsigned int maxSuspensionsPerOperation;
+		unsigned long STAT_slo_program_suspensions, STAT_slo_erase_suspensions;
+		NVM_Transaction_Flash* read_missing_slo(NVM::FlashMemory::Flash_Chip* chip);
+
+		struct Priority_Class_Pass
+		{
+			double Pass[TRANSACTION_PRIORITY_CLASS_COUNT];
+			double Virtual_time;//The pass of the class that was served last, a class that was idle restarts from it
+		};
+		Flash_Priority_Scheduling_Type priorityScheduling;
+		double priorityClassStride[TRANSACTION_PRIORITY_CLASS_COUNT];
+		Priority_Class_Pass** priorityClassPass;
+		unsigned long STAT_commands_per_priority_class[TRANSACTION_PRIORITY_CLASS_COUNT];
+		unsigned long STAT_promoted_prefetch_reads;
+		bool select_priority_class(NVM::FlashMemory::Flash_Chip* chip, Transaction_Priority_Class& priority_class);
+		void charge_priority_class(NVM::FlashMemory::Flash_Chip* chip, Transaction_Priority_Class priority_class);
+		bool promote_prefetch_read(NVM_Transaction_Flash* transaction);
+
+		sim_time_type writeBatchingWindow;//0 if user writes are dispatched as soon as their chip is idle
+		sim_time_type** writeBatchReleaseTime;//The time at which the staged writes of a chip are released, 0 if no release is pending
+		unsigned int flashPageSize;//In bytes
+		std::vector<unsigned int> holdPlaneVectors;//By die, only used by hold_user_writes
+		unsigned long STAT_user_program_commands, STAT_user_programmed_pages, STAT_user_write_dispatches, STAT_multi_die_user_write_dispatches;
+		unsigned long STAT_write_batching_holds;
+		sim_time_type STAT_first_user_program_time, STAT_last_user_program_time;
+		std::unordered_map<NVM_Transaction_Flash*, sim_time_type> readBehindWriteArrivalTime;//Demand reads that arrived at a chip with queued or ongoing writes
+		unsigned long STAT_reads_behind_writes;
+		sim_time_type STAT_sum_of_read_behind_write_waiting_time;
+		bool hold_user_writes(NVM::FlashMemory::Flash_Chip* chip);
 	};
 }
 
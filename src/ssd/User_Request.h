@@ -29,6 +29,8 @@ namespace SSD_Components
 		unsigned int SizeInSectors;
 		UserRequestType Type;
 		stream_id_type Stream_id;
+		placement_id_type Placement_id = 0;//The placement ID of a write, passed on to its transactions
+		bool Latency_tolerant = false;//Set for the reads issued ahead of demand, e.g., prefetches, which never suspend a program or erase
 		bool ToBeIgnored;
 		void* IO_command_info;//used to store host I/O command info
 		void* Data;
@@ -0,0 +1,139 @@
+#include <cmath>
+#include <stdexcept>
+#include "Address_Distributions.h"
+
+namespace Utils
+{
+	//log(1 + x) / x and (exp(x) - 1) / x, with their Taylor series close to zero where the quotients lose precision
+	static double log1p_over_x(double x)
+	{
+		if (std::fabs(x) > 1e-8) {
+			return std::log1p(x) / x;
+		}
+		return 1 - x * (0.5 - x * (1.0 / 3 - 0.25 * x));
+	}
+
+	static double expm1_over_x(double x)
+	{
+		if (std::fabs(x) > 1e-8) {
+			return std::expm1(x) / x;
+		}
+		return 1 + x * 0.5 * (1 + x / 3 * (1 + 0.25 * x));
+	}
+
+	Zipf_Generator::Zipf_Generator(uint64_t item_count, double theta) : item_count(item_count), theta(theta)
+	{
+		if (item_count == 0) {
+			throw std::invalid_argument("Zipf distribution over an empty set of items");
+		}
+		if (theta < 0) {
+			throw std::invalid_argument("Negative Zipf theta");
+		}
+		h_integral_x1 = h_integral(1.5) - 1;
+		h_integral_item_count = h_integral((double)item_count + 0.5);
+		s = 2 - h_integral_inverse(h_integral(2.5) - h(2));
+	}
+
+	//The ranks are 1-based in the functions of the method
+	double Zipf_Generator::h(double x)
+	{
+		return std::exp(-theta * std::log(x));
+	}
+
+	double Zipf_Generator::h_integral(double x)
+	{
+		double log_x = std::log(x);
+		return expm1_over_x((1 - theta) * log_x) * log_x;
+	}
+
+	double Zipf_Generator::h_integral_inverse(double x)
+	{
+		double t = x * (1 - theta);
+		if (t < -1) {
+			t = -1;
+		}
+		return std::exp(log1p_over_x(t) * x);
+	}
+
+	uint64_t Zipf_Generator::Next(RandomGenerator* random)
+	{
+		while (true) {
+			double u = h_integral_item_count + random->FloatRandom() * (h_integral_x1 - h_integral_item_count);
+			double x = h_integral_inverse(u);
+			uint64_t k = (uint64_t)(x + 0.5);
+			if (k < 1) {
+				k = 1;
+			}
+			else if (k > item_count) {
+				k = item_count;
+			}
+			if (k - x <= s || u >= h_integral(k + 0.5) - h((double)k)) {
+				return k - 1;
+			}
+		}
+	}
+
+	Alias_Table::Alias_Table(const std::vector<double>& weights) : probability(weights.size()), alias(weights.size())
+	{
+		double sum = 0;
+		for (auto w : weights) {
+			if (w < 0) {
+				throw std::invalid_argument("Negative weight in an alias table");
+			}
+			sum += w;
+		}
+		if (weights.size() == 0 || sum <= 0) {
+			throw std::invalid_argument("Alias table without any weight");
+		}
+
+		std::vector<uint64_t> small, large;
+		for (uint64_t i = 0; i < weights.size(); i++) {
+			probability[i] = weights[i] * weights.size() / sum;
+			alias[i] = i;
+			if (probability[i] < 1) {
+				small.push_back(i);
+			}
+			else {
+				large.push_back(i);
+			}
+		}
+		while (small.size() > 0 && large.size() > 0) {
+			uint64_t l = small.back(), g = large.back();
+			small.pop_back();
+			alias[l] = g;
+			probability[g] -= 1 - probability[l];
+			if (probability[g] < 1) {
+				large.pop_back();
+				small.push_back(g);
+			}
+		}
+		//What is left is 1 up to rounding errors
+		for (auto i : small) {
+			probability[i] = 1;
+		}
+		for (auto i : large) {
+			probability[i] = 1;
+		}
+	}
+
+	uint64_t Alias_Table::Next(RandomGenerator* random)
+	{
+		double u = random->FloatRandom() * probability.size();
+		uint64_t i = (uint64_t)u;
+		if (i >= probability.size()) {
+			i = probability.size() - 1;
+		}
+		return (u - i) < probability[i] ? i : alias[i];
+	}
+
+	uint64_t Scramble_rank(uint64_t rank, uint64_t item_count)
+	{
+		//64-bit FNV-1a over the bytes of the rank
+		uint64_t hash = 0xCBF29CE484222325ULL;
+		for (int i = 0; i < 8; i++) {
+			hash ^= (rank >> (8 * i)) & 0xFF;
+			hash *= 0x100000001B3ULL;
+		}
+		return hash % item_count;
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef ADDRESS_DISTRIBUTIONS_H
+#define ADDRESS_DISTRIBUTIONS_H
+
+#include <cstdint>
+#include <vector>
+#include "RandomGenerator.h"
+
+namespace Utils
+{
+	/*
+	* Draws ranks from a Zipf distribution over item_count items, P(rank k) ~ 1 / (k + 1)^theta, with the rejection-inversion
+	* method of Hormann and Derflinger. A sample takes a constant expected number of uniform numbers (fewer than 1.1 for
+	* the usual theta values), independent of item_count, and no table of the items is built.
+	*/
+	class Zipf_Generator
+	{
+	public:
+		Zipf_Generator(uint64_t item_count, double theta);
+		uint64_t Next(RandomGenerator* random);//Rank in [0, item_count), 0 is the most popular item
+	private:
+		uint64_t item_count;
+		double theta;
+		double h_integral_x1, h_integral_item_count, s;
+		double h(double x);
+		double h_integral(double x);
+		double h_integral_inverse(double x);
+	};
+
+	//Walker's alias method: draws an index with probability proportional to its weight with one uniform number
+	class Alias_Table
+	{
+	public:
+		Alias_Table(const std::vector<double>& weights);
+		uint64_t Next(RandomGenerator* random);
+		uint64_t Size() { return (uint64_t)probability.size(); }
+	private:
+		std::vector<double> probability;
+		std::vector<uint64_t> alias;
+	};
+
+	//Spreads the popular ranks of a Zipf distribution over the item space, as in YCSB's scrambled Zipfian generator
+	uint64_t Scramble_rank(uint64_t rank, uint64_t item_count);
+}
+
+#endif // !ADDRESS_DISTRIBUTIONS_H
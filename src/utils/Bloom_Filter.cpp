@@ -0,0 +1,145 @@
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include "Bloom_Filter.h"
+
+namespace Utils
+{
+	//The finalizer of SplitMix64, which spreads consecutive LPAs over the whole 64-bit range
+	static inline uint64_t mix(uint64_t x)
+	{
+		x ^= x >> 30;
+		x *= 0xBF58476D1CE4E5B9ULL;
+		x ^= x >> 27;
+		x *= 0x94D049BB133111EBULL;
+		x ^= x >> 31;
+		return x;
+	}
+
+	Bloom_Filter::Bloom_Filter(uint64_t capacity, double false_positive_rate)
+		: STAT_lookup_count(0), STAT_positive_count(0), STAT_insert_count(0), STAT_reset_count(0), STAT_max_keys_per_epoch(0), keys_in_epoch(0)
+	{
+		if (capacity == 0) {
+			throw std::invalid_argument("Bloom filter without capacity");
+		}
+		if (false_positive_rate <= 0 || false_positive_rate >= 1) {
+			throw std::invalid_argument("The false-positive rate of a Bloom filter should be in (0, 1)");
+		}
+
+		//Start from the size of a classic Bloom filter and grow it until the blocked layout meets the target
+		double ln2 = std::log(2.0);
+		double bits = -(double)capacity * std::log(false_positive_rate) / (ln2 * ln2);
+		block_count = (uint64_t)std::ceil(bits / (BLOCK_WORDS * 64));
+		if (block_count == 0) {
+			block_count = 1;
+		}
+		while (true) {
+			double best_rate = 1;
+			for (unsigned int k = 1; k <= MAX_HASH_COUNT; k++) {
+				double rate = blocked_false_positive_rate(capacity, block_count, k);
+				if (rate < best_rate) {
+					best_rate = rate;
+					hash_count = k;
+				}
+			}
+			if (best_rate <= false_positive_rate) {
+				break;
+			}
+			block_count += block_count / 32 + 1;
+		}
+
+		storage.assign(block_count * BLOCK_WORDS + BLOCK_WORDS - 1, 0);
+		uintptr_t misalignment = ((uintptr_t)storage.data() / sizeof(uint64_t)) % BLOCK_WORDS;
+		blocks = storage.data() + (misalignment == 0 ? 0 : BLOCK_WORDS - misalignment);
+	}
+
+	//The number of keys in a block is Poisson distributed, and a block with j keys answers a lookup like a classic filter of 512 bits
+	double Bloom_Filter::blocked_false_positive_rate(uint64_t key_count, uint64_t block_count, unsigned int hash_count)
+	{
+		double keys_per_block = (double)key_count / block_count;
+		double bit_zero_probability = 1 - 1.0 / (BLOCK_WORDS * 64);
+		double rate = 0;
+		double probability = std::exp(-keys_per_block);
+		unsigned int max_keys = (unsigned int)(keys_per_block + 10 * std::sqrt(keys_per_block) + 20);
+		for (unsigned int j = 0; j <= max_keys; j++) {
+			if (j > 0) {
+				probability *= keys_per_block / j;
+			}
+			rate += probability * std::pow(1 - std::pow(bit_zero_probability, (double)hash_count * j), hash_count);
+		}
+		return rate;
+	}
+
+	/*
+	* The block comes from the high half of the hash and each bit from its own 9-bit slice of a stream of hashes. Double hashing
+	* is cheaper, but within 512 bits it yields only 128K bit patterns, which overlap each other in all but one bit often enough
+	* to multiply the false-positive rate for the rates below 1%.
+	*/
+	inline void Bloom_Filter::make_mask(uint64_t key, uint64_t& block, uint64_t* mask)
+	{
+		uint64_t hash = mix(key);
+		block = ((hash >> 32) * block_count) >> 32;
+		for (unsigned int w = 0; w < BLOCK_WORDS; w++) {
+			mask[w] = 0;
+		}
+		uint64_t bits = 0;
+		unsigned int bits_left = 0;
+		for (unsigned int i = 0; i < hash_count; i++) {
+			if (bits_left < 9) {
+				hash = mix(hash);
+				bits = hash;
+				bits_left = 64;
+			}
+			uint32_t bit = (uint32_t)(bits & (BLOCK_WORDS * 64 - 1));
+			bits >>= 9;
+			bits_left -= 9;
+			mask[bit >> 6] |= 1ULL << (bit & 63);
+		}
+	}
+
+	bool Bloom_Filter::Contains(uint64_t key)
+	{
+		uint64_t block, mask[BLOCK_WORDS];
+		make_mask(key, block, mask);
+		const uint64_t* words = blocks + block * BLOCK_WORDS;
+		uint64_t missing = 0;
+		for (unsigned int w = 0; w < BLOCK_WORDS; w++) {
+			missing |= mask[w] & ~words[w];
+		}
+
+		STAT_lookup_count++;
+		if (missing == 0) {
+			STAT_positive_count++;
+			return true;
+		}
+		return false;
+	}
+
+	void Bloom_Filter::Insert(uint64_t key)
+	{
+		uint64_t block, mask[BLOCK_WORDS];
+		make_mask(key, block, mask);
+		uint64_t* words = blocks + block * BLOCK_WORDS;
+		for (unsigned int w = 0; w < BLOCK_WORDS; w++) {
+			words[w] |= mask[w];
+		}
+
+		STAT_insert_count++;
+		keys_in_epoch++;
+		if (keys_in_epoch > STAT_max_keys_per_epoch) {
+			STAT_max_keys_per_epoch = keys_in_epoch;
+		}
+	}
+
+	void Bloom_Filter::Clear()
+	{
+		std::memset(blocks, 0, block_count * BLOCK_WORDS * sizeof(uint64_t));
+		keys_in_epoch = 0;
+		STAT_reset_count++;
+	}
+
+	double Bloom_Filter::Estimated_false_positive_rate()
+	{
+		return blocked_false_positive_rate(keys_in_epoch, block_count, hash_count);
+	}
+}
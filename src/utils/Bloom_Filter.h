@@ -0,0 +1,41 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <cstdint>
+#include <vector>
+
+namespace Utils
+{
+	/*
+	* A blocked Bloom filter: each key sets its bits in one block of 512 bits (one cache line), so a lookup touches a single
+	* line of memory. The block is tested eight 64-bit words at a time against the bit mask of the key, a loop that
+	* compilers turn into vector instructions. The filter is sized for a number of keys and a target false-positive rate,
+	* and its memory does not grow with the keys that are inserted.
+	*/
+	class Bloom_Filter
+	{
+	public:
+		Bloom_Filter(uint64_t capacity, double false_positive_rate);
+		bool Contains(uint64_t key);
+		void Insert(uint64_t key);
+		void Clear();
+		uint64_t Memory_size_in_bytes() { return block_count * BLOCK_WORDS * sizeof(uint64_t); }
+		unsigned int Hash_count() { return hash_count; }
+		double Estimated_false_positive_rate();//With the keys inserted since the last reset
+
+		uint64_t STAT_lookup_count, STAT_positive_count, STAT_insert_count, STAT_reset_count;
+		uint64_t STAT_max_keys_per_epoch;
+	private:
+		static const unsigned int BLOCK_WORDS = 8;
+		static const unsigned int MAX_HASH_COUNT = 16;
+		std::vector<uint64_t> storage;
+		uint64_t* blocks;//The storage aligned to 64 bytes
+		uint64_t block_count;
+		unsigned int hash_count;
+		uint64_t keys_in_epoch;
+		void make_mask(uint64_t key, uint64_t& block, uint64_t* mask);
+		static double blocked_false_positive_rate(uint64_t key_count, uint64_t block_count, unsigned int hash_count);
+	};
+}
+
+#endif // !BLOOM_FILTER_H
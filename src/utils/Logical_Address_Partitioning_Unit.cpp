@@ -42,6 +42,8 @@ namespace Utils
 		}
 
 		delete[] resource_list;
+		resource_list = NULL;
+		channel_count = 0;//Reset may run again before the next allocation
 	}
 
 	void Logical_Address_Partitioning_Unit::Allocate_logical_address_for_flows(HostInterface_Types hostinterface_type, unsigned int concurrent_stream_no,